@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# This file is part of Bitwuzla.
+#
+# Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+#
+# See COPYING for more information on using this software.
+##
+
+# Generate deep store chain benchmarks (QF_ABV) and optionally compare the
+# function solver with and without weak equivalence index paths
+# (--fun-weak-eq-paths) on them.
+#
+# Every instance consists of a chain of 'depth' stores with strictly
+# increasing symbolic indices on top of a base array, read at 'reads'
+# symbolic indices. Satisfiable instances require each read to hit a store
+# whose value differs from the base array, unsatisfiable instances
+# additionally require the first store to be overwritten.
+
+import argparse
+import os
+import subprocess
+import sys
+import time
+
+
+def gen_instance(depth, reads, width, unsat):
+    lines = []
+    lines.append('(set-logic QF_ABV)')
+    lines.append('(set-info :status {})'.format('unsat' if unsat else 'sat'))
+    bv = '(_ BitVec {})'.format(width)
+    lines.append('(declare-const a (Array {} {}))'.format(bv, bv))
+    for k in range(depth):
+        lines.append('(declare-const i{} {})'.format(k, bv))
+        lines.append('(declare-const v{} {})'.format(k, bv))
+    for k in range(depth - 1):
+        lines.append('(assert (bvult i{} i{}))'.format(k, k + 1))
+    lines.append('(define-fun s0 () (Array {} {}) a)'.format(bv, bv))
+    for k in range(depth):
+        lines.append(
+            '(define-fun s{} () (Array {} {}) (store s{} i{} v{}))'.format(
+                k + 1, bv, bv, k, k, k))
+    for r in range(reads):
+        lines.append('(declare-const j{} {})'.format(r, bv))
+        lines.append(
+            '(assert (= (select s{} j{}) (bvadd (select a j{}) #b{})))'.format(
+                depth, r, r, '0' * (width - 1) + '1'))
+    if unsat:
+        lines.append('(assert (distinct (select s{} i0) v0))'.format(depth))
+    lines.append('(check-sat)')
+    lines.append('(exit)')
+    return '\n'.join(lines) + '\n'
+
+
+def run(binary, path, args, timeout):
+    start = time.time()
+    try:
+        res = subprocess.run([binary] + args + [path],
+                             stdout=subprocess.PIPE,
+                             stderr=subprocess.PIPE,
+                             timeout=timeout)
+        out = res.stdout.decode().strip()
+    except subprocess.TimeoutExpired:
+        out = 'timeout'
+    return out, time.time() - start
+
+
+def main():
+    ap = argparse.ArgumentParser(
+        description='generate deep store chain benchmarks')
+    ap.add_argument('outdir', help='output directory for generated files')
+    ap.add_argument('--depths',
+                    default='100,200,400,800',
+                    help='comma separated list of store chain depths')
+    ap.add_argument('--reads',
+                    type=int,
+                    default=16,
+                    help='number of reads per instance')
+    ap.add_argument('--width',
+                    type=int,
+                    default=32,
+                    help='bit-width of indices and elements')
+    ap.add_argument('--compare',
+                    metavar='BITWUZLA',
+                    help='run given binary on generated files with and '
+                    'without --fun-weak-eq-paths')
+    ap.add_argument('--timeout', type=int, default=300)
+    args = ap.parse_args()
+
+    depths = [int(d) for d in args.depths.split(',')]
+    if max(depths) >= 2**args.width:
+        sys.exit('error: depth exceeds number of indices')
+
+    os.makedirs(args.outdir, exist_ok=True)
+    files = []
+    for depth in depths:
+        for unsat in (False, True):
+            path = os.path.join(
+                args.outdir, 'storechain-{}-{}-{}.smt2'.format(
+                    depth, args.reads, 'unsat' if unsat else 'sat'))
+            with open(path, 'w') as f:
+                f.write(gen_instance(depth, args.reads, args.width, unsat))
+            files.append(path)
+
+    if not args.compare:
+        return
+
+    print('{:40} {:>8} {:>10} {:>10}'.format('instance', 'result', 'lod',
+                                             'weak-eq'))
+    for path in files:
+        res0, t0 = run(args.compare, path, [], args.timeout)
+        res1, t1 = run(args.compare, path, ['--fun-weak-eq-paths'],
+                       args.timeout)
+        if res0 != res1 and 'timeout' not in (res0, res1):
+            sys.exit('error: result mismatch on {}'.format(path))
+        print('{:40} {:>8} {:>10.2f} {:>10.2f}'.format(
+            os.path.basename(path), res0, t0, t1))
+
+
+if __name__ == '__main__':
+    main()
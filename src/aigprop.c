@@ -11,6 +11,9 @@
 #include "aigprop.h"
 
 #include <math.h>
+#ifdef BZLA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
 #include "bzlaclone.h"
 #include "bzlacore.h"
@@ -51,20 +54,64 @@ msg(char *fmt, ...)
 
 /*------------------------------------------------------------------------*/
 
+#define BZLA_AIGPROP_NWORDS(size) (((size) + 63) / 64)
+
+static inline bool
+is_assigned(BzlaAIGProp *aprop, int32_t id)
+{
+  assert(aprop);
+  assert(id > 0);
+
+  return (uint32_t) id < aprop->size
+         && ((aprop->assigned[id >> 6] >> (id & 63)) & 1);
+}
+
+static inline int32_t
+get_assignment(BzlaAIGProp *aprop, int32_t id)
+{
+  assert(aprop);
+  assert(is_assigned(aprop, id));
+
+  return ((aprop->model[id >> 6] >> (id & 63)) & 1) ? 1 : -1;
+}
+
+static inline void
+set_assignment(BzlaAIGProp *aprop, int32_t id, int32_t assignment)
+{
+  assert(aprop);
+  assert(id > 0 && (uint32_t) id < aprop->size);
+  assert(assignment == 1 || assignment == -1);
+
+  uint64_t bit;
+
+  bit = ((uint64_t) 1) << (id & 63);
+  aprop->assigned[id >> 6] |= bit;
+  if (assignment == 1)
+    aprop->model[id >> 6] |= bit;
+  else
+    aprop->model[id >> 6] &= ~bit;
+}
+
+bool
+bzla_aigprop_has_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
+{
+  assert(aprop);
+
+  if (bzla_aig_is_const(aig)) return true;
+  return aprop->model && is_assigned(aprop, BZLA_REAL_ADDR_AIG(aig)->id);
+}
+
 int32_t
 bzla_aigprop_get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
 {
   assert(aprop);
 
   int32_t res;
-  int32_t id;
 
   if (bzla_aig_is_true(aig)) return 1;
   if (bzla_aig_is_false(aig)) return -1;
 
-  id = bzla_aig_get_id(BZLA_REAL_ADDR_AIG(aig));
-  assert(bzla_hashint_map_get(aprop->model, id));
-  res = bzla_hashint_map_get(aprop->model, id)->as_int;
+  res = get_assignment(aprop, bzla_aig_get_id(BZLA_REAL_ADDR_AIG(aig)));
   res = BZLA_IS_INVERTED_AIG(aig) ? -res : res;
   return res;
 }
@@ -341,84 +388,17 @@ compute_scores(BzlaAIGProp *aprop)
 
 /*------------------------------------------------------------------------*/
 
-static void
-recursively_compute_assignment(BzlaAIGProp *aprop, BzlaAIG *aig)
-{
-  assert(aprop);
-  assert(aprop->model);
-  assert(aig);
-
-  int32_t aleft, aright;
-  BzlaAIG *cur, *real_cur, *left, *right;
-  BzlaAIGPtrStack stack;
-  BzlaIntHashTable *cache;
-  BzlaMemMgr *mm;
-
-  if (bzla_aig_is_const(aig)) return;
-
-  mm = aprop->mm;
-
-  cache = bzla_hashint_table_new(mm);
-  BZLA_INIT_STACK(mm, stack);
-  BZLA_PUSH_STACK(stack, aig);
-
-  while (!BZLA_EMPTY_STACK(stack))
-  {
-    cur      = BZLA_POP_STACK(stack);
-    real_cur = BZLA_REAL_ADDR_AIG(cur);
-    assert(!bzla_aig_is_const(real_cur));
-    if (bzla_hashint_map_contains(aprop->model, real_cur->id)) continue;
-
-    if (bzla_aig_is_var(real_cur))
-    {
-      /* initialize with false */
-      bzla_hashint_map_add(aprop->model, real_cur->id)->as_int = -1;
-    }
-    else
-    {
-      assert(bzla_aig_is_and(real_cur));
-      left  = bzla_aig_get_left_child(aprop->amgr, real_cur);
-      right = bzla_aig_get_right_child(aprop->amgr, real_cur);
-
-      if (!bzla_hashint_table_contains(cache, real_cur->id))
-      {
-        bzla_hashint_table_add(cache, real_cur->id);
-        BZLA_PUSH_STACK(stack, cur);
-        if (!bzla_aig_is_const(left)
-            && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(left)->id))
-          BZLA_PUSH_STACK(stack, left);
-        if (!bzla_aig_is_const(right)
-            && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(right)->id))
-          BZLA_PUSH_STACK(stack, right);
-      }
-      else
-      {
-        aleft = bzla_aigprop_get_assignment_aig(aprop, left);
-        assert(aleft);
-        aright = bzla_aigprop_get_assignment_aig(aprop, right);
-        assert(aright);
-        if (aleft < 0 || aright < 0)
-          bzla_hashint_map_add(aprop->model, real_cur->id)->as_int = -1;
-        else
-          bzla_hashint_map_add(aprop->model, real_cur->id)->as_int = 1;
-      }
-    }
-  }
-
-  bzla_hashint_table_delete(cache);
-  BZLA_RELEASE_STACK(stack);
-}
-
 void
 bzla_aigprop_delete_model(BzlaAIGProp *aprop)
 {
   assert(aprop);
 
   if (!aprop->model) return;
-  bzla_hashint_map_delete(aprop->model);
-  aprop->model = 0;
+  BZLA_DELETEN(aprop->mm, aprop->model, BZLA_AIGPROP_NWORDS(aprop->size));
+  BZLA_DELETEN(aprop->mm, aprop->assigned, BZLA_AIGPROP_NWORDS(aprop->size));
+  aprop->model    = 0;
+  aprop->assigned = 0;
+  aprop->size     = 0;
 }
 
 void
@@ -427,23 +407,122 @@ bzla_aigprop_init_model(BzlaAIGProp *aprop)
   assert(aprop);
 
   if (aprop->model) bzla_aigprop_delete_model(aprop);
-  aprop->model = bzla_hashint_map_new(aprop->mm);
+  aprop->size = BZLA_COUNT_STACK(aprop->amgr->id2aig);
+  BZLA_CNEWN(aprop->mm, aprop->model, BZLA_AIGPROP_NWORDS(aprop->size));
+  BZLA_CNEWN(aprop->mm, aprop->assigned, BZLA_AIGPROP_NWORDS(aprop->size));
 }
 
-void
-bzla_aigprop_generate_model(BzlaAIGProp *aprop, bool reset)
+/* Get the values of 'id' (signed) in all 64 simulation lanes, 'pos' maps
+ * the ids of the AIGs in the cone to their position in 'sim'. */
+static inline uint64_t
+get_sim_value(BzlaAIGProp *aprop,
+              BzlaIntHashTable *pos,
+              uint64_t *sim,
+              int32_t id)
+{
+  BzlaAIG *aig;
+  uint64_t res;
+
+  aig = bzla_aig_get_by_id(aprop->amgr, id);
+  if (bzla_aig_is_true(aig)) return UINT64_MAX;
+  if (bzla_aig_is_false(aig)) return 0;
+  assert(bzla_hashint_map_contains(pos, id < 0 ? -id : id));
+  res = sim[bzla_hashint_map_get(pos, id < 0 ? -id : id)->as_int];
+  return id < 0 ? ~res : res;
+}
+
+/* Simulate the cone of the roots under 64 assignments of the inputs at
+ * once, one per bit of 'sim' (indexed by position in the cone, see
+ * get_sim_value). Lane 0 is the current assignment of the inputs (unassigned
+ * inputs are false), all other lanes are random if 'sample' is true (and
+ * meaningless otherwise). Returns the lane that satisfies the most roots
+ * (lane 0 on ties or if not 'sample'). */
+static uint32_t
+simulate(BzlaAIGProp *aprop,
+         BzlaIntHashTable *pos,
+         uint64_t *sim,
+         bool sample)
 {
   assert(aprop);
-  assert(aprop->roots);
+  assert(aprop->cone);
+  assert(pos);
+  assert(sim);
 
+  int32_t id;
+  uint32_t i, lane, best, nsat[64];
+  uint64_t val;
+  BzlaAIG *cur;
   BzlaIntHashTableIterator it;
 
-  if (reset) bzla_aigprop_init_model(aprop);
+  for (i = 0; i < BZLA_COUNT_STACK(*aprop->cone); i++)
+  {
+    id = BZLA_PEEK_STACK(*aprop->cone, i);
+    assert(!bzla_hashint_map_contains(pos, id));
+    bzla_hashint_map_add(pos, id)->as_int = i;
+    cur = bzla_aig_get_by_id(aprop->amgr, id);
+    if (bzla_aig_is_var(cur))
+    {
+      val = is_assigned(aprop, id) && get_assignment(aprop, id) == 1;
+      if (sample)
+      {
+        val |= (((uint64_t) bzla_rng_rand(aprop->rng) << 32)
+                | bzla_rng_rand(aprop->rng))
+               & ~((uint64_t) 1);
+      }
+      sim[i] = val;
+    }
+    else
+    {
+      assert(bzla_aig_is_and(cur));
+      sim[i] = get_sim_value(aprop, pos, sim, cur->children[0])
+               & get_sim_value(aprop, pos, sim, cur->children[1]);
+    }
+  }
 
+  if (!sample) return 0;
+
+  memset(nsat, 0, sizeof(nsat));
   bzla_iter_hashint_init(&it, aprop->roots);
   while (bzla_iter_hashint_has_next(&it))
-    recursively_compute_assignment(
-        aprop, bzla_aig_get_by_id(aprop->amgr, bzla_iter_hashint_next(&it)));
+  {
+    val = get_sim_value(aprop, pos, sim, bzla_iter_hashint_next(&it));
+    for (lane = 0; lane < 64; lane++) nsat[lane] += (val >> lane) & 1;
+  }
+  for (lane = 1, best = 0; lane < 64; lane++)
+  {
+    if (nsat[lane] > nsat[best]) best = lane;
+  }
+  return best;
+}
+
+void
+bzla_aigprop_generate_model(BzlaAIGProp *aprop, bool reset)
+{
+  assert(aprop);
+  assert(aprop->roots);
+  assert(aprop->cone);
+
+  uint32_t i, n, lane;
+  uint64_t *sim;
+  BzlaIntHashTable *pos;
+
+  if (reset || !aprop->model) bzla_aigprop_init_model(aprop);
+
+  /* Inputs are assigned to false (unless already assigned). If enabled, on
+   * reset, the best out of 64 input assignments (the all-false assignment
+   * and 63 random assignments) is picked instead. */
+  n   = BZLA_COUNT_STACK(*aprop->cone);
+  pos = bzla_hashint_map_new(aprop->mm);
+  BZLA_NEWN(aprop->mm, sim, n);
+  lane = simulate(aprop, pos, sim, reset && aprop->use_sim);
+  for (i = 0; i < n; i++)
+  {
+    set_assignment(aprop,
+                   BZLA_PEEK_STACK(*aprop->cone, i),
+                   ((sim[i] >> lane) & 1) ? 1 : -1);
+  }
+  BZLA_DELETEN(aprop->mm, sim, n);
+  bzla_hashint_map_delete(pos);
 }
 
 /*------------------------------------------------------------------------*/
@@ -556,8 +635,8 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
     if (bzla_hashint_table_contains(cache, cur->id)) continue;
     bzla_hashint_table_add(cache, cur->id);
     if (cur != aig) BZLA_PUSH_STACK(cone, cur);
-    assert(bzla_hashint_map_contains(aprop->parents, cur->id));
-    parents = bzla_hashint_map_get(aprop->parents, cur->id)->as_ptr;
+    assert((uint32_t) cur->id < aprop->size);
+    parents = &aprop->parents[cur->id];
     for (i = 0; i < BZLA_COUNT_STACK(*parents); i++)
       BZLA_PUSH_STACK(
           stack, bzla_aig_get_by_id(aprop->amgr, BZLA_PEEK_STACK(*parents, i)));
@@ -569,14 +648,13 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
 
   /* update assignment and score of 'aig' --------------------------------- */
   /* update model */
-  d = bzla_hashint_map_get(aprop->model, aig->id);
-  assert(d);
+  assert(is_assigned(aprop, aig->id));
   /* update unsatroots table */
-  if (d->as_int != assignment
+  if (get_assignment(aprop, aig->id) != assignment
       && (bzla_hashint_table_contains(aprop->roots, aig->id)
           || bzla_hashint_table_contains(aprop->roots, -aig->id)))
     update_unsatroots_table(aprop, aig, assignment);
-  d->as_int = assignment;
+  set_assignment(aprop, aig->id, assignment);
 
   /* update score */
   if (aprop->score)
@@ -601,7 +679,7 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
     cur = BZLA_PEEK_STACK(cone, i);
     assert(BZLA_IS_REGULAR_AIG(cur));
     assert(bzla_aig_is_and(cur));
-    assert(bzla_hashint_map_contains(aprop->model, cur->id));
+    assert(is_assigned(aprop, cur->id));
 
     left  = bzla_aig_get_left_child(aprop->amgr, cur);
     right = bzla_aig_get_right_child(aprop->amgr, cur);
@@ -610,14 +688,12 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
     aright = bzla_aigprop_get_assignment_aig(aprop, right);
     assert(aright);
     ass = aleft < 0 || aright < 0 ? -1 : 1;
-    d   = bzla_hashint_map_get(aprop->model, cur->id);
-    assert(d);
     /* update unsatroots table */
-    if (d->as_int != ass
+    if (get_assignment(aprop, cur->id) != ass
         && (bzla_hashint_table_contains(aprop->roots, cur->id)
             || bzla_hashint_table_contains(aprop->roots, -cur->id)))
       update_unsatroots_table(aprop, cur, ass);
-    d->as_int = ass;
+    set_assignment(aprop, cur->id, ass);
   }
 
   aprop->time.update_cone_model_gen += bzla_util_time_stamp() - delta;
@@ -798,7 +874,6 @@ select_move(BzlaAIGProp *aprop,
   uint32_t eidx;
   uint64_t nprops, max_nprops;
   BzlaAIG *cur, *real_cur, *c[2];
-  BzlaHashTableData *d;
 
   *input      = 0;
   *assignment = 0;
@@ -845,13 +920,7 @@ select_move(BzlaAIGProp *aprop,
         /* choose 0-branch if exactly one branch is 0,
          * else choose randomly */
         for (i = 0; i < 2; i++)
-        {
-          assert(
-              bzla_hashint_map_get(aprop->model, BZLA_REAL_ADDR_AIG(c[i])->id));
-          d = bzla_hashint_map_get(aprop->model, BZLA_REAL_ADDR_AIG(c[i])->id);
-          assert(d);
-          ass[i] = BZLA_IS_INVERTED_AIG(c[i]) ? -d->as_int : d->as_int;
-        }
+          ass[i] = bzla_aigprop_get_assignment_aig(aprop, c[i]);
         if (ass[0] == -1 && ass[1] == 1)
           eidx = 0;
         else if (ass[0] == 1 && ass[1] == -1)
@@ -921,6 +990,233 @@ move(BzlaAIGProp *aprop, uint32_t nmoves)
 
 /*------------------------------------------------------------------------*/
 
+/* Local search on the current set of roots until all roots are satisfied,
+ * a conflict is found, the propagation limit is reached or another walker
+ * determined a result. */
+static int32_t
+search(BzlaAIGProp *aprop)
+{
+  assert(aprop);
+  assert(aprop->roots);
+  assert(aprop->parents);
+  assert(aprop->cone);
+
+  int32_t j, max_steps, sat_result, rootid, move_res;
+  uint32_t nmoves;
+  BzlaIntHashTableIterator it;
+  BzlaAIG *root;
+
+  nmoves = 0;
+
+  /* generate initial model */
+  bzla_aigprop_generate_model(aprop, true);
+
+  for (;;)
+  {
+    /* collect unsatisfied roots (kept up-to-date in update_cone) */
+    assert(!aprop->unsatroots);
+    aprop->unsatroots = bzla_hashint_map_new(aprop->mm);
+    bzla_iter_hashint_init(&it, aprop->roots);
+    while (bzla_iter_hashint_has_next(&it))
+    {
+      rootid = bzla_iter_hashint_next(&it);
+      root   = bzla_aig_get_by_id(aprop->amgr, rootid);
+      if (bzla_aig_is_true(root)) continue;
+      if (bzla_aig_is_false(root)) goto UNSAT;
+      if (bzla_hashint_table_contains(aprop->roots, -rootid)) goto UNSAT;
+      assert(bzla_aigprop_get_assignment_aig(aprop, root));
+      if (!bzla_hashint_map_contains(aprop->unsatroots, rootid)
+          && bzla_aigprop_get_assignment_aig(aprop, root) == -1)
+        bzla_hashint_map_add(aprop->unsatroots, rootid);
+    }
+
+    /* compute initial score */
+    compute_scores(aprop);
+
+    if (!aprop->unsatroots->count) goto SAT;
+
+    for (j = 0, max_steps = BZLA_AIGPROP_MAXSTEPS(aprop->stats.restarts + 1);
+         !aprop->use_restarts || j < max_steps;
+         j++)
+    {
+      if (aprop->terminate
+          && __atomic_load_n(aprop->terminate, __ATOMIC_ACQUIRE))
+        goto UNKNOWN;
+      move_res = move(aprop, nmoves);
+      if (move_res == -1)
+        goto UNSAT;
+      else if (move_res == 0)
+        goto UNKNOWN;
+      assert(move_res == 1);
+      nmoves += 1;
+      if (!aprop->unsatroots->count) goto SAT;
+    }
+
+    /* restart */
+    bzla_aigprop_generate_model(aprop, true);
+    bzla_hashint_map_delete(aprop->score);
+    aprop->score = 0;
+    bzla_hashint_map_delete(aprop->unsatroots);
+    aprop->unsatroots = 0;
+    aprop->stats.restarts += 1;
+  }
+SAT:
+  sat_result = BZLA_AIGPROP_SAT;
+  goto DONE;
+UNSAT:
+  sat_result = BZLA_AIGPROP_UNSAT;
+  goto DONE;
+UNKNOWN:
+  sat_result = BZLA_AIGPROP_UNKNOWN;
+DONE:
+  if (aprop->unsatroots) bzla_hashint_map_delete(aprop->unsatroots);
+  aprop->unsatroots = 0;
+  if (aprop->score) bzla_hashint_map_delete(aprop->score);
+  aprop->score = 0;
+  return sat_result;
+}
+
+#ifdef BZLA_HAVE_PTHREADS
+struct BzlaAIGPropWalker
+{
+  BzlaAIGProp *aprop;
+  int32_t result;
+  bool *found_result;
+  pthread_mutex_t *found_result_mutex;
+};
+
+typedef struct BzlaAIGPropWalker BzlaAIGPropWalker;
+
+static void *
+walker_thread_work(void *state)
+{
+  int32_t res;
+  BzlaAIGPropWalker *walker;
+
+  walker = state;
+  res    = search(walker->aprop);
+
+  pthread_mutex_lock(walker->found_result_mutex);
+  if (res != BZLA_AIGPROP_UNKNOWN
+      && !__atomic_load_n(walker->found_result, __ATOMIC_ACQUIRE))
+  {
+    walker->result = res;
+    __atomic_store_n(walker->found_result, true, __ATOMIC_RELEASE);
+  }
+  pthread_mutex_unlock(walker->found_result_mutex);
+  return NULL;
+}
+
+/* Run 'aprop->nthreads' walkers in parallel on the same roots, each with its
+ * own model, scores and seed. The first walker is 'aprop' itself, all other
+ * walkers only share the (read-only) roots, parents and cone with it. The
+ * first walker that determines a result terminates all other walkers, its
+ * model is installed in 'aprop'. */
+static int32_t
+search_parallel(BzlaAIGProp *aprop)
+{
+  assert(aprop);
+  assert(aprop->nthreads > 1);
+
+  bool found_result;
+  pthread_mutex_t found_result_mutex = PTHREAD_MUTEX_INITIALIZER;
+  int32_t sat_result;
+  uint32_t i, n;
+  BzlaMemMgr *mm;
+  BzlaAIGProp *cur;
+  BzlaAIGPropWalker *walkers;
+  pthread_t *threads;
+  bool *started;
+
+  mm = aprop->mm;
+  n  = aprop->nthreads;
+
+  found_result = false;
+  BZLA_CNEWN(mm, walkers, n);
+  BZLA_CNEWN(mm, threads, n);
+  BZLA_CNEWN(mm, started, n);
+
+  for (i = 0; i < n; i++)
+  {
+    if (i == 0)
+    {
+      cur = aprop;
+    }
+    else
+    {
+      cur = bzla_aigprop_new_aigprop(aprop->amgr,
+                                     aprop->loglevel,
+                                     aprop->seed + i,
+                                     aprop->use_restarts,
+                                     aprop->use_bandit,
+                                     aprop->use_sim,
+                                     1,
+                                     aprop->nprops);
+      /* share read-only data with the first walker */
+      cur->roots   = aprop->roots;
+      cur->parents = aprop->parents;
+      cur->cone    = aprop->cone;
+    }
+    cur->terminate                = &found_result;
+    walkers[i].aprop              = cur;
+    walkers[i].result             = BZLA_AIGPROP_UNKNOWN;
+    walkers[i].found_result       = &found_result;
+    walkers[i].found_result_mutex = &found_result_mutex;
+  }
+
+  for (i = 1; i < n; i++)
+  {
+    started[i] =
+        pthread_create(&threads[i], 0, walker_thread_work, &walkers[i]) == 0;
+  }
+  walker_thread_work(&walkers[0]);
+  for (i = 1; i < n; i++)
+  {
+    if (started[i])
+      pthread_join(threads[i], 0);
+    else if (!__atomic_load_n(&found_result, __ATOMIC_ACQUIRE))
+      walker_thread_work(&walkers[i]);
+  }
+
+  sat_result = BZLA_AIGPROP_UNKNOWN;
+  for (i = 0; i < n; i++)
+  {
+    cur = walkers[i].aprop;
+    if (walkers[i].result != BZLA_AIGPROP_UNKNOWN)
+    {
+      assert(sat_result == BZLA_AIGPROP_UNKNOWN);
+      sat_result = walkers[i].result;
+      BZLA_AIGPROPLOG(1, "walker %u (seed %u) determined result", i, cur->seed);
+      if (cur != aprop && cur->model)
+      {
+        assert(aprop->model);
+        assert(aprop->size == cur->size);
+        memcpy(aprop->model,
+               cur->model,
+               BZLA_AIGPROP_NWORDS(cur->size) * sizeof(uint64_t));
+        memcpy(aprop->assigned,
+               cur->assigned,
+               BZLA_AIGPROP_NWORDS(cur->size) * sizeof(uint64_t));
+      }
+    }
+    if (cur == aprop) continue;
+    aprop->stats.moves += cur->stats.moves;
+    aprop->stats.props += cur->stats.props;
+    aprop->stats.restarts += cur->stats.restarts;
+    cur->roots   = 0;
+    cur->parents = 0;
+    cur->cone    = 0;
+    bzla_aigprop_delete_aigprop(cur);
+  }
+  aprop->terminate = 0;
+
+  BZLA_DELETEN(mm, started, n);
+  BZLA_DELETEN(mm, threads, n);
+  BZLA_DELETEN(mm, walkers, n);
+  return sat_result;
+}
+#endif
+
 // TODO termination callback?
 int32_t
 bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots)
@@ -929,28 +1225,30 @@ bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots)
   assert(roots);
 
   double start;
-  int32_t i, j, max_steps, sat_result, rootid, childid, move_res;
-  uint32_t nmoves;
+  int32_t i, sat_result, childid;
+  uint32_t j, size;
   BzlaMemMgr *mm;
   BzlaIntHashTable *cache;
   BzlaIntHashTableIterator it;
   BzlaHashTableData *d;
   BzlaAIGPtrStack stack;
-  BzlaIntStack *childparents;
-  BzlaAIG *root, *cur, *child;
+  BzlaAIG *cur, *child;
 
-  start      = bzla_util_time_stamp();
-  sat_result = BZLA_AIGPROP_UNKNOWN;
-  nmoves     = 0;
+  start = bzla_util_time_stamp();
 
   mm           = aprop->mm;
   aprop->roots = roots;
 
-  /* collect parents (for cone computation) */
+  /* collect parents (for cone computation) and the cone of the roots in
+   * topological order (for simulation) */
   BZLA_INIT_STACK(mm, stack);
   cache = bzla_hashint_map_new(mm);
   assert(!aprop->parents);
-  aprop->parents = bzla_hashint_map_new(mm);
+  assert(!aprop->cone);
+  size = BZLA_COUNT_STACK(aprop->amgr->id2aig);
+  BZLA_CNEWN(mm, aprop->parents, size);
+  BZLA_NEW(mm, aprop->cone);
+  BZLA_INIT_STACK(mm, *aprop->cone);
 
   bzla_iter_hashint_init(&it, roots);
   while (bzla_iter_hashint_has_next(&it))
@@ -971,9 +1269,7 @@ bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots)
     {
       bzla_hashint_map_add(cache, cur->id);
       BZLA_PUSH_STACK(stack, cur);
-      BZLA_NEW(mm, childparents);
-      BZLA_INIT_STACK(mm, *childparents);
-      bzla_hashint_map_add(aprop->parents, cur->id)->as_ptr = childparents;
+      BZLA_INIT_STACK(mm, aprop->parents[cur->id]);
       if (bzla_aig_is_and(cur))
       {
         for (i = 0; i < 2; i++)
@@ -987,6 +1283,7 @@ bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots)
     {
       assert(d->as_int == 0);
       d->as_int = 1;
+      BZLA_PUSH_STACK(*aprop->cone, cur->id);
       if (bzla_aig_is_var(cur)) continue;
       for (i = 0; i < 2; i++)
       {
@@ -994,89 +1291,29 @@ bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots)
                 bzla_aig_get_by_id(aprop->amgr, cur->children[i])))
           continue;
         childid = cur->children[i] < 0 ? -cur->children[i] : cur->children[i];
-        assert(bzla_hashint_map_contains(aprop->parents, childid));
-        childparents = bzla_hashint_map_get(aprop->parents, childid)->as_ptr;
-        assert(childparents);
-        BZLA_PUSH_STACK(*childparents, cur->id);
+        assert((uint32_t) childid < size);
+        BZLA_PUSH_STACK(aprop->parents[childid], cur->id);
       }
     }
   }
   bzla_hashint_map_delete(cache);
   BZLA_RELEASE_STACK(stack);
 
-  /* generate initial model, all inputs are initialized with false */
-  bzla_aigprop_generate_model(aprop, true);
-
-  for (;;)
-  {
-    /* collect unsatisfied roots (kept up-to-date in update_cone) */
-    assert(!aprop->unsatroots);
-    aprop->unsatroots = bzla_hashint_map_new(mm);
-    bzla_iter_hashint_init(&it, roots);
-    while (bzla_iter_hashint_has_next(&it))
-    {
-      rootid = bzla_iter_hashint_next(&it);
-      root   = bzla_aig_get_by_id(aprop->amgr, rootid);
-      if (bzla_aig_is_true(root)) continue;
-      if (bzla_aig_is_false(root)) goto UNSAT;
-      if (bzla_hashint_table_contains(aprop->roots, -rootid)) goto UNSAT;
-      assert(bzla_aigprop_get_assignment_aig(aprop, root));
-      if (!bzla_hashint_map_contains(aprop->unsatroots, rootid)
-          && bzla_aigprop_get_assignment_aig(aprop, root) == -1)
-        bzla_hashint_map_add(aprop->unsatroots, rootid);
-    }
-
-    /* compute initial score */
-    compute_scores(aprop);
-
-    if (!aprop->unsatroots->count) goto SAT;
-
-    for (j = 0, max_steps = BZLA_AIGPROP_MAXSTEPS(aprop->stats.restarts + 1);
-         !aprop->use_restarts || j < max_steps;
-         j++)
-    {
-      move_res = move(aprop, nmoves);
-      if (move_res == -1)
-        goto UNSAT;
-      else if (move_res == 0)
-        goto UNKNOWN;
-      assert(move_res == 1);
-      nmoves += 1;
-      if (!aprop->unsatroots->count) goto SAT;
-    }
+#ifdef BZLA_HAVE_PTHREADS
+  if (aprop->nthreads > 1)
+    sat_result = search_parallel(aprop);
+  else
+#endif
+    sat_result = search(aprop);
 
-    /* restart */
-    bzla_aigprop_generate_model(aprop, true);
-    bzla_hashint_map_delete(aprop->score);
-    aprop->score = 0;
-    bzla_hashint_map_delete(aprop->unsatroots);
-    aprop->unsatroots = 0;
-    aprop->stats.restarts += 1;
-  }
-SAT:
-  sat_result = BZLA_AIGPROP_SAT;
-  goto DONE;
-UNSAT:
-  sat_result = BZLA_AIGPROP_UNSAT;
-  goto DONE;
-UNKNOWN:
-  sat_result = BZLA_AIGPROP_UNKNOWN;
-DONE:
-  bzla_iter_hashint_init(&it, aprop->parents);
-  while (bzla_iter_hashint_has_next(&it))
-  {
-    childparents = bzla_iter_hashint_next_data(&it)->as_ptr;
-    assert(childparents);
-    BZLA_RELEASE_STACK(*childparents);
-    BZLA_DELETE(mm, childparents);
-  }
-  bzla_hashint_map_delete(aprop->parents);
+  for (j = 0; j < BZLA_COUNT_STACK(*aprop->cone); j++)
+    BZLA_RELEASE_STACK(aprop->parents[BZLA_PEEK_STACK(*aprop->cone, j)]);
+  BZLA_DELETEN(mm, aprop->parents, size);
   aprop->parents = 0;
-  if (aprop->unsatroots) bzla_hashint_map_delete(aprop->unsatroots);
-  aprop->unsatroots = 0;
-  aprop->roots      = 0;
-  if (aprop->score) bzla_hashint_map_delete(aprop->score);
-  aprop->score = 0;
+  BZLA_RELEASE_STACK(*aprop->cone);
+  BZLA_DELETE(mm, aprop->cone);
+  aprop->cone  = 0;
+  aprop->roots = 0;
 
   aprop->time.sat += bzla_util_time_stamp() - start;
   return sat_result;
@@ -1102,8 +1339,21 @@ bzla_aigprop_clone_aigprop(BzlaAIGMgr *clone, BzlaAIGProp *aprop)
       bzla_hashint_map_clone(mm, aprop->unsatroots, bzla_clone_data_as_int, 0);
   res->score =
       bzla_hashint_map_clone(mm, aprop->score, bzla_clone_data_as_dbl, 0);
-  res->model =
-      bzla_hashint_map_clone(mm, aprop->model, bzla_clone_data_as_int, 0);
+  if (aprop->model)
+  {
+    BZLA_NEWN(mm, res->model, BZLA_AIGPROP_NWORDS(aprop->size));
+    memcpy(res->model,
+           aprop->model,
+           BZLA_AIGPROP_NWORDS(aprop->size) * sizeof(uint64_t));
+    BZLA_NEWN(mm, res->assigned, BZLA_AIGPROP_NWORDS(aprop->size));
+    memcpy(res->assigned,
+           aprop->assigned,
+           BZLA_AIGPROP_NWORDS(aprop->size) * sizeof(uint64_t));
+  }
+  /* parents and cone only exist during sat */
+  assert(!aprop->parents);
+  assert(!aprop->cone);
+  assert(!aprop->terminate);
   return res;
 }
 
@@ -1113,6 +1363,8 @@ bzla_aigprop_new_aigprop(BzlaAIGMgr *amgr,
                          uint32_t seed,
                          uint32_t use_restarts,
                          uint32_t use_bandit,
+                         uint32_t use_sim,
+                         uint32_t nthreads,
                          uint64_t nprops)
 {
   assert(amgr);
@@ -1129,6 +1381,8 @@ bzla_aigprop_new_aigprop(BzlaAIGMgr *amgr,
   res->seed         = seed;
   res->use_restarts = use_restarts;
   res->use_bandit   = use_bandit;
+  res->use_sim      = use_sim;
+  res->nthreads     = nthreads;
   res->nprops       = nprops;
 
   return res;
@@ -1143,7 +1397,7 @@ bzla_aigprop_delete_aigprop(BzlaAIGProp *aprop)
   bzla_rng_delete(aprop->rng);
   if (aprop->unsatroots) bzla_hashint_map_delete(aprop->unsatroots);
   if (aprop->score) bzla_hashint_map_delete(aprop->score);
-  if (aprop->model) bzla_hashint_map_delete(aprop->model);
+  bzla_aigprop_delete_model(aprop);
   mm = aprop->mm;
   BZLA_DELETE(mm, aprop);
   bzla_mem_mgr_delete(mm);
@@ -26,8 +26,17 @@ struct BzlaAIGProp
   BzlaIntHashTable *roots;
   BzlaIntHashTable *unsatroots;
   BzlaIntHashTable *score;
-  BzlaIntHashTable *model;
-  BzlaIntHashTable *parents;
+  /* The current assignment as dense bit arrays indexed by AIG id, i.e.,
+   * bit 'id' of 'model' holds the value of AIG 'id' if bit 'id' of
+   * 'assigned' is set. Both cover all AIG ids below 'size'. */
+  uint64_t *model;
+  uint64_t *assigned;
+  uint32_t size;
+  /* The parents of each AIG in the cone of the roots (indexed by AIG id)
+   * and the ids of all AIGs in the cone of the roots in topological order.
+   * Only valid during sat, shared with (not owned by) walkers. */
+  BzlaIntStack *parents;
+  BzlaIntStack *cone;
   BzlaMemMgr *mm;
 
   BzlaRNG *rng;
@@ -36,8 +45,15 @@ struct BzlaAIGProp
   uint32_t seed;
   uint32_t use_restarts;
   uint32_t use_bandit;
+  uint32_t use_sim;
+  uint32_t nthreads;
   uint64_t nprops;
 
+  /* Set by the first walker that determines a result (0 if not running as
+   * one of several parallel walkers). Shared between threads, hence only
+   * accessed atomically. */
+  bool *terminate;
+
   struct
   {
     uint32_t moves;
@@ -62,12 +78,18 @@ BzlaAIGProp *bzla_aigprop_new_aigprop(BzlaAIGMgr *amgr,
                                       uint32_t seed,
                                       uint32_t use_restarts,
                                       uint32_t use_bandit,
+                                      uint32_t use_sim,
+                                      uint32_t nthreads,
                                       uint64_t nprops);
 
 BzlaAIGProp *bzla_aigprop_clone_aigprop(BzlaAIGMgr *clone, BzlaAIGProp *aprop);
 void bzla_aigprop_delete_aigprop(BzlaAIGProp *aprop);
 
+bool bzla_aigprop_has_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig);
 int32_t bzla_aigprop_get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig);
+
+void bzla_aigprop_init_model(BzlaAIGProp *aprop);
+void bzla_aigprop_delete_model(BzlaAIGProp *aprop);
 void bzla_aigprop_generate_model(BzlaAIGProp *aprop, bool reset);
 
 int32_t bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots);
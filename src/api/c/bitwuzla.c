@@ -81,27 +81,34 @@ struct BitwuzlaSort
 
 static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_AIGPROP_NPROPS]          = BZLA_OPT_AIGPROP_NPROPS,
+    [BITWUZLA_OPT_AIGPROP_THREADS]         = BZLA_OPT_AIGPROP_THREADS,
     [BITWUZLA_OPT_AIGPROP_USE_BANDIT]      = BZLA_OPT_AIGPROP_USE_BANDIT,
     [BITWUZLA_OPT_AIGPROP_USE_RESTARTS]    = BZLA_OPT_AIGPROP_USE_RESTARTS,
+    [BITWUZLA_OPT_AIGPROP_USE_SIM]         = BZLA_OPT_AIGPROP_USE_SIM,
     [BITWUZLA_OPT_CHECK_MODEL]             = BZLA_OPT_CHECK_MODEL,
     [BITWUZLA_OPT_CHECK_UNCONSTRAINED]     = BZLA_OPT_CHECK_UNCONSTRAINED,
     [BITWUZLA_OPT_CHECK_UNSAT_ASSUMPTIONS] = BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
     [BITWUZLA_OPT_DECLSORT_BV_WIDTH]       = BZLA_OPT_DECLSORT_BV_WIDTH,
     [BITWUZLA_OPT_ENGINE]                  = BZLA_OPT_ENGINE,
     [BITWUZLA_OPT_EXIT_CODES]              = BZLA_OPT_EXIT_CODES,
+    [BITWUZLA_OPT_FUN_BETA_CACHE_SIZE]     = BZLA_OPT_FUN_BETA_CACHE_SIZE,
     [BITWUZLA_OPT_FUN_DUAL_PROP]           = BZLA_OPT_FUN_DUAL_PROP,
     [BITWUZLA_OPT_FUN_DUAL_PROP_QSORT]     = BZLA_OPT_FUN_DUAL_PROP_QSORT,
     [BITWUZLA_OPT_FUN_EAGER_LEMMAS]        = BZLA_OPT_FUN_EAGER_LEMMAS,
     [BITWUZLA_OPT_FUN_JUST]                = BZLA_OPT_FUN_JUST,
     [BITWUZLA_OPT_FUN_JUST_HEURISTIC]      = BZLA_OPT_FUN_JUST_HEURISTIC,
+    [BITWUZLA_OPT_FUN_LAZY_EXT]            = BZLA_OPT_FUN_LAZY_EXT,
     [BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BITWUZLA_OPT_FUN_PREPROP]             = BZLA_OPT_FUN_PREPROP,
     [BITWUZLA_OPT_FUN_PRESLS]              = BZLA_OPT_FUN_PRESLS,
+    [BITWUZLA_OPT_FUN_PROP_THREADS]        = BZLA_OPT_FUN_PROP_THREADS,
     [BITWUZLA_OPT_FUN_STORE_LAMBDAS]       = BZLA_OPT_FUN_STORE_LAMBDAS,
+    [BITWUZLA_OPT_FUN_WEAK_EQ_PATHS]       = BZLA_OPT_FUN_WEAK_EQ_PATHS,
     [BITWUZLA_OPT_INCREMENTAL]             = BZLA_OPT_INCREMENTAL,
     [BITWUZLA_OPT_INPUT_FORMAT]            = BZLA_OPT_INPUT_FORMAT,
     [BITWUZLA_OPT_LOGLEVEL]                = BZLA_OPT_LOGLEVEL,
     [BITWUZLA_OPT_LS_SHARE_SAT]            = BZLA_OPT_LS_SHARE_SAT,
+    [BITWUZLA_OPT_LS_WARM_START]           = BZLA_OPT_LS_WARM_START,
     [BITWUZLA_OPT_OUTPUT_FORMAT]           = BZLA_OPT_OUTPUT_FORMAT,
     [BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BITWUZLA_OPT_PARSE_INTERACTIVE]       = BZLA_OPT_PARSE_INTERACTIVE,
@@ -124,6 +131,8 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_PROP_ASHR]           = BZLA_OPT_PROP_ASHR,
     [BITWUZLA_OPT_PROP_CONST_BITS]     = BZLA_OPT_PROP_CONST_BITS,
     [BITWUZLA_OPT_PROP_CONST_DOMAINS]  = BZLA_OPT_PROP_CONST_DOMAINS,
+    [BITWUZLA_OPT_PROP_CONST_DOMAINS_LIMIT] =
+        BZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
     [BITWUZLA_OPT_PROP_ENTAILED]       = BZLA_OPT_PROP_ENTAILED,
     [BITWUZLA_OPT_PROP_FLIP_COND_CONST_DELTA] =
         BZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
@@ -134,6 +143,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_PROP_NPROPS]              = BZLA_OPT_PROP_NPROPS,
     [BITWUZLA_OPT_PROP_NUPDATES]            = BZLA_OPT_PROP_NUPDATES,
     [BITWUZLA_OPT_PROP_PATH_SEL]            = BZLA_OPT_PROP_PATH_SEL,
+    [BITWUZLA_OPT_PROP_PORTFOLIO]           = BZLA_OPT_PROP_PORTFOLIO,
     [BITWUZLA_OPT_PROP_PROB_AND_FLIP]       = BZLA_OPT_PROP_PROB_AND_FLIP,
     [BITWUZLA_OPT_PROP_PROB_EQ_FLIP]        = BZLA_OPT_PROP_PROB_EQ_FLIP,
     [BITWUZLA_OPT_PROP_PROB_FALLBACK_RANDOM_VALUE] =
@@ -150,6 +160,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_PROP_USE_BANDIT]          = BZLA_OPT_PROP_USE_BANDIT,
     [BITWUZLA_OPT_PROP_USE_INV_LT_CONCAT]   = BZLA_OPT_PROP_USE_INV_LT_CONCAT,
     [BITWUZLA_OPT_PROP_USE_RESTARTS]        = BZLA_OPT_PROP_USE_RESTARTS,
+    [BITWUZLA_OPT_PROP_VALUE_CACHE]         = BZLA_OPT_PROP_VALUE_CACHE,
     [BITWUZLA_OPT_PROP_XOR]                 = BZLA_OPT_PROP_XOR,
     [BITWUZLA_OPT_QUANT_CER]                = BZLA_OPT_QUANT_CER,
     [BITWUZLA_OPT_QUANT_DER]                = BZLA_OPT_QUANT_DER,
@@ -172,8 +183,15 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_SAT_ENGINE]               = BZLA_OPT_SAT_ENGINE,
     [BITWUZLA_OPT_SAT_ENGINE_CADICAL_FREEZE] =
         BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE,
+    [BITWUZLA_OPT_SAT_ENGINE_CALL_STATS] = BZLA_OPT_SAT_ENGINE_CALL_STATS,
+    [BITWUZLA_OPT_SAT_ENGINE_COMPACT]    = BZLA_OPT_SAT_ENGINE_COMPACT,
+    [BITWUZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES] =
+        BZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES,
+    [BITWUZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES] =
+        BZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES,
     [BITWUZLA_OPT_SAT_ENGINE_LGL_FORK]     = BZLA_OPT_SAT_ENGINE_LGL_FORK,
     [BITWUZLA_OPT_SAT_ENGINE_N_THREADS]    = BZLA_OPT_SAT_ENGINE_N_THREADS,
+    [BITWUZLA_OPT_SAT_ENGINE_PHASES]       = BZLA_OPT_SAT_ENGINE_PHASES,
     [BITWUZLA_OPT_SEED]                    = BZLA_OPT_SEED,
     [BITWUZLA_OPT_SLS_JUST]                = BZLA_OPT_SLS_JUST,
     [BITWUZLA_OPT_SLS_MOVE_GW]             = BZLA_OPT_SLS_MOVE_GW,
@@ -190,6 +208,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_SLS_NFLIPS]              = BZLA_OPT_SLS_NFLIPS,
     [BITWUZLA_OPT_SLS_PROB_MOVE_RAND_WALK] = BZLA_OPT_SLS_PROB_MOVE_RAND_WALK,
     [BITWUZLA_OPT_SLS_STRATEGY]            = BZLA_OPT_SLS_STRATEGY,
+    [BITWUZLA_OPT_SLS_THREADS]             = BZLA_OPT_SLS_THREADS,
     [BITWUZLA_OPT_SLS_USE_BANDIT]          = BZLA_OPT_SLS_USE_BANDIT,
     [BITWUZLA_OPT_SLS_USE_RESTARTS]        = BZLA_OPT_SLS_USE_RESTARTS,
     [BITWUZLA_OPT_SMT_COMP_MODE]           = BZLA_OPT_SMT_COMP_MODE,
@@ -198,27 +217,34 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
 
 static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_AIGPROP_NPROPS]          = BITWUZLA_OPT_AIGPROP_NPROPS,
+    [BZLA_OPT_AIGPROP_THREADS]         = BITWUZLA_OPT_AIGPROP_THREADS,
     [BZLA_OPT_AIGPROP_USE_BANDIT]      = BITWUZLA_OPT_AIGPROP_USE_BANDIT,
     [BZLA_OPT_AIGPROP_USE_RESTARTS]    = BITWUZLA_OPT_AIGPROP_USE_RESTARTS,
+    [BZLA_OPT_AIGPROP_USE_SIM]         = BITWUZLA_OPT_AIGPROP_USE_SIM,
     [BZLA_OPT_CHECK_MODEL]             = BITWUZLA_OPT_CHECK_MODEL,
     [BZLA_OPT_CHECK_UNCONSTRAINED]     = BITWUZLA_OPT_CHECK_UNCONSTRAINED,
     [BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS] = BITWUZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
     [BZLA_OPT_DECLSORT_BV_WIDTH]       = BITWUZLA_OPT_DECLSORT_BV_WIDTH,
     [BZLA_OPT_ENGINE]                  = BITWUZLA_OPT_ENGINE,
     [BZLA_OPT_EXIT_CODES]              = BITWUZLA_OPT_EXIT_CODES,
+    [BZLA_OPT_FUN_BETA_CACHE_SIZE]     = BITWUZLA_OPT_FUN_BETA_CACHE_SIZE,
     [BZLA_OPT_FUN_DUAL_PROP]           = BITWUZLA_OPT_FUN_DUAL_PROP,
     [BZLA_OPT_FUN_DUAL_PROP_QSORT]     = BITWUZLA_OPT_FUN_DUAL_PROP_QSORT,
     [BZLA_OPT_FUN_EAGER_LEMMAS]        = BITWUZLA_OPT_FUN_EAGER_LEMMAS,
     [BZLA_OPT_FUN_JUST]                = BITWUZLA_OPT_FUN_JUST,
     [BZLA_OPT_FUN_JUST_HEURISTIC]      = BITWUZLA_OPT_FUN_JUST_HEURISTIC,
+    [BZLA_OPT_FUN_LAZY_EXT]            = BITWUZLA_OPT_FUN_LAZY_EXT,
     [BZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BZLA_OPT_FUN_PREPROP]             = BITWUZLA_OPT_FUN_PREPROP,
     [BZLA_OPT_FUN_PRESLS]              = BITWUZLA_OPT_FUN_PRESLS,
+    [BZLA_OPT_FUN_PROP_THREADS]        = BITWUZLA_OPT_FUN_PROP_THREADS,
     [BZLA_OPT_FUN_STORE_LAMBDAS]       = BITWUZLA_OPT_FUN_STORE_LAMBDAS,
+    [BZLA_OPT_FUN_WEAK_EQ_PATHS]       = BITWUZLA_OPT_FUN_WEAK_EQ_PATHS,
     [BZLA_OPT_INCREMENTAL]             = BITWUZLA_OPT_INCREMENTAL,
     [BZLA_OPT_INPUT_FORMAT]            = BITWUZLA_OPT_INPUT_FORMAT,
     [BZLA_OPT_LOGLEVEL]                = BITWUZLA_OPT_LOGLEVEL,
     [BZLA_OPT_LS_SHARE_SAT]            = BITWUZLA_OPT_LS_SHARE_SAT,
+    [BZLA_OPT_LS_WARM_START]           = BITWUZLA_OPT_LS_WARM_START,
     [BZLA_OPT_OUTPUT_FORMAT]           = BITWUZLA_OPT_OUTPUT_FORMAT,
     [BZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BZLA_OPT_PARSE_INTERACTIVE]       = BITWUZLA_OPT_PARSE_INTERACTIVE,
@@ -240,6 +266,8 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PRODUCE_UNSAT_CORES] = BITWUZLA_OPT_PRODUCE_UNSAT_CORES,
     [BZLA_OPT_PROP_CONST_BITS]     = BITWUZLA_OPT_PROP_CONST_BITS,
     [BZLA_OPT_PROP_CONST_DOMAINS]  = BITWUZLA_OPT_PROP_CONST_DOMAINS,
+    [BZLA_OPT_PROP_CONST_DOMAINS_LIMIT] =
+        BITWUZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
     [BZLA_OPT_PROP_ENTAILED]       = BITWUZLA_OPT_PROP_ENTAILED,
     [BZLA_OPT_PROP_FLIP_COND_CONST_DELTA] =
         BITWUZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
@@ -250,6 +278,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PROP_NPROPS]              = BITWUZLA_OPT_PROP_NPROPS,
     [BZLA_OPT_PROP_NUPDATES]            = BITWUZLA_OPT_PROP_NUPDATES,
     [BZLA_OPT_PROP_PATH_SEL]            = BITWUZLA_OPT_PROP_PATH_SEL,
+    [BZLA_OPT_PROP_PORTFOLIO]           = BITWUZLA_OPT_PROP_PORTFOLIO,
     [BZLA_OPT_PROP_PROB_AND_FLIP]       = BITWUZLA_OPT_PROP_PROB_AND_FLIP,
     [BZLA_OPT_PROP_PROB_EQ_FLIP]        = BITWUZLA_OPT_PROP_PROB_EQ_FLIP,
     [BZLA_OPT_PROP_PROB_FALLBACK_RANDOM_VALUE] =
@@ -267,6 +296,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PROP_USE_BANDIT]          = BITWUZLA_OPT_PROP_USE_BANDIT,
     [BZLA_OPT_PROP_USE_INV_LT_CONCAT]   = BITWUZLA_OPT_PROP_USE_INV_LT_CONCAT,
     [BZLA_OPT_PROP_USE_RESTARTS]        = BITWUZLA_OPT_PROP_USE_RESTARTS,
+    [BZLA_OPT_PROP_VALUE_CACHE]         = BITWUZLA_OPT_PROP_VALUE_CACHE,
     [BZLA_OPT_PROP_XOR]                 = BITWUZLA_OPT_PROP_XOR,
     [BZLA_OPT_QUANT_CER]                = BITWUZLA_OPT_QUANT_CER,
     [BZLA_OPT_QUANT_DER]                = BITWUZLA_OPT_QUANT_DER,
@@ -289,8 +319,15 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_SAT_ENGINE]               = BITWUZLA_OPT_SAT_ENGINE,
     [BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE] =
         BITWUZLA_OPT_SAT_ENGINE_CADICAL_FREEZE,
+    [BZLA_OPT_SAT_ENGINE_CALL_STATS] = BITWUZLA_OPT_SAT_ENGINE_CALL_STATS,
+    [BZLA_OPT_SAT_ENGINE_COMPACT]    = BITWUZLA_OPT_SAT_ENGINE_COMPACT,
+    [BZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES] =
+        BITWUZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES,
+    [BZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES] =
+        BITWUZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES,
     [BZLA_OPT_SAT_ENGINE_LGL_FORK]     = BITWUZLA_OPT_SAT_ENGINE_LGL_FORK,
     [BZLA_OPT_SAT_ENGINE_N_THREADS]    = BITWUZLA_OPT_SAT_ENGINE_N_THREADS,
+    [BZLA_OPT_SAT_ENGINE_PHASES]       = BITWUZLA_OPT_SAT_ENGINE_PHASES,
     [BZLA_OPT_SEED]                    = BITWUZLA_OPT_SEED,
     [BZLA_OPT_SLS_JUST]                = BITWUZLA_OPT_SLS_JUST,
     [BZLA_OPT_SLS_MOVE_GW]             = BITWUZLA_OPT_SLS_MOVE_GW,
@@ -307,6 +344,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_SLS_NFLIPS]              = BITWUZLA_OPT_SLS_NFLIPS,
     [BZLA_OPT_SLS_PROB_MOVE_RAND_WALK] = BITWUZLA_OPT_SLS_PROB_MOVE_RAND_WALK,
     [BZLA_OPT_SLS_STRATEGY]            = BITWUZLA_OPT_SLS_STRATEGY,
+    [BZLA_OPT_SLS_THREADS]             = BITWUZLA_OPT_SLS_THREADS,
     [BZLA_OPT_SLS_USE_BANDIT]          = BITWUZLA_OPT_SLS_USE_BANDIT,
     [BZLA_OPT_SLS_USE_RESTARTS]        = BITWUZLA_OPT_SLS_USE_RESTARTS,
     [BZLA_OPT_SMT_COMP_MODE]           = BITWUZLA_OPT_SMT_COMP_MODE,
@@ -1200,6 +1238,9 @@ bitwuzla_set_option(Bitwuzla *bitwuzla, BitwuzlaOption option, uint32_t value)
 
   BZLA_CHECK_OPTION(bzla, opt);
   BZLA_CHECK_OPTION_VALUE(bzla, opt, value);
+  BZLA_ABORT(bzla_opt_is_str_option(bzla, opt),
+             "option expects a string value, use bitwuzla_set_option_str "
+             "instead.");
 
   if (option == BITWUZLA_OPT_INCREMENTAL)
   {
@@ -1336,6 +1377,12 @@ bitwuzla_set_option_str(Bitwuzla *bitwuzla,
   BzlaOption opt = BZLA_IMPORT_BITWUZLA_OPTION(option);
 
   BZLA_CHECK_OPTION(bzla, opt);
+  if (bzla_opt_is_str_option(bzla, opt))
+  {
+    BZLA_CHECK_ARG_NOT_NULL(value);
+    bzla_opt_set_str(bzla, opt, value);
+    return;
+  }
   BZLA_ABORT(
       !bzla_opt_is_enum_option(bzla, opt),
       "option expects an integer value, use bitwuzla_set_option instead.");
@@ -1368,6 +1415,10 @@ bitwuzla_get_option_str(Bitwuzla *bitwuzla,
   BzlaOption opt = BZLA_IMPORT_BITWUZLA_OPTION(option);
 
   BZLA_CHECK_OPTION(bzla, opt);
+  if (bzla_opt_is_str_option(bzla, opt))
+  {
+    return bzla_opt_get_valstr(bzla, opt);
+  }
   BZLA_ABORT(!bzla_opt_is_enum_option(bzla, opt),
              "option is configured with an integer value, use "
              "bitwuzla_get_option instead.");
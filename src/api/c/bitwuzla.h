@@ -595,6 +595,73 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_FUN_STORE_LAMBDAS,
 
+  /*! **Function solver engine:
+   *    Weak equivalence index paths.**
+   *
+   * When propagating a read down a chain of array stores, jump directly to
+   * the next store whose index is assigned the same value as the read
+   * index (or to the base array if there is none) instead of visiting each
+   * store on the path. Store chains are indexed lazily by the current
+   * assignment of their indices.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_WEAK_EQ_PATHS,
+
+  /*! **Function solver engine:
+   *    Memory budget of the partial beta reduction cache.**
+   *
+   * If greater than 0, results of partial beta reductions are cached across
+   * propagation and refinement rounds, up to the given number of MB. Least
+   * recently used results are evicted first. A cached result is only reused
+   * if the conditions evaluated while computing it are still satisfied by
+   * the current model.
+   *
+   * Values:
+   *  * An unsigned integer value (**default**: 0).
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_BETA_CACHE_SIZE,
+
+  /*! **Function solver engine:
+   *    Lazy function inequality witnesses.**
+   *
+   * By default, a witness f(a) != g(a) for every function equality f = g
+   * is added upfront, to be satisfied whenever f = g is false. If enabled,
+   * the witness is only added when f = g is false in the current model and
+   * the model does not already assign f and g different values at some
+   * index.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_LAZY_EXT,
+
+  /*! **Function solver engine:
+   *    Number of threads for conflict detection.**
+   *
+   * If greater than 1, the initial reads of each refinement round are
+   * grouped by the function they read from, and each group is checked for
+   * function congruence conflicts on a pool of the given number of threads
+   * before propagation. Lemmas are generated in a fixed order, so results
+   * do not depend on the number of threads. This option requires pthreads
+   * support, otherwise the groups are checked sequentially.
+   *
+   * Values:
+   *  * An unsigned integer value > 0 (**default**: 1).
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_PROP_THREADS,
+
   /* --------------------- SLS Engine Options (Expert) --------------------- */
 
   /*! **Stochastic local search solver engine:
@@ -835,6 +902,28 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_SLS_STRATEGY,
 
+  /*! **Stochastic local search solver engine:
+   *    Number of threads for evaluating candidate moves.**
+   *
+   * Configure the number of threads used to evaluate the candidate moves of
+   * flip, range and segment moves in parallel. Each thread evaluates moves
+   * on a private copy of the current assignment, the best move is applied
+   * to the shared assignment after all candidates have been evaluated.
+   * Most effective in combination with group-wise moves, which yield more
+   * candidate moves per step. Disabled if a limit on the number of bit flips
+   * is configured.
+   *
+   * Values:
+   *  * An unsigned integer value > 0 (**default**: 1).
+   *
+   * @see
+   *   * BITWUZLA_OPT_SLS_MOVE_GW
+   *   * BITWUZLA_OPT_SLS_NFLIPS
+   *
+   *  @warning This is an expert option to configure the sls solver engine.
+   */
+  BITWUZLA_OPT_SLS_THREADS,
+
   /*! **Stochastic local search solver engine:
    *    Restarts.**
    *
@@ -893,7 +982,10 @@ enum BitwuzlaOption
    *    Domain propagators.**
    *
    * Configure the use of domain propagators for determining constant bits
-   * (instead of bit-blastin to AIG).
+   * (instead of bit-blastin to AIG). Domains are propagated up and down to a
+   * fixed point under the assumption that all assertions hold (see
+   * ::BITWUZLA_OPT_PROP_CONST_DOMAINS_LIMIT), and the initial assignment of
+   * inputs is chosen to match their constant bits.
    *
    * Values:
    *  * **1**: enable
@@ -903,6 +995,21 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_PROP_CONST_DOMAINS,
 
+  /*! **Propagation-based local search solver engine:
+   *    Limit for domain propagation.**
+   *
+   * Configure the number of domain propagator applications used as a limit
+   * for propagating domains to a fixed point (see
+   * ::BITWUZLA_OPT_PROP_CONST_DOMAINS). If the limit is reached, propagation
+   * stops with the domains determined so far. No limit if 0.
+   *
+   * Values:
+   *  * An unsigned integer value (**default**: 0).
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  BITWUZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
+
   /*! **Propagation-based local search solver engine:
    *    Entailed propagations.**
    *
@@ -1027,6 +1134,22 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_PROP_PATH_SEL,
 
+  /*! **Propagation-based local search solver engine:
+   *    Portfolio.**
+   *
+   * Configure the number of prop engine instances to run in parallel. Each
+   * instance works on a clone of the current formula with a different seed
+   * (and path selection mode for every other instance). The first instance
+   * that determines a result terminates all others and, if the result is
+   * sat, provides the model. Only used if compiled with pthreads support.
+   *
+   * Values:
+   *  * An unsigned integer value > 0 (**default**: 1).
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  BITWUZLA_OPT_PROP_PORTFOLIO,
+
   /*! **Propagation-based local search solver engine:
    *    Probability for producing inverse rather than consistent values.**
    *
@@ -1222,6 +1345,23 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_PROP_SKIP_NO_PROGRESS,
 
+  /*! **Propagation-based local search solver engine:
+   *    Value cache.**
+   *
+   * When enabled, inverse and consistent values are cached per node, keyed
+   * by the target value, the values of the other operands and the domain of
+   * the operand to propagate to. On repeated queries, e.g., when the search
+   * cycles, a value is drawn from the cached values instead of computing a
+   * new one.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  BITWUZLA_OPT_PROP_VALUE_CACHE,
+
   /*! **Propagation-based local search solver engine:
    *    Value computation for xor.**
    *
@@ -1251,6 +1391,20 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_AIGPROP_NPROPS,
 
+  /*! **AIG-level propagation-based local search solver engine:
+   *    Number of threads.**
+   *
+   * Configure the number of local search walkers that are run in parallel,
+   * each in its own thread and with a different seed. The first walker that
+   * determines a result terminates all other walkers.
+   *
+   * Values:
+   *  * An unsigned integer value > 0 (**default**: 1).
+   *
+   *  @warning This is an expert option to configure the aigprop solver engine.
+   */
+  BITWUZLA_OPT_AIGPROP_THREADS,
+
   /*! **AIG-level propagation-based local search solver engine:
    *    Bandit scheme.**
    *
@@ -1278,6 +1432,23 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_AIGPROP_USE_RESTARTS,
 
+  /*! **AIG-level propagation-based local search solver engine:
+   *    Simulation-based (re)start assignments.**
+   *
+   * If enabled, the initial assignment and the assignment on every restart
+   * are selected by simulating 64 assignments of the inputs at once (the
+   * all-false assignment and 63 random assignments) and picking the one
+   * that satisfies the most root constraints.
+   * If disabled, all inputs are initially assigned to false.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the aigprop solver engine.
+   */
+  BITWUZLA_OPT_AIGPROP_USE_SIM,
+
   /* ----------------- Quantifier Eninge Options (Expert) ------------------ */
 
   /*! **Quantifier solver engine:
@@ -1479,6 +1650,23 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_LS_SHARE_SAT,
 
+  /*! **Warm-start local search engines in incremental mode.**
+   *
+   * If enabled, the prop and sls engines start from the assignment determined
+   * by the previous satisfiability check (if any) rather than from a fresh
+   * initial assignment, i.e., after new assertions or assumptions have been
+   * added, local search only has to repair violated constraints.
+   *
+   * This option is only effective if incremental solving is enabled.
+   *
+   * Values:
+   *  * **1**: enable [**default**]
+   *  * **0**: disable
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_LS_WARM_START,
+
   /*! **Interactive parsing mode.**
    *
    * Values:
@@ -1490,6 +1678,11 @@ enum BitwuzlaOption
   BITWUZLA_OPT_PARSE_INTERACTIVE,
 
   /*! **Use CaDiCaL's freeze/melt.**
+   *
+   * Before each SAT call in incremental mode, only the CNF variables of
+   * synthesized terms (which may be referenced by future assertions,
+   * assumptions and lemmas) are frozen, all other variables are melted and
+   * may be eliminated by CaDiCaL's inprocessing.
    *
    * Values:
    *  * **1**: enable
@@ -1499,6 +1692,69 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_SAT_ENGINE_CADICAL_FREEZE,
 
+  /*! **Record statistics of each SAT call.**
+   *
+   * Records wall-clock time, the number of clauses, variables and
+   * assumptions added since the previous call, and the number of conflicts,
+   * decisions and propagations (if provided by the SAT solver) of each SAT
+   * call, and prints them as JSON object with the SAT solver statistics.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_SAT_ENGINE_CALL_STATS,
+
+  /*! **Release AIGs after CNF encoding.**
+   *
+   * In non-incremental mode without functions, release the AIGs of all terms
+   * except for inputs before the SAT solver is called, i.e., after the
+   * formula has been encoded to CNF. Model values are computed from the
+   * assignment of the inputs. This reduces memory usage on large instances.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_SAT_ENGINE_COMPACT,
+
+  /*! **Export learned clauses to file.**
+   *
+   * Writes the short clauses learned by the SAT solver to the given file
+   * after each SAT call of the bit-blasting engine. Literals are identified
+   * by the structure of their AIGs, and the bits of symbolic bit-vector
+   * constants by their symbol, such that the clauses can be imported via
+   * BITWUZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES when solving the same or a
+   * similar formula.
+   *
+   * This option is only effective for SAT solvers with support for learned
+   * clause callbacks (CaDiCaL, Lingeling).
+   *
+   * Values:
+   *  * A file name, clause export is disabled if not set [**default**].
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES,
+
+  /*! **Import learned clauses from file.**
+   *
+   * Reads clauses written via BITWUZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES and
+   * adds them to the SAT solver of the bit-blasting engine as soon as all
+   * top-level constraints of the exporting instance are also top-level
+   * constraints of this instance and all literals of a clause are encoded.
+   *
+   * Values:
+   *  * A file name, clause import is disabled if not set [**default**].
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES,
+
   /*! **Lingeling fork mode.**
    *
    * Values:
@@ -1521,6 +1777,24 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_SAT_ENGINE_N_THREADS,
 
+  /*! **Seed SAT solver phases with model values.**
+   *
+   * Sets the preferred phases of the SAT variables of inputs to their values
+   * in the model of the previous satisfiable check, or to their values in the
+   * partial model determined via local search when combined with the
+   * bit-blasting engine in a sequential portfolio.
+   *
+   * This option is only effective for SAT solvers with support for setting
+   * phases (CaDiCaL, Lingeling, MiniSat, PicoSAT).
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_SAT_ENGINE_PHASES,
+
   /*! **Enable SMT-COMP mode.**
    *
    * Parser only option. Only effective when an SMT2 input file is parsed.
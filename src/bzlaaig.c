@@ -11,6 +11,7 @@
 #include "bzlaaig.h"
 
 #include <assert.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -19,6 +20,7 @@
 #include "bzlacore.h"
 #include "bzlasat.h"
 #include "utils/bzlaabort.h"
+#include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
 #include "utils/bzlautil.h"
 
@@ -108,8 +110,13 @@ release_cnf_id_aig_mgr(BzlaAIGMgr *amgr, BzlaAIG *aig)
   assert(amgr->cnfid2aig.start[aig->cnf_id] == aig->id);
   if (amgr->smgr->have_restore) return;
   amgr->cnfid2aig.start[aig->cnf_id] = 0;
-  bzla_sat_mgr_release_cnf_id(amgr->smgr, aig->cnf_id);
+  /* with explicit freezing, only frozen variables can be melted */
+  if (aig->frozen || !bzla_sat_mgr_has_freeze_support(amgr->smgr))
+  {
+    bzla_sat_mgr_release_cnf_id(amgr->smgr, aig->cnf_id);
+  }
   aig->cnf_id = 0;
+  aig->frozen = 0;
 }
 
 static void
@@ -250,19 +257,18 @@ find_and_aig_node(BzlaAIGMgr *amgr, BzlaAIG *left, BzlaAIG *right)
 }
 
 static void
-enlarge_aig_nodes_unique_table(BzlaAIGMgr *amgr)
+resize_aig_nodes_unique_table(BzlaAIGMgr *amgr, uint32_t new_size)
 {
   BzlaMemMgr *mm;
   int32_t *new_chains;
-  uint32_t i, size, new_size;
+  uint32_t i, size;
   uint32_t hash;
   BzlaAIG *temp = 0;
   BzlaAIG *cur  = 0;
   assert(amgr);
-  size     = amgr->table.size;
-  new_size = size << 1;
-  assert(new_size / size == 2);
-  mm = amgr->bzla->mm;
+  assert(bzla_util_is_power_of_2(new_size));
+  size = amgr->table.size;
+  mm   = amgr->bzla->mm;
   BZLA_CNEWN(mm, new_chains, new_size);
   for (i = 0; i < size; i++)
   {
@@ -283,6 +289,17 @@ enlarge_aig_nodes_unique_table(BzlaAIGMgr *amgr)
   amgr->table.chains = new_chains;
 }
 
+static void
+enlarge_aig_nodes_unique_table(BzlaAIGMgr *amgr)
+{
+  uint32_t size, new_size;
+  assert(amgr);
+  size     = amgr->table.size;
+  new_size = size << 1;
+  assert(new_size / size == 2);
+  resize_aig_nodes_unique_table(amgr, new_size);
+}
+
 BzlaAIG *
 bzla_aig_copy(BzlaAIGMgr *amgr, BzlaAIG *aig)
 {
@@ -785,6 +802,12 @@ bzla_aig_mgr_new(Bzla *bzla)
   assert((size_t) BZLA_AIG_FALSE == 0);
   assert((size_t) BZLA_AIG_TRUE == 1);
   BZLA_INIT_STACK(bzla->mm, amgr->cnfid2aig);
+  BZLA_INIT_STACK(bzla->mm, amgr->share.roots);
+  BZLA_INIT_STACK(bzla->mm, amgr->share.learned);
+  BZLA_INIT_STACK(bzla->mm, amgr->share.import_roots);
+  BZLA_INIT_STACK(bzla->mm, amgr->share.import_clauses);
+  BZLA_INIT_STACK(bzla->mm, amgr->share.var_names);
+  BZLA_INIT_STACK(bzla->mm, amgr->freeze.pending);
   return amgr;
 }
 
@@ -866,6 +889,7 @@ bzla_aig_mgr_clone(Bzla *bzla, BzlaAIGMgr *amgr)
   assert(bzla);
   assert(amgr);
 
+  size_t i;
   BzlaAIGMgr *res;
 
   BZLA_CNEW(bzla->mm, res);
@@ -874,14 +898,42 @@ bzla_aig_mgr_clone(Bzla *bzla, BzlaAIGMgr *amgr)
   res->smgr = bzla_sat_mgr_clone(bzla, amgr->smgr);
   /* Note: we do not yet clone aigs here (we need the clone of the aig
    *       manager for that). */
-  res->max_num_aigs     = amgr->max_num_aigs;
-  res->max_num_aig_vars = amgr->max_num_aig_vars;
-  res->cur_num_aigs     = amgr->cur_num_aigs;
-  res->cur_num_aig_vars = amgr->cur_num_aig_vars;
-  res->num_cnf_vars     = amgr->num_cnf_vars;
-  res->num_cnf_clauses  = amgr->num_cnf_clauses;
-  res->num_cnf_literals = amgr->num_cnf_literals;
+  res->max_num_aigs        = amgr->max_num_aigs;
+  res->max_num_aig_vars    = amgr->max_num_aig_vars;
+  res->cur_num_aigs        = amgr->cur_num_aigs;
+  res->cur_num_aig_vars    = amgr->cur_num_aig_vars;
+  res->num_cnf_vars        = amgr->num_cnf_vars;
+  res->num_cnf_clauses     = amgr->num_cnf_clauses;
+  res->num_cnf_literals    = amgr->num_cnf_literals;
+  res->num_frozen_cnf_vars = amgr->num_frozen_cnf_vars;
+  res->num_melted_cnf_vars = amgr->num_melted_cnf_vars;
   clone_aigs(amgr, res);
+  res->freeze.enabled = amgr->freeze.enabled;
+  res->freeze.refs =
+      bzla_hashint_map_clone(bzla->mm, amgr->freeze.refs, 0, 0);
+  BZLA_INIT_STACK(bzla->mm, res->freeze.pending);
+  for (i = 0; i < BZLA_COUNT_STACK(amgr->freeze.pending); i++)
+  {
+    BZLA_PUSH_STACK(res->freeze.pending,
+                    BZLA_PEEK_STACK(amgr->freeze.pending, i));
+  }
+
+  /* Note: clause sharing is not enabled for clones, but the clone holds
+   *       references to the recorded top-level AIGs. */
+  BZLA_INIT_STACK(bzla->mm, res->share.roots);
+  BZLA_INIT_STACK(bzla->mm, res->share.learned);
+  BZLA_INIT_STACK(bzla->mm, res->share.import_roots);
+  BZLA_INIT_STACK(bzla->mm, res->share.import_clauses);
+  BZLA_INIT_STACK(bzla->mm, res->share.var_names);
+  for (i = 0; i < BZLA_COUNT_STACK(amgr->share.roots); i++)
+  {
+    BZLA_PUSH_STACK(res->share.roots, BZLA_PEEK_STACK(amgr->share.roots, i));
+  }
+  for (i = 0; i < BZLA_COUNT_STACK(amgr->share.var_names); i++)
+  {
+    BZLA_PUSH_STACK(res->share.var_names,
+                    BZLA_PEEK_STACK(amgr->share.var_names, i));
+  }
   return res;
 }
 
@@ -890,6 +942,11 @@ bzla_aig_mgr_delete(BzlaAIGMgr *amgr)
 {
   BzlaMemMgr *mm;
   assert(amgr);
+  while (!BZLA_EMPTY_STACK(amgr->share.roots))
+  {
+    bzla_aig_release(
+        amgr, bzla_aig_get_by_id(amgr, BZLA_POP_STACK(amgr->share.roots)));
+  }
   assert(getenv("BZLALEAK") || getenv("BZLALEAKAIG")
          || amgr->table.num_elements == 0);
   mm = amgr->bzla->mm;
@@ -897,6 +954,13 @@ bzla_aig_mgr_delete(BzlaAIGMgr *amgr)
   bzla_sat_mgr_delete(amgr->smgr);
   BZLA_RELEASE_STACK(amgr->id2aig);
   BZLA_RELEASE_STACK(amgr->cnfid2aig);
+  BZLA_RELEASE_STACK(amgr->share.roots);
+  BZLA_RELEASE_STACK(amgr->share.learned);
+  BZLA_RELEASE_STACK(amgr->share.import_roots);
+  BZLA_RELEASE_STACK(amgr->share.import_clauses);
+  BZLA_RELEASE_STACK(amgr->share.var_names);
+  if (amgr->freeze.refs) bzla_hashint_map_delete(amgr->freeze.refs);
+  BZLA_RELEASE_STACK(amgr->freeze.pending);
   BZLA_DELETE(mm, amgr);
 }
 
@@ -1032,6 +1096,12 @@ set_next_id_aig_mgr(BzlaAIGMgr *amgr, BzlaAIG *root)
   amgr->cnfid2aig.start[root->cnf_id] = root->id;
   assert(amgr->cnfid2aig.start[root->cnf_id] == root->id);
   amgr->num_cnf_vars++;
+  /* AIG of a term encoded after its AIG vector was synthesized */
+  if (amgr->freeze.enabled
+      && bzla_hashint_map_contains(amgr->freeze.refs, root->id))
+  {
+    BZLA_PUSH_STACK(amgr->freeze.pending, root->id);
+  }
 }
 
 #ifdef BZLA_EXTRACT_TOP_LEVEL_MULTI_OR
@@ -1333,6 +1403,12 @@ bzla_aig_add_toplevel_to_sat(BzlaAIGMgr *amgr, BzlaAIG *root)
 
   if (!bzla_sat_is_initialized(amgr->smgr)) return;
 
+  if (amgr->share.enabled && !bzla_aig_is_const(root))
+  {
+    BZLA_PUSH_STACK(amgr->share.roots,
+                    bzla_aig_get_id(bzla_aig_copy(amgr, root)));
+  }
+
 #ifdef BZLA_AIG_TO_CNF_TOP_ELIM
   BzlaMemMgr *mm;
   BzlaSATMgr *smgr;
@@ -1451,6 +1527,385 @@ bzla_aig_get_sat_mgr(const BzlaAIGMgr *amgr)
   return amgr ? amgr->smgr : 0;
 }
 
+/*------------------------------------------------------------------------*/
+
+#define BZLA_AIG_SHASH_VAR 0x9e3779b97f4a7c15ull
+#define BZLA_AIG_SHASH_AND 0xc2b2ae3d27d4eb4full
+#define BZLA_AIG_SHASH_TRUE 0x165667b19e3779f9ull
+
+static uint64_t
+mix_shash(uint64_t x)
+{
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ull;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebull;
+  x ^= x >> 31;
+  return x;
+}
+
+/* Hash values 0 (clause terminator) and ~0 (its inverse) are reserved. */
+static uint64_t
+normalize_shash(uint64_t h)
+{
+  return h == 0 || h == ~(uint64_t) 0 ? BZLA_AIG_SHASH_TRUE : h;
+}
+
+static uint64_t
+get_shash(uint64_t *shashes, BzlaAIG *aig)
+{
+  uint64_t h;
+  if (bzla_aig_is_true(aig)) return BZLA_AIG_SHASH_TRUE;
+  if (bzla_aig_is_false(aig)) return ~(uint64_t) BZLA_AIG_SHASH_TRUE;
+  h = shashes[BZLA_REAL_ADDR_AIG(aig)->id];
+  return BZLA_IS_INVERTED_AIG(aig) ? ~h : h;
+}
+
+/* Computes the structural hashes of all AIGs, indexed by AIG id.  AIG
+ * variables are identified by their name hash (see bzla_aig_mgr_set_var_name)
+ * or, if unnamed, by their creation order among unnamed variables, AIG ANDs
+ * by the
+ * (commutative) hash of their children.  Since children are always created
+ * before their parents, a single pass over the id table suffices. */
+static uint64_t *
+compute_shashes(BzlaAIGMgr *amgr)
+{
+  size_t i, n;
+  uint64_t *res, h, h0, h1, nvars, name;
+  BzlaAIG *aig;
+
+  n = BZLA_COUNT_STACK(amgr->id2aig);
+  BZLA_CNEWN(amgr->bzla->mm, res, n);
+
+  for (i = 2, nvars = 0; i < n; i++)
+  {
+    aig = BZLA_PEEK_STACK(amgr->id2aig, i);
+    if (!aig) continue;
+    if (aig->is_var)
+    {
+      name = i < BZLA_COUNT_STACK(amgr->share.var_names)
+                 ? BZLA_PEEK_STACK(amgr->share.var_names, i)
+                 : 0;
+      if (name)
+      {
+        res[i] =
+            normalize_shash(mix_shash(mix_shash(name) ^ BZLA_AIG_SHASH_VAR));
+      }
+      else
+      {
+        res[i] = normalize_shash(mix_shash(BZLA_AIG_SHASH_VAR + nvars++));
+      }
+    }
+    else
+    {
+      h0 = get_shash(res, bzla_aig_get_left_child(amgr, aig));
+      h1 = get_shash(res, bzla_aig_get_right_child(amgr, aig));
+      if (h0 > h1)
+      {
+        h  = h0;
+        h0 = h1;
+        h1 = h;
+      }
+      res[i] =
+          normalize_shash(mix_shash(mix_shash(h0 ^ BZLA_AIG_SHASH_AND) ^ h1));
+    }
+  }
+  return res;
+}
+
+/* Maps a CNF literal to the structural hash of its AIG, 0 if the CNF literal
+ * is not associated with an AIG. */
+static uint64_t
+cnf_lit_to_shash(BzlaAIGMgr *amgr, uint64_t *shashes, int32_t lit)
+{
+  int32_t id;
+  uint64_t h;
+
+  if ((size_t) abs(lit) >= BZLA_COUNT_STACK(amgr->cnfid2aig)) return 0;
+  id = BZLA_PEEK_STACK(amgr->cnfid2aig, abs(lit));
+  if (id <= 0 || !BZLA_PEEK_STACK(amgr->id2aig, id)) return 0;
+  h = shashes[id];
+  return lit < 0 ? ~h : h;
+}
+
+static void
+learn_clause(void *state, int32_t *clause)
+{
+  BzlaAIGMgr *amgr = (BzlaAIGMgr *) state;
+  for (; *clause; clause++) BZLA_PUSH_STACK(amgr->share.learned, *clause);
+  BZLA_PUSH_STACK(amgr->share.learned, 0);
+}
+
+void
+bzla_aig_mgr_enable_clause_sharing(BzlaAIGMgr *amgr, uint32_t max_size)
+{
+  assert(amgr);
+  BZLA_ABORT(bzla_sat_is_initialized(amgr->smgr),
+             "clause sharing must be enabled before initializing the SAT "
+             "solver");
+  amgr->share.enabled = true;
+  if (max_size)
+  {
+    bzla_sat_mgr_set_learn(amgr->smgr, max_size, learn_clause, amgr);
+  }
+}
+
+void
+bzla_aig_mgr_set_var_name(BzlaAIGMgr *amgr, BzlaAIG *var, uint64_t name)
+{
+  assert(amgr);
+  assert(var);
+  assert(!bzla_aig_is_const(var));
+  assert(BZLA_REAL_ADDR_AIG(var)->is_var);
+  assert(name);
+
+  int32_t id;
+
+  id = BZLA_REAL_ADDR_AIG(var)->id;
+  while (BZLA_COUNT_STACK(amgr->share.var_names) <= (size_t) id)
+  {
+    BZLA_PUSH_STACK(amgr->share.var_names, 0);
+  }
+  BZLA_POKE_STACK(amgr->share.var_names, id, name);
+}
+
+void
+bzla_aig_mgr_export_clauses(BzlaAIGMgr *amgr, FILE *file)
+{
+  assert(amgr);
+  assert(file);
+  assert(amgr->share.enabled);
+
+  size_t i, j;
+  int32_t lit;
+  uint64_t *shashes, h;
+  BzlaUInt64Stack clause;
+  BzlaMemMgr *mm;
+
+  mm      = amgr->bzla->mm;
+  shashes = compute_shashes(amgr);
+
+  /* the file is rewritten on every export, count the clauses of this one */
+  amgr->num_exported_clauses = 0;
+  fprintf(file, "c bitwuzla learned clauses\n");
+  for (i = 0; i < BZLA_COUNT_STACK(amgr->share.roots); i++)
+  {
+    h = get_shash(
+        shashes,
+        bzla_aig_get_by_id(amgr, BZLA_PEEK_STACK(amgr->share.roots, i)));
+    fprintf(file, "r %016" PRIx64 "\n", h);
+  }
+
+  BZLA_INIT_STACK(mm, clause);
+  for (i = 0; i < BZLA_COUNT_STACK(amgr->share.learned); i++)
+  {
+    BZLA_RESET_STACK(clause);
+    for (j = i; (lit = BZLA_PEEK_STACK(amgr->share.learned, j)); j++)
+    {
+      if (!(h = cnf_lit_to_shash(amgr, shashes, lit))) break;
+      BZLA_PUSH_STACK(clause, h);
+    }
+    /* skip clauses with literals that do not correspond to an AIG */
+    if (!lit)
+    {
+      fprintf(file, "l");
+      for (j = 0; j < BZLA_COUNT_STACK(clause); j++)
+      {
+        fprintf(file, " %016" PRIx64, BZLA_PEEK_STACK(clause, j));
+      }
+      fprintf(file, " 0\n");
+      amgr->num_exported_clauses++;
+    }
+    while (BZLA_PEEK_STACK(amgr->share.learned, i)) i++;
+  }
+  BZLA_RELEASE_STACK(clause);
+  BZLA_DELETEN(mm, shashes, BZLA_COUNT_STACK(amgr->id2aig));
+}
+
+bool
+bzla_aig_mgr_import_clauses(BzlaAIGMgr *amgr, FILE *file)
+{
+  assert(amgr);
+  assert(file);
+  assert(amgr->share.enabled);
+
+  int32_t ch;
+  uint64_t h;
+
+  while ((ch = getc(file)) != EOF)
+  {
+    switch (ch)
+    {
+      case ' ':
+      case '\t':
+      case '\r':
+      case '\n': break;
+
+      case 'c':
+        while ((ch = getc(file)) != '\n' && ch != EOF)
+          ;
+        break;
+
+      case 'r':
+        if (fscanf(file, "%" SCNx64, &h) != 1) return false;
+        BZLA_PUSH_STACK(amgr->share.import_roots, h);
+        break;
+
+      case 'l':
+        do
+        {
+          if (fscanf(file, "%" SCNx64, &h) != 1) return false;
+          BZLA_PUSH_STACK(amgr->share.import_clauses, h);
+        } while (h);
+        break;
+
+      default: return false;
+    }
+  }
+  amgr->share.import_maxvar = 0;
+  return true;
+}
+
+typedef struct
+{
+  uint64_t shash;
+  int32_t lit;
+} BzlaAIGShashLit;
+
+static int32_t
+cmp_shash_lit(const void *a, const void *b)
+{
+  uint64_t ha = ((const BzlaAIGShashLit *) a)->shash;
+  uint64_t hb = ((const BzlaAIGShashLit *) b)->shash;
+  return ha < hb ? -1 : (ha > hb ? 1 : 0);
+}
+
+static int32_t
+cmp_shash(const void *a, const void *b)
+{
+  uint64_t ha = *(const uint64_t *) a;
+  uint64_t hb = *(const uint64_t *) b;
+  return ha < hb ? -1 : (ha > hb ? 1 : 0);
+}
+
+static int32_t
+find_shash_lit(BzlaAIGShashLit *lits, size_t n, uint64_t h)
+{
+  BzlaAIGShashLit key, *res;
+
+  key.shash = h;
+  res = bsearch(&key, lits, n, sizeof(*lits), cmp_shash_lit);
+  if (res) return res->lit;
+  key.shash = ~h;
+  res = bsearch(&key, lits, n, sizeof(*lits), cmp_shash_lit);
+  if (res) return -res->lit;
+  return 0;
+}
+
+uint32_t
+bzla_aig_mgr_add_imported_clauses(BzlaAIGMgr *amgr)
+{
+  assert(amgr);
+
+  size_t i, j, k, n, nroots, nshashes, n_import;
+  int32_t lit;
+  uint32_t res;
+  uint64_t *shashes, *roots;
+  BzlaAIG *aig;
+  BzlaAIGShashLit *lits;
+  BzlaIntStack clause;
+  BzlaMemMgr *mm;
+
+  if (BZLA_EMPTY_STACK(amgr->share.import_clauses)) return 0;
+  if (!bzla_sat_is_initialized(amgr->smgr)) return 0;
+  /* only retry if new CNF variables were introduced */
+  if (amgr->share.import_maxvar == amgr->smgr->maxvar) return 0;
+  amgr->share.import_maxvar = amgr->smgr->maxvar;
+
+  res      = 0;
+  mm       = amgr->bzla->mm;
+  nshashes = BZLA_COUNT_STACK(amgr->id2aig);
+  shashes  = compute_shashes(amgr);
+
+  /* all exported top-level AIGs must be top-level AIGs here */
+  nroots = BZLA_COUNT_STACK(amgr->share.roots);
+  BZLA_NEWN(mm, roots, nroots ? nroots : 1);
+  for (i = 0; i < nroots; i++)
+  {
+    roots[i] = get_shash(
+        shashes,
+        bzla_aig_get_by_id(amgr, BZLA_PEEK_STACK(amgr->share.roots, i)));
+  }
+  qsort(roots, nroots, sizeof(*roots), cmp_shash);
+  for (i = 0; i < BZLA_COUNT_STACK(amgr->share.import_roots); i++)
+  {
+    if (!bsearch(amgr->share.import_roots.start + i,
+                 roots,
+                 nroots,
+                 sizeof(*roots),
+                 cmp_shash))
+    {
+      goto DONE;
+    }
+  }
+
+  /* map structural hashes to CNF literals of encoded AIGs */
+  BZLA_NEWN(mm, lits, nshashes);
+  for (i = 2, n = 0; i < nshashes; i++)
+  {
+    aig = BZLA_PEEK_STACK(amgr->id2aig, i);
+    if (!aig || aig->cnf_id <= 0) continue;
+    lits[n].shash = shashes[i];
+    lits[n].lit   = aig->cnf_id;
+    n++;
+  }
+  qsort(lits, n, sizeof(*lits), cmp_shash_lit);
+
+  BZLA_INIT_STACK(mm, clause);
+  n_import = BZLA_COUNT_STACK(amgr->share.import_clauses);
+  for (i = 0, k = 0; i < n_import; i = j + 1)
+  {
+    BZLA_RESET_STACK(clause);
+    for (j = i; BZLA_PEEK_STACK(amgr->share.import_clauses, j); j++)
+    {
+      lit = find_shash_lit(
+          lits, n, BZLA_PEEK_STACK(amgr->share.import_clauses, j));
+      if (!lit) break;
+      BZLA_PUSH_STACK(clause, lit);
+    }
+    if (!BZLA_PEEK_STACK(amgr->share.import_clauses, j))
+    {
+      /* all literals matched, add clause */
+      while (!BZLA_EMPTY_STACK(clause))
+      {
+        bzla_sat_add(amgr->smgr, BZLA_POP_STACK(clause));
+      }
+      bzla_sat_add(amgr->smgr, 0);
+      amgr->num_cnf_clauses++;
+      amgr->num_imported_clauses++;
+      res++;
+    }
+    else
+    {
+      /* keep pending clause */
+      while (BZLA_PEEK_STACK(amgr->share.import_clauses, j)) j++;
+      for (; i <= j; i++, k++)
+      {
+        BZLA_POKE_STACK(amgr->share.import_clauses,
+                        k,
+                        BZLA_PEEK_STACK(amgr->share.import_clauses, i));
+      }
+    }
+  }
+  amgr->share.import_clauses.top = amgr->share.import_clauses.start + k;
+  BZLA_RELEASE_STACK(clause);
+  BZLA_DELETEN(mm, lits, nshashes);
+DONE:
+  BZLA_DELETEN(mm, roots, nroots ? nroots : 1);
+  BZLA_DELETEN(mm, shashes, nshashes);
+  return res;
+}
+
 int32_t
 bzla_aig_get_assignment(BzlaAIGMgr *amgr, BzlaAIG *aig)
 {
@@ -1472,6 +1927,143 @@ bzla_aig_get_assignment(BzlaAIGMgr *amgr, BzlaAIG *aig)
   return BZLA_IS_INVERTED_AIG(aig) ? -val : val;
 }
 
+void
+bzla_aig_set_phase(BzlaAIGMgr *amgr, BzlaAIG *aig, int32_t phase)
+{
+  assert(amgr);
+  assert(phase);
+
+  BzlaAIG *real_aig;
+
+  if (bzla_aig_is_const(aig)) return;
+  if (!bzla_sat_mgr_has_phase_support(amgr->smgr)) return;
+
+  real_aig = BZLA_REAL_ADDR_AIG(aig);
+  if (real_aig->cnf_id <= 0) return;
+
+  if (BZLA_IS_INVERTED_AIG(aig)) phase = -phase;
+  bzla_sat_phase(amgr->smgr, phase > 0 ? real_aig->cnf_id : -real_aig->cnf_id);
+}
+
+void
+bzla_aig_mgr_enable_freeze(BzlaAIGMgr *amgr)
+{
+  assert(amgr);
+
+  if (amgr->freeze.enabled) return;
+  if (!bzla_sat_mgr_has_freeze_support(amgr->smgr)) return;
+  amgr->freeze.enabled = true;
+  amgr->freeze.refs    = bzla_hashint_map_new(amgr->bzla->mm);
+}
+
+void
+bzla_aig_mgr_ref_frozen(BzlaAIGMgr *amgr, BzlaAIG **aigs, uint32_t n)
+{
+  assert(amgr);
+  assert(aigs || !n);
+
+  uint32_t i;
+  BzlaAIG *aig;
+  BzlaHashTableData *d;
+
+  if (!amgr->freeze.enabled) return;
+
+  for (i = 0; i < n; i++)
+  {
+    if (bzla_aig_is_const(aigs[i])) continue;
+    aig = BZLA_REAL_ADDR_AIG(aigs[i]);
+    d   = bzla_hashint_map_get(amgr->freeze.refs, aig->id);
+    if (d)
+    {
+      d->as_int += 1;
+      continue;
+    }
+    bzla_hashint_map_add(amgr->freeze.refs, aig->id)->as_int = 1;
+    /* not encoded AIGs are added when encoded (see set_next_id_aig_mgr) */
+    if (aig->cnf_id > 0 && !aig->frozen)
+    {
+      BZLA_PUSH_STACK(amgr->freeze.pending, aig->id);
+    }
+  }
+}
+
+void
+bzla_aig_mgr_unref_frozen(BzlaAIGMgr *amgr, BzlaAIG **aigs, uint32_t n)
+{
+  assert(amgr);
+  assert(aigs || !n);
+
+  uint32_t i;
+  BzlaAIG *aig;
+  BzlaHashTableData *d;
+
+  if (!amgr->freeze.enabled) return;
+
+  for (i = 0; i < n; i++)
+  {
+    if (bzla_aig_is_const(aigs[i])) continue;
+    aig = BZLA_REAL_ADDR_AIG(aigs[i]);
+    d   = bzla_hashint_map_get(amgr->freeze.refs, aig->id);
+    assert(d);
+    assert(d->as_int > 0);
+    d->as_int -= 1;
+    if (d->as_int > 0) continue;
+    bzla_hashint_map_remove(amgr->freeze.refs, aig->id, 0);
+    if (aig->frozen) BZLA_PUSH_STACK(amgr->freeze.pending, aig->id);
+  }
+}
+
+void
+bzla_aig_mgr_update_frozen(BzlaAIGMgr *amgr)
+{
+  assert(amgr);
+
+  size_t i;
+  int32_t id;
+  BzlaAIG *aig;
+
+  if (!amgr->freeze.enabled) return;
+  if (!amgr->smgr->initialized) return;
+
+  /* pending entries may be duplicates or refer to AIGs that have been
+   * deleted in the meantime (and whose ids may have been reused), hence we
+   * decide based on the current state of the AIG */
+  for (i = 0; i < BZLA_COUNT_STACK(amgr->freeze.pending); i++)
+  {
+    id = BZLA_PEEK_STACK(amgr->freeze.pending, i);
+    if ((size_t) id >= BZLA_COUNT_STACK(amgr->id2aig)) continue;
+    aig = BZLA_PEEK_STACK(amgr->id2aig, id);
+    if (!aig || aig->cnf_id <= 0) continue;
+    if (bzla_hashint_map_contains(amgr->freeze.refs, id))
+    {
+      if (aig->frozen) continue;
+      bzla_sat_freeze(amgr->smgr, aig->cnf_id);
+      aig->frozen = 1;
+      amgr->num_frozen_cnf_vars++;
+    }
+    else if (aig->frozen)
+    {
+      bzla_sat_mgr_release_cnf_id(amgr->smgr, aig->cnf_id);
+      aig->frozen = 0;
+      amgr->num_melted_cnf_vars++;
+    }
+  }
+  BZLA_RESET_STACK(amgr->freeze.pending);
+}
+
+void
+bzla_aig_mgr_shrink_unique_table(BzlaAIGMgr *amgr)
+{
+  assert(amgr);
+
+  uint32_t new_size;
+
+  new_size = 1;
+  while (new_size < amgr->table.num_elements) new_size <<= 1;
+  if (new_size >= amgr->table.size) return;
+  resize_aig_nodes_unique_table(amgr, new_size);
+}
+
 int32_t
 bzla_aig_compare(const BzlaAIG *aig0, const BzlaAIG *aig1)
 {
@@ -17,6 +17,7 @@
 #include "bzlaopt.h"
 #include "bzlasat.h"
 #include "bzlatypes.h"
+#include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
 #include "utils/bzlamem.h"
 #include "utils/bzlastack.h"
@@ -31,6 +32,7 @@ struct BzlaAIG
   int32_t next; /* next AIG id for unique table */
   uint8_t mark : 2;
   uint8_t is_var : 1; /* is it an AIG variable or an AND? */
+  uint8_t frozen : 1; /* is its CNF variable frozen explicitly? */
   uint32_t local;
   int32_t children[]; /* only allocated for AIG AND */
 };
@@ -59,12 +61,36 @@ struct BzlaAIGMgr
   uint_least64_t cur_num_aigs;     /* current number of ANDs */
   uint_least64_t cur_num_aig_vars; /* current number of AIG variables */
 
+  /* learned clause export/import (see bzla_aig_mgr_enable_clause_sharing) */
+  struct
+  {
+    bool enabled;
+    BzlaIntStack roots;   /* ids of (referenced) top-level AIGs */
+    BzlaIntStack learned; /* learned clauses, 0-terminated CNF literals */
+    BzlaUInt64Stack import_roots;   /* structural hashes of imported roots */
+    BzlaUInt64Stack import_clauses; /* imported clauses, 0-terminated */
+    BzlaUInt64Stack var_names; /* AIG id to variable name hash, 0 if unset */
+    int32_t import_maxvar; /* max. CNF id at last import attempt */
+  } share;
+
+  /* explicit freezing of CNF variables (see bzla_aig_mgr_enable_freeze) */
+  struct
+  {
+    bool enabled;
+    BzlaIntHashTable *refs; /* AIG id to number of referencing AIG vectors */
+    BzlaIntStack pending;   /* ids of AIGs that may have to be (un)frozen */
+  } freeze;
+
   /* statistics */
   uint_least64_t max_num_aigs;
   uint_least64_t max_num_aig_vars;
   uint_least64_t num_cnf_vars;
   uint_least64_t num_cnf_clauses;
   uint_least64_t num_cnf_literals;
+  uint_least64_t num_exported_clauses;
+  uint_least64_t num_imported_clauses;
+  uint_least64_t num_frozen_cnf_vars;
+  uint_least64_t num_melted_cnf_vars;
 };
 
 typedef struct BzlaAIGMgr BzlaAIGMgr;
@@ -169,6 +195,40 @@ void bzla_aig_mgr_delete(BzlaAIGMgr *amgr);
 
 BzlaSATMgr *bzla_aig_get_sat_mgr(const BzlaAIGMgr *amgr);
 
+/* Enables recording of top-level AIGs and learned clauses of size <= max_size
+ * for bzla_aig_mgr_export_clauses and bzla_aig_mgr_import_clauses.
+ * Must be called before the SAT solver is initialized.
+ */
+void bzla_aig_mgr_enable_clause_sharing(BzlaAIGMgr *amgr, uint32_t max_size);
+
+/* Sets the name hash of AIG variable 'var', which identifies the variable
+ * for bzla_aig_mgr_export_clauses and bzla_aig_mgr_import_clauses independent
+ * of its creation order.  'name' must not be 0.
+ */
+void bzla_aig_mgr_set_var_name(BzlaAIGMgr *amgr, BzlaAIG *var, uint64_t name);
+
+/* Writes the recorded learned clauses to given file.  Literals are identified
+ * by the structural hash of the corresponding AIG (AIG variables are
+ * identified by their name hash if set via bzla_aig_mgr_set_var_name, and by
+ * their creation order among unnamed variables otherwise).  The file further
+ * contains the structural hashes of all top-level AIGs, which are required to
+ * be top-level AIGs when the clauses are imported again.
+ */
+void bzla_aig_mgr_export_clauses(BzlaAIGMgr *amgr, FILE *file);
+
+/* Reads clauses written via bzla_aig_mgr_export_clauses.  The clauses are
+ * added to the SAT solver via bzla_aig_mgr_add_imported_clauses as soon as
+ * all exported top-level AIGs are also top-level AIGs of this manager and
+ * all literals of a clause match an encoded AIG.
+ * Returns false if the file could not be parsed.
+ */
+bool bzla_aig_mgr_import_clauses(BzlaAIGMgr *amgr, FILE *file);
+
+/* Adds pending imported clauses to the SAT solver (see
+ * bzla_aig_mgr_import_clauses).  Returns the number of added clauses.
+ */
+uint32_t bzla_aig_mgr_add_imported_clauses(BzlaAIGMgr *amgr);
+
 /* Variable representing 1 bit. */
 BzlaAIG *bzla_aig_var(BzlaAIGMgr *amgr);
 
@@ -218,6 +278,43 @@ void bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *aig);
  */
 int32_t bzla_aig_get_assignment(BzlaAIGMgr *amgr, BzlaAIG *aig);
 
+/* Sets the preferred phase of an encoded AIG in the SAT solver, where
+ * phase > 0 means true and phase < 0 means false.  Does nothing for constant
+ * AIGs, AIGs that are not yet encoded to SAT, and if the SAT solver does not
+ * support setting phases.
+ */
+void bzla_aig_set_phase(BzlaAIGMgr *amgr, BzlaAIG *aig, int32_t phase);
+
+/* Enables tracking of the AIGs that are referenced by the AIG vectors of
+ * terms (see bzla_aig_mgr_ref_frozen), which are the AIGs that may be
+ * referenced by future clauses or assumptions.  Does nothing if the SAT
+ * solver does not support freezing variables explicitly (see
+ * bzla_sat_mgr_has_freeze_support).
+ */
+void bzla_aig_mgr_enable_freeze(BzlaAIGMgr *amgr);
+
+/* Records that the given AIGs are referenced by the AIG vector of a term.
+ * Does nothing if freeze tracking is not enabled.
+ */
+void bzla_aig_mgr_ref_frozen(BzlaAIGMgr *amgr, BzlaAIG **aigs, uint32_t n);
+
+/* Records that the given AIGs are not referenced by the AIG vector of a term
+ * anymore.  Does nothing if freeze tracking is not enabled.
+ */
+void bzla_aig_mgr_unref_frozen(BzlaAIGMgr *amgr, BzlaAIG **aigs, uint32_t n);
+
+/* Freezes the CNF variables of encoded AIGs that became referenced by terms
+ * and melts the CNF variables of frozen AIGs that are not referenced by terms
+ * anymore since the last update.  Only AIGs whose reference count or CNF
+ * encoding changed since the last update are visited.
+ */
+void bzla_aig_mgr_update_frozen(BzlaAIGMgr *amgr);
+
+/* Shrinks the unique table to the smallest size that can hold all current
+ * AIG ANDs, e.g., after most AIGs have been released.
+ */
+void bzla_aig_mgr_shrink_unique_table(BzlaAIGMgr *amgr);
+
 /* Orders AIGs (actually assume left child of an AND node is smaller
  * than right child
  */
@@ -577,6 +577,262 @@ beta_reduce(Bzla *bzla,
   return result;
 }
 
+/*------------------------------------------------------------------------*/
+
+static uint32_t
+hash_beta_cache_entry(BzlaBetaCacheEntry *entry)
+{
+  uint32_t i, res;
+
+  res = entry->lambda->id;
+  for (i = 0; i < entry->num_args; i++)
+    res = res * 333444569u + (uint32_t) bzla_node_get_id(entry->args[i]);
+  return res;
+}
+
+static int32_t
+compare_beta_cache_entry(BzlaBetaCacheEntry *e0, BzlaBetaCacheEntry *e1)
+{
+  uint32_t i;
+
+  if (e0->lambda != e1->lambda || e0->num_args != e1->num_args) return 1;
+  for (i = 0; i < e0->num_args; i++)
+  {
+    if (e0->args[i] != e1->args[i]) return 1;
+  }
+  return 0;
+}
+
+BzlaBetaCache *
+bzla_beta_cache_new(Bzla *bzla, size_t max_bytes)
+{
+  assert(bzla);
+
+  BzlaBetaCache *res;
+
+  BZLA_CNEW(bzla->mm, res);
+  res->bzla      = bzla;
+  res->max_bytes = max_bytes;
+  res->table     = bzla_hashptr_table_new(bzla->mm,
+                                      (BzlaHashPtr) hash_beta_cache_entry,
+                                      (BzlaCmpPtr) compare_beta_cache_entry);
+  return res;
+}
+
+static void
+unlink_beta_cache_entry(BzlaBetaCache *cache, BzlaBetaCacheEntry *entry)
+{
+  if (entry->prev)
+    entry->prev->next = entry->next;
+  else
+    cache->head = entry->next;
+  if (entry->next)
+    entry->next->prev = entry->prev;
+  else
+    cache->tail = entry->prev;
+  entry->prev = 0;
+  entry->next = 0;
+}
+
+static void
+link_beta_cache_entry(BzlaBetaCache *cache, BzlaBetaCacheEntry *entry)
+{
+  entry->prev = 0;
+  entry->next = cache->head;
+  if (cache->head)
+    cache->head->prev = entry;
+  else
+    cache->tail = entry;
+  cache->head = entry;
+}
+
+static void
+remove_beta_cache_entry(BzlaBetaCache *cache, BzlaBetaCacheEntry *entry)
+{
+  uint32_t i;
+  Bzla *bzla;
+
+  bzla = cache->bzla;
+  unlink_beta_cache_entry(cache, entry);
+  bzla_hashptr_table_remove(cache->table, entry, 0, 0);
+  cache->bytes -= entry->bytes;
+
+  bzla_node_release(bzla, entry->lambda);
+  bzla_node_release(bzla, entry->result);
+  /* 'conds' is allocated as part of 'args' */
+  for (i = 0; i < entry->num_args + entry->num_conds; i++)
+    bzla_node_release(bzla, entry->args[i]);
+  BZLA_DELETEN(bzla->mm, entry->args, entry->num_args + entry->num_conds);
+  BZLA_DELETE(bzla->mm, entry);
+}
+
+void
+bzla_beta_cache_delete(BzlaBetaCache *cache)
+{
+  assert(cache);
+
+  Bzla *bzla;
+
+  bzla = cache->bzla;
+  while (cache->head) remove_beta_cache_entry(cache, cache->head);
+  assert(cache->bytes == 0);
+  bzla_hashptr_table_delete(cache->table);
+  BZLA_DELETE(bzla->mm, cache);
+}
+
+/* Returns the beta cache of the function solver, which is created on demand
+ * if enabled. */
+static BzlaBetaCache *
+get_beta_cache(Bzla *bzla)
+{
+  uint32_t size;
+  BzlaFunSolver *slv;
+
+  if (!bzla->slv || bzla->slv->kind != BZLA_FUN_SOLVER_KIND) return 0;
+
+  size = bzla_opt_get(bzla, BZLA_OPT_FUN_BETA_CACHE_SIZE);
+  if (!size) return 0;
+
+  slv = BZLA_FUN_SOLVER(bzla);
+  if (!slv->beta_cache)
+    slv->beta_cache = bzla_beta_cache_new(bzla, (size_t) size * 1024 * 1024);
+  return slv->beta_cache;
+}
+
+/* Collect the arguments currently assigned to the parameters of the curried
+ * lambda chain starting at 'lambda'. Returns false if a parameter is not
+ * assigned. */
+static bool
+collect_assigned_args(BzlaNode *lambda, BzlaNodePtrStack *args)
+{
+  BzlaNode *cur, *arg;
+
+  cur = lambda;
+  while (bzla_node_is_lambda(cur))
+  {
+    arg = bzla_node_param_get_assigned_exp(cur->e[0]);
+    if (!arg) return false;
+    BZLA_PUSH_STACK(*args, arg);
+    cur = bzla_node_real_addr(cur->e[1]);
+  }
+  return true;
+}
+
+/* Returns the cached result of the partial beta reduction of 'key->lambda'
+ * under assignment 'key->args' if all conditions recorded for this result
+ * still evaluate to true under the current model. The side effects of
+ * evaluating these conditions on 'conds' and 'conds_stack' are replayed. */
+static BzlaNode *
+beta_cache_lookup(BzlaBetaCache *cache,
+                  BzlaBetaCacheEntry *key,
+                  BzlaPtrHashTable *conds,
+                  BzlaNodePtrStack *conds_stack,
+                  BzlaIntHashTable *conds_cache)
+{
+  uint32_t i;
+  bool valid;
+  Bzla *bzla;
+  BzlaBitVector *bv;
+  BzlaNode *cond, *real_cond;
+  BzlaBetaCacheEntry *entry;
+  BzlaPtrHashBucket *b;
+
+  bzla = cache->bzla;
+  b    = bzla_hashptr_table_get(cache->table, key);
+  if (!b)
+  {
+    cache->stats.misses++;
+    return 0;
+  }
+
+  entry = b->key;
+  valid = !bzla_node_is_simplified(entry->result);
+  for (i = 0; valid && i < entry->num_conds; i++)
+  {
+    cond = entry->conds[i];
+    if (bzla_node_is_simplified(cond))
+    {
+      valid = false;
+      break;
+    }
+    bv    = bzla_eval_exp(bzla, cond);
+    valid = bzla_bv_is_true(bv);
+    bzla_bv_free(bzla->mm, bv);
+  }
+
+  if (!valid)
+  {
+    cache->stats.misses++;
+    cache->stats.invalidated++;
+    remove_beta_cache_entry(cache, entry);
+    return 0;
+  }
+
+  cache->stats.hits++;
+  unlink_beta_cache_entry(cache, entry);
+  link_beta_cache_entry(cache, entry);
+
+  for (i = 0; i < entry->num_conds; i++)
+  {
+    cond      = entry->conds[i];
+    real_cond = bzla_node_real_addr(cond);
+    if (conds && !bzla_hashptr_table_get(conds, real_cond))
+      bzla_hashptr_table_add(conds, bzla_node_copy(bzla, real_cond));
+    if (conds_cache
+        && !bzla_hashint_table_contains(conds_cache, bzla_node_get_id(cond)))
+    {
+      assert(conds_stack);
+      BZLA_PUSH_STACK(*conds_stack, bzla_node_copy(bzla, cond));
+    }
+  }
+  return bzla_node_copy(bzla, entry->result);
+}
+
+/* Cache 'result' for 'key'. Takes ownership of the references to the
+ * conditions in 'conds'. Evicts least recently used entries if the memory
+ * budget of the cache is exceeded. */
+static void
+beta_cache_insert(BzlaBetaCache *cache,
+                  BzlaBetaCacheEntry *key,
+                  BzlaNodePtrStack *conds,
+                  BzlaNode *result)
+{
+  uint32_t i, n;
+  Bzla *bzla;
+  BzlaBetaCacheEntry *entry;
+
+  bzla = cache->bzla;
+  assert(!bzla_hashptr_table_get(cache->table, key));
+
+  n = key->num_args + BZLA_COUNT_STACK(*conds);
+  BZLA_CNEW(bzla->mm, entry);
+  BZLA_NEWN(bzla->mm, entry->args, n);
+  entry->lambda   = bzla_node_copy(bzla, key->lambda);
+  entry->num_args = key->num_args;
+  for (i = 0; i < key->num_args; i++)
+    entry->args[i] = bzla_node_copy(bzla, key->args[i]);
+  entry->conds     = entry->args + key->num_args;
+  entry->num_conds = BZLA_COUNT_STACK(*conds);
+  for (i = 0; i < entry->num_conds; i++)
+    entry->conds[i] = BZLA_PEEK_STACK(*conds, i);
+  BZLA_RESET_STACK(*conds);
+  entry->result = bzla_node_copy(bzla, result);
+  entry->bytes  = sizeof(BzlaBetaCacheEntry) + sizeof(BzlaPtrHashBucket)
+                 + n * sizeof(BzlaNode *);
+
+  bzla_hashptr_table_add(cache->table, entry);
+  link_beta_cache_entry(cache, entry);
+  cache->bytes += entry->bytes;
+
+  while (cache->bytes > cache->max_bytes && cache->tail != entry)
+  {
+    cache->stats.evictions++;
+    remove_beta_cache_entry(cache, cache->tail);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 static BzlaNode *
 beta_reduce_partial_aux(Bzla *bzla,
                         BzlaNode *exp,
@@ -600,6 +856,9 @@ beta_reduce_partial_aux(Bzla *bzla,
   BzlaPtrHashTable *t;
   BzlaIntHashTable *mark;
   BzlaHashTableData *d, md;
+  BzlaBetaCache *cache;
+  BzlaBetaCacheEntry key;
+  BzlaNodePtrStack cache_args, cache_conds;
 
   if (!bzla_node_real_addr(exp)->parameterized && !bzla_node_is_lambda(exp))
     return bzla_node_copy(bzla, exp);
@@ -607,14 +866,39 @@ beta_reduce_partial_aux(Bzla *bzla,
   start = bzla_util_time_stamp();
   bzla->stats.betap_reduce_calls++;
 
-  mm = bzla->mm;
+  mm       = bzla->mm;
+  real_cur = bzla_node_real_addr(exp);
+
+  /* results of collecting partial beta reductions are not cached */
+  cache = 0;
+  BZLA_INIT_STACK(mm, cache_args);
+  BZLA_INIT_STACK(mm, cache_conds);
+  if (!cond_sel_if && bzla_node_is_lambda(real_cur))
+  {
+    cache = get_beta_cache(bzla);
+    if (cache && collect_assigned_args(real_cur, &cache_args))
+    {
+      key.lambda   = real_cur;
+      key.args     = cache_args.start;
+      key.num_args = BZLA_COUNT_STACK(cache_args);
+      result =
+          beta_cache_lookup(cache, &key, conds, conds_stack, conds_cache);
+      if (result)
+      {
+        BZLA_RELEASE_STACK(cache_args);
+        bzla->time.betap += bzla_util_time_stamp() - start;
+        return result;
+      }
+    }
+    else
+      cache = 0;
+  }
+
   BZLA_INIT_STACK(mm, stack);
   BZLA_INIT_STACK(mm, arg_stack);
   BZLA_INIT_STACK(mm, reset);
   mark = bzla_hashint_map_new(mm);
 
-  real_cur = bzla_node_real_addr(exp);
-
   /* skip all curried lambdas */
   if (bzla_node_is_lambda(real_cur)) exp = bzla_node_binder_get_body(real_cur);
 
@@ -752,6 +1036,8 @@ beta_reduce_partial_aux(Bzla *bzla,
             BZLA_PUSH_STACK(*conds_stack, bzla_node_copy(bzla, tmp));
           }
 
+          if (cache) BZLA_PUSH_STACK(cache_conds, bzla_node_copy(bzla, tmp));
+
           if (t && !bzla_hashptr_table_get(t, e[0]))
             bzla_hashptr_table_add(t, bzla_node_copy(bzla, e[0]));
 
@@ -817,9 +1103,13 @@ beta_reduce_partial_aux(Bzla *bzla,
     bzla_node_release(bzla, mark->data[i].as_ptr);
   }
 
+  if (cache) beta_cache_insert(cache, &key, &cache_conds, result);
+
   BZLA_RELEASE_STACK(stack);
   BZLA_RELEASE_STACK(arg_stack);
   BZLA_RELEASE_STACK(reset);
+  BZLA_RELEASE_STACK(cache_args);
+  BZLA_RELEASE_STACK(cache_conds);
   bzla_hashint_map_delete(mark);
 
   BZLALOG(2,
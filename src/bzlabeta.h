@@ -16,6 +16,52 @@
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
 
+/* Solver-wide cache for partial beta reduction results of lambdas under a
+ * given parameter assignment (see fun-beta-cache-size). Results of partial
+ * beta reduction depend on the current model, hence every entry additionally
+ * records the (signed) conditions evaluated while computing the result. An
+ * entry is only reused if all of these conditions still evaluate to true.
+ * Entries are evicted in least recently used order if the cache exceeds its
+ * memory budget. */
+
+typedef struct BzlaBetaCacheEntry BzlaBetaCacheEntry;
+
+struct BzlaBetaCacheEntry
+{
+  BzlaNode* lambda;
+  BzlaNode** args; /* assigned arguments of curried lambda chain */
+  uint32_t num_args;
+  BzlaNode* result;
+  BzlaNode** conds; /* evaluated conditions in order of evaluation */
+  uint32_t num_conds;
+  size_t bytes;
+  BzlaBetaCacheEntry* prev; /* LRU list, head is most recently used */
+  BzlaBetaCacheEntry* next;
+};
+
+struct BzlaBetaCache
+{
+  Bzla* bzla;
+  BzlaPtrHashTable* table;
+  BzlaBetaCacheEntry* head;
+  BzlaBetaCacheEntry* tail;
+  size_t bytes;
+  size_t max_bytes;
+  struct
+  {
+    uint_least64_t hits;
+    uint_least64_t misses;
+    uint_least64_t invalidated; /* conditions evaluated differently */
+    uint_least64_t evictions;
+  } stats;
+};
+
+typedef struct BzlaBetaCache BzlaBetaCache;
+
+BzlaBetaCache* bzla_beta_cache_new(Bzla* bzla, size_t max_bytes);
+
+void bzla_beta_cache_delete(BzlaBetaCache* cache);
+
 BzlaNode* bzla_beta_reduce_full(Bzla* bzla,
                                 BzlaNode* exp,
                                 BzlaPtrHashTable* cache);
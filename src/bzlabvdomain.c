@@ -11,6 +11,8 @@
 
 #include <stdio.h>
 
+#include "utils/bzlautil.h"
+
 static BzlaBvDomain *
 new_domain(BzlaMemMgr *mm)
 {
@@ -386,15 +388,71 @@ bzla_bvdomain_to_str(const BzlaBvDomain *d)
 
 /*----------------------------------------------------------------------------*/
 
+static BzlaBitVector *
+gen_next_bits_uint64(BzlaBvDomainGenerator *gen, bool random)
+{
+  assert(gen->domain);
+  assert(gen->is_uint64);
+  assert(random || gen->has_bits64);
+
+  uint64_t r;
+  BzlaBitVector *res, *bits;
+
+  /* Random always resets gen->bits64 to a random value between bits_min and
+   * bits_max. The value is drawn as in the generic case (uniformly, and with
+   * the same sequence of random numbers) and only then scattered. */
+  if (random)
+  {
+    assert(gen->rng);
+    assert(gen->bits_min);
+    assert(gen->bits_max);
+    bits = bzla_bv_new_random_range(gen->mm,
+                                    gen->rng,
+                                    bzla_bv_get_width(gen->bits_min),
+                                    gen->bits_min,
+                                    gen->bits_max);
+    r = bzla_bv_to_uint64(bits);
+    bzla_bv_free(gen->mm, bits);
+    gen->bits64     = bzla_util_uint64_pdep(r, gen->mask64);
+    gen->has_bits64 = true;
+  }
+
+  res = bzla_bv_uint64_to_bv(gen->mm,
+                             gen->lo64 | gen->bits64,
+                             bzla_bv_get_width(gen->domain->lo));
+
+  /* If bits is bits_max, we enumerated all values. */
+  if (gen->bits64 == gen->bits_max64)
+  {
+    /* random never terminates and bits start again at bits_min. */
+    gen->bits64     = gen->bits_min64;
+    gen->has_bits64 = random;
+  }
+  else
+  {
+    gen->bits64 = bzla_util_uint64_pdep_inc(gen->bits64, gen->mask64);
+  }
+
+  assert(bzla_bv_compare(res, gen->min) >= 0);
+  assert(bzla_bv_compare(res, gen->max) <= 0);
+
+  if (gen->cur) bzla_bv_free(gen->mm, gen->cur);
+  gen->cur = res;
+
+  return res;
+}
+
 static BzlaBitVector *
 gen_next_bits(BzlaBvDomainGenerator *gen, bool random)
 {
   assert(gen->domain);
-  assert(random || gen->bits);
+  assert(random || gen->bits || gen->is_uint64);
 
   uint32_t bw, bw_bits, i, j;
   BzlaBitVector *res, *next_bits;
 
+  if (gen->is_uint64) return gen_next_bits_uint64(gen, random);
+
   bw  = bzla_bv_get_width(gen->domain->lo);
   res = bzla_bv_copy(gen->mm, gen->domain->lo);
 
@@ -575,6 +633,29 @@ bzla_bvdomain_gen_init_range(BzlaMemMgr *mm,
   gen->min = bzla_bv_copy(mm, min);
   gen->max = bzla_bv_copy(mm, max);
 #endif
+
+  gen->is_uint64 = bw <= 64;
+  if (gen->is_uint64)
+  {
+    gen->lo64       = bzla_bv_to_uint64(d->lo);
+    gen->mask64     = bzla_bv_to_uint64(d->hi) & ~gen->lo64;
+    gen->has_bits64 = gen->bits != 0;
+    gen->bits_min64 = 0;
+    gen->bits_max64 = 0;
+    if (gen->bits_min)
+    {
+      gen->bits_min64 = bzla_util_uint64_pdep(bzla_bv_to_uint64(gen->bits_min),
+                                              gen->mask64);
+      gen->bits_max64 = bzla_util_uint64_pdep(bzla_bv_to_uint64(gen->bits_max),
+                                              gen->mask64);
+    }
+    gen->bits64 = gen->bits_min64;
+    if (gen->bits)
+    {
+      bzla_bv_free(mm, gen->bits);
+      gen->bits = 0;
+    }
+  }
 }
 
 bool
@@ -582,6 +663,7 @@ bzla_bvdomain_gen_has_next(const BzlaBvDomainGenerator *gen)
 {
   assert(gen);
   assert(!gen->bits || bzla_bv_compare(gen->bits, gen->bits_min) >= 0);
+  if (gen->is_uint64) return gen->has_bits64;
   return gen->bits && bzla_bv_compare(gen->bits, gen->bits_max) <= 0;
 }
 
@@ -589,7 +671,7 @@ BzlaBitVector *
 bzla_bvdomain_gen_next(BzlaBvDomainGenerator *gen)
 {
   assert(gen);
-  assert(gen->bits);
+  assert(gen->bits || gen->is_uint64);
   assert(bzla_bvdomain_gen_has_next(gen));
   return gen_next_bits(gen, false);
 }
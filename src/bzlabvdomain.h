@@ -13,6 +13,10 @@
 
 #include "bzlabv.h"
 
+/* The bounds are owned by the domain and allocated separately. The domain
+ * propagators allocate domains themselves and assign 'lo' and 'hi' directly,
+ * hence an inline layout (e.g., two uint64_t for bit-widths up to 64)
+ * requires changing these first. */
 struct BzlaBvDomain
 {
   BzlaBitVector *lo;
@@ -164,6 +168,16 @@ struct BzlaBvDomainGenerator
   BzlaBvDomain *domain;    /* the domain to enumerate values for */
   BzlaBitVector *min;      /* the min value (in case of ranged init) */
   BzlaBitVector *max;      /* the max value (in case of ranged init) */
+  /* For bit-widths <= 64, values are enumerated on uint64_t, with the
+   * counter over the unconstrained bits scattered into their positions
+   * (pdep-style). 'bits' is unused in this case. */
+  bool is_uint64;        /* true if values are enumerated on uint64_t */
+  bool has_bits64;       /* false if all values have been enumerated */
+  uint64_t mask64;       /* unconstrained bits of the domain */
+  uint64_t lo64;         /* fixed bits of the domain */
+  uint64_t bits64;       /* next value of the unconstrained bits */
+  uint64_t bits_min64;   /* scattered min value of the unconstrained bits */
+  uint64_t bits_max64;   /* scattered max value of the unconstrained bits */
 };
 
 typedef struct BzlaBvDomainGenerator BzlaBvDomainGenerator;
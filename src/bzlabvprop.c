@@ -950,8 +950,9 @@ bvprop_shift_aux(BzlaMemMgr *mm,
     else
       d = bzla_bvdomain_new_init(mm, bw);
     BZLA_PUSH_STACK(d_ite_stack, d);
-    /* shift width */
-    bv = bzla_bv_uint64_to_bv(mm, 1u << i, bw);
+    /* shift width (shifting by 2^i >= bw is equivalent to shifting by bw) */
+    n  = i < 32 && (1u << i) < bw ? 1u << i : bw;
+    bv = bzla_bv_uint64_to_bv(mm, n, bw);
     BZLA_PUSH_STACK(shift_stack, bv);
   }
 
@@ -3150,6 +3151,64 @@ DONE:
   return res;
 }
 
+/* Flip the MSB of all values in domain 'd', i.e., compute the domain of
+ * x ^ 10...0 for x in 'd'. */
+static BzlaBvDomain *
+flip_msb_domain(BzlaMemMgr *mm, const BzlaBvDomain *d)
+{
+  uint32_t msb;
+  BzlaBvDomain *res;
+
+  msb = bzla_bvdomain_get_width(d) - 1;
+  res = bzla_bvdomain_new(mm, d->lo, d->hi);
+  bzla_bv_set_bit(res->lo, msb, !bzla_bv_get_bit(d->hi, msb));
+  bzla_bv_set_bit(res->hi, msb, !bzla_bv_get_bit(d->lo, msb));
+  return res;
+}
+
+bool
+bzla_bvprop_slt(BzlaMemMgr *mm,
+                BzlaBvDomain *d_x,
+                BzlaBvDomain *d_y,
+                BzlaBvDomain *d_z,
+                BzlaBvDomain **res_d_x,
+                BzlaBvDomain **res_d_y,
+                BzlaBvDomain **res_d_z)
+{
+  assert(mm);
+  assert(d_x);
+  assert(bzla_bvdomain_is_valid(mm, d_x));
+  assert(d_y);
+  assert(bzla_bvdomain_is_valid(mm, d_y));
+  assert(d_z);
+  assert(bzla_bvdomain_is_valid(mm, d_z));
+  assert(bzla_bvdomain_get_width(d_x) == bzla_bvdomain_get_width(d_y));
+  assert(bzla_bvdomain_get_width(d_z) == 1);
+
+  bool res;
+  BzlaBvDomain *tmp_x, *tmp_y, *tmp_res_x, *tmp_res_y;
+
+  /**
+   * z_[1] = x_[bw] <s y_[bw]
+   *       = (x ^ 10...0) <u (y ^ 10...0) */
+
+  tmp_x = flip_msb_domain(mm, d_x);
+  tmp_y = flip_msb_domain(mm, d_y);
+
+  res = bzla_bvprop_ult(
+      mm, tmp_x, tmp_y, d_z, &tmp_res_x, &tmp_res_y, res_d_z);
+
+  *res_d_x = flip_msb_domain(mm, tmp_res_x);
+  *res_d_y = flip_msb_domain(mm, tmp_res_y);
+
+  bzla_bvdomain_free(mm, tmp_x);
+  bzla_bvdomain_free(mm, tmp_y);
+  bzla_bvdomain_free(mm, tmp_res_x);
+  bzla_bvdomain_free(mm, tmp_res_y);
+
+  return res;
+}
+
 #if 0
 static bool
 bvprop_udiv_old (BzlaMemMgr *mm,
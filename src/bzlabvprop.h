@@ -192,6 +192,15 @@ bool bzla_bvprop_ult(BzlaMemMgr *mm,
                      BzlaBvDomain **res_d_y,
                      BzlaBvDomain **res_d_z);
 
+/** Propagate domains 'd_x', 'd_y' and 'd_z' of z = x < y (signed lt). */
+bool bzla_bvprop_slt(BzlaMemMgr *mm,
+                     BzlaBvDomain *d_x,
+                     BzlaBvDomain *d_y,
+                     BzlaBvDomain *d_z,
+                     BzlaBvDomain **res_d_x,
+                     BzlaBvDomain **res_d_y,
+                     BzlaBvDomain **res_d_z);
+
 /**
  * Propagate domains 'd_x', 'd_y' and 'd_z' of z = x / y (unsigned division).
  */
@@ -1183,8 +1183,16 @@ chkclone_slv(Bzla *bzla, Bzla *clone)
 
     chkclone_int_hash_map(
         slv->aprop->unsatroots, cslv->aprop->unsatroots, cmp_data_as_int);
-    chkclone_int_hash_map(
-        slv->aprop->model, cslv->aprop->model, cmp_data_as_int);
+    assert(slv->aprop->size == cslv->aprop->size);
+    assert(!slv->aprop->model == !cslv->aprop->model);
+    assert(!slv->aprop->model
+           || !memcmp(slv->aprop->model,
+                      cslv->aprop->model,
+                      (slv->aprop->size + 63) / 64 * sizeof(uint64_t)));
+    assert(!slv->aprop->assigned
+           || !memcmp(slv->aprop->assigned,
+                      cslv->aprop->assigned,
+                      (slv->aprop->size + 63) / 64 * sizeof(uint64_t)));
     chkclone_int_hash_map(
         slv->aprop->score, cslv->aprop->score, cmp_data_as_dbl);
 
@@ -1192,6 +1200,8 @@ chkclone_slv(Bzla *bzla, Bzla *clone)
     BZLA_CHKCLONE_SLV_STATE(slv->aprop, cslv->aprop, seed);
     BZLA_CHKCLONE_SLV_STATE(slv->aprop, cslv->aprop, use_restarts);
     BZLA_CHKCLONE_SLV_STATE(slv->aprop, cslv->aprop, use_bandit);
+    BZLA_CHKCLONE_SLV_STATE(slv->aprop, cslv->aprop, use_sim);
+    BZLA_CHKCLONE_SLV_STATE(slv->aprop, cslv->aprop, nthreads);
 
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, moves);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, restarts);
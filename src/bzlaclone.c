@@ -241,12 +241,13 @@ bzla_clone_data_as_int_htable(BzlaMemMgr *mm,
 
   res->size  = table->size;
   res->count = table->count;
+  res->dense = table->dense;
   BZLA_CNEWN(mm, res->keys, res->size);
-  BZLA_CNEWN(mm, res->hop_info, res->size);
+  if (table->hop_info) BZLA_CNEWN(mm, res->hop_info, res->size);
   if (table->data) BZLA_CNEWN(mm, res->data, res->size);
 
   memcpy(res->keys, table->keys, table->size);
-  memcpy(res->hop_info, table->hop_info, table->size);
+  if (table->hop_info) memcpy(res->hop_info, table->hop_info, table->size);
   if (table->data) memcpy(res->data, table->data, table->size);
 
   cloned_data->as_ptr = res;
@@ -843,10 +844,8 @@ clone_nodes_unique_table(Bzla *bzla, Bzla *clone, BzlaNodeMap *exp_map)
   }
 }
 
-#define MEM_INT_HASH_TABLE(table)                               \
-  ((table) ? sizeof(*(table)) + (table)->size * sizeof(int32_t) \
-                 + (table)->size * sizeof(uint8_t)              \
-           : 0)
+#define MEM_INT_HASH_TABLE(table) \
+  ((table) ? bzla_hashint_table_size(table) : 0)
 
 #define MEM_INT_HASH_MAP(table)                                                \
   ((table)                                                                     \
@@ -911,6 +910,43 @@ clone_nodes_unique_table(Bzla *bzla, Bzla *clone, BzlaNodeMap *exp_map)
 
 #define MEM_BITVEC(bv) ((bv) ? bzla_bv_size(bv) : 0)
 
+#ifndef NDEBUG
+/* Returns the size of a map from node ids to bit-vector domains in Byte. */
+static size_t
+mem_bvdomain_map(BzlaIntHashTable *domains)
+{
+  size_t res;
+  BzlaBvDomain *d;
+  BzlaIntHashTableIterator it;
+
+  if (!domains) return 0;
+  res = MEM_INT_HASH_MAP(domains);
+  bzla_iter_hashint_init(&it, domains);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    d = bzla_iter_hashint_next_data(&it)->as_ptr;
+    res += sizeof(BzlaBvDomain) + MEM_BITVEC(d->lo) + MEM_BITVEC(d->hi);
+  }
+  return res;
+}
+
+/* Returns the size of a map from node ids to bit-vectors (e.g., a model) in
+ * Byte. */
+static size_t
+mem_bv_map(BzlaIntHashTable *bvs)
+{
+  size_t res;
+  BzlaIntHashTableIterator it;
+
+  if (!bvs) return 0;
+  res = MEM_INT_HASH_MAP(bvs);
+  bzla_iter_hashint_init(&it, bvs);
+  while (bzla_iter_hashint_has_next(&it))
+    res += MEM_BITVEC(bzla_iter_hashint_next_data(&it)->as_ptr);
+  return res;
+}
+#endif
+
 static Bzla *
 clone_aux_bzla(Bzla *bzla,
                BzlaNodeMap **exp_map,
@@ -1407,6 +1443,9 @@ clone_aux_bzla(Bzla *bzla,
   }
   assert(allocated == clone->mm->allocated);
 #endif
+  /* store indices are rebuilt on demand */
+  clone->store_indices = 0;
+
   BZLA_NEW(mm, clone->rw_cache);
   memcpy(clone->rw_cache, bzla->rw_cache, sizeof(BzlaRwCache));
   clone->rw_cache->bzla  = clone;
@@ -1462,6 +1501,16 @@ clone_aux_bzla(Bzla *bzla,
       allocated += sizeof(BzlaFunSolver);
 
       allocated += MEM_PTR_HASH_TABLE(slv->lemmas);
+      allocated += MEM_PTR_HASH_TABLE(slv->lemma_prems);
+      bzla_iter_hashptr_init(&pit, slv->lemma_prems);
+      while (bzla_iter_hashptr_has_next(&pit))
+      {
+        BzlaLemmaPrems *prems = pit.bucket->data.as_ptr;
+        allocated += sizeof(BzlaLemmaPrems)
+                     + BZLA_SIZE_STACK(prems->sets) * sizeof(int32_t)
+                     + MEM_INT_HASH_MAP(prems->first);
+        (void) bzla_iter_hashptr_next(&pit);
+      }
       allocated += BZLA_SIZE_STACK(slv->cur_lemmas) * sizeof(BzlaNode *);
       allocated += BZLA_SIZE_STACK(slv->constraints) * sizeof(BzlaNode *);
 
@@ -1499,6 +1548,15 @@ clone_aux_bzla(Bzla *bzla,
       assert(BZLA_COUNT_STACK(slv->stats.lemmas_size)
              == BZLA_COUNT_STACK(cslv->stats.lemmas_size));
       allocated += BZLA_SIZE_STACK(slv->stats.lemmas_size) * sizeof(uint32_t);
+
+      if (slv->phases)
+      {
+        CHKCLONE_MEM_INT_HASH_MAP(slv->phases, cslv->phases);
+        allocated += MEM_INT_HASH_MAP(cslv->phases);
+        bzla_iter_hashint_init(&ciit, cslv->phases);
+        while (bzla_iter_hashint_has_next(&ciit))
+          allocated += MEM_BITVEC(bzla_iter_hashint_next_data(&ciit)->as_ptr);
+      }
     }
     else if (clone->slv->kind == BZLA_SLS_SOLVER_KIND)
     {
@@ -1509,10 +1567,13 @@ clone_aux_bzla(Bzla *bzla,
       CHKCLONE_MEM_INT_HASH_MAP(slv->roots, cslv->roots);
       CHKCLONE_MEM_INT_HASH_MAP(slv->score, cslv->score);
       CHKCLONE_MEM_INT_HASH_MAP(slv->weights, cslv->weights);
+      CHKCLONE_MEM_INT_HASH_MAP(slv->domains, cslv->domains);
 
       allocated += sizeof(BzlaSLSSolver) + MEM_INT_HASH_MAP(cslv->roots)
                    + MEM_INT_HASH_MAP(cslv->score)
-                   + MEM_INT_HASH_MAP(cslv->weights);
+                   + MEM_INT_HASH_MAP(cslv->weights)
+                   + mem_bvdomain_map(cslv->domains)
+                   + mem_bv_map(cslv->warm_model);
 
       if (slv->weights)
         allocated += slv->weights->count * sizeof(BzlaSLSConstrData);
@@ -1552,10 +1613,12 @@ clone_aux_bzla(Bzla *bzla,
 
       CHKCLONE_MEM_INT_HASH_MAP(slv->roots, cslv->roots);
       CHKCLONE_MEM_INT_HASH_MAP(slv->score, cslv->score);
+      CHKCLONE_MEM_INT_HASH_MAP(slv->domains, cslv->domains);
 
       allocated +=
-          sizeof(BzlaPropSolver) + MEM_PTR_HASH_TABLE(cslv->roots)
-          + MEM_PTR_HASH_TABLE(cslv->score)
+          sizeof(BzlaPropSolver) + MEM_INT_HASH_MAP(cslv->roots)
+          + MEM_INT_HASH_MAP(cslv->score) + mem_bvdomain_map(cslv->domains)
+          + mem_bv_map(cslv->warm_model)
 #ifndef NDEBUG
           + BZLA_SIZE_STACK(cslv->prop_path) * sizeof(BzlaPropEntailInfo);
 #endif
@@ -27,6 +27,7 @@
 #include "bzlabvdomain.h"
 #include "bzlacore.h"
 #include "bzlaproputils.h"
+#include "utils/bzlautil.h"
 
 /**
  * Check consistency condition (with respect to const bits in x) for:
@@ -189,14 +190,15 @@ bzla_is_cons_slt_const(Bzla *bzla, BzlaPropInfo *pi)
  * pos_x = 0: \exists y. (y <= ctz(t) /\ mcb(x << y, t))
  * pos_x = 1: t = 0 \/ \exists y. (y <= ctz(t) /\ mcb(x, y))
  */
-bool
-bzla_is_cons_sll_const(Bzla *bzla, BzlaPropInfo *pi)
+static bool
+is_cons_sll_const_aux(Bzla *bzla, BzlaPropInfo *pi, bool use_uint64)
 {
   assert(bzla);
   assert(pi);
 
   bool res;
   uint32_t i, pos_x, bw, bw_r, ctz_t;
+  uint64_t t64, lo64, hi64, t_slice64;
   const BzlaBitVector *t;
   const BzlaBvDomain *x;
   BzlaBvDomain *x_slice;
@@ -222,8 +224,26 @@ bzla_is_cons_sll_const(Bzla *bzla, BzlaPropInfo *pi)
       BzlaBitVectorPtrStack stack;
       BZLA_INIT_STACK(mm, stack);
 
+      if (use_uint64)
+      {
+        t64  = bzla_bv_to_uint64(t);
+        lo64 = bzla_bv_to_uint64(x->lo);
+        hi64 = bzla_bv_to_uint64(x->hi);
+      }
+
       for (i = 0; i <= ctz_t; i++)
       {
+        if (use_uint64)
+        {
+          /* mcb(x[bw - 1 - i:0], t[bw - 1:i]) */
+          t_slice64 = t64 >> i;
+          if (((t_slice64 & hi64) | (lo64 & bzla_util_uint64_mask(bw - i)))
+              == t_slice64)
+          {
+            BZLA_PUSH_STACK(stack, bzla_bv_slice(mm, t, bw - 1, i));
+          }
+          continue;
+        }
         x_slice = bzla_bvdomain_slice(mm, x, bw - 1 - i, 0);
         t_slice = bzla_bv_slice(mm, t, bw - 1, i);
         if (bzla_bvdomain_check_fixed_bits(mm, x_slice, t_slice))
@@ -284,6 +304,23 @@ bzla_is_cons_sll_const(Bzla *bzla, BzlaPropInfo *pi)
   return res;
 }
 
+bool
+bzla_is_cons_sll_const(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  return is_cons_sll_const_aux(
+      bzla, pi, bzla_bv_get_width(pi->target_value) <= 64);
+}
+
+bool
+bzla_is_cons_sll_const_generic(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  return is_cons_sll_const_aux(bzla, pi, false);
+}
+
 /**
  * Check consistency condition (with respect to const bits in x) for:
  *
@@ -294,14 +331,15 @@ bzla_is_cons_sll_const(Bzla *bzla, BzlaPropInfo *pi)
  * pos_x = 0: \exists y. (y <= clz(t) /\ mcb(x >> y, t))
  * pos_x = 1: t = 0 \/ \exists y. (y <= clz(t) /\ mcb(x, y))
  */
-bool
-bzla_is_cons_srl_const(Bzla *bzla, BzlaPropInfo *pi)
+static bool
+is_cons_srl_const_aux(Bzla *bzla, BzlaPropInfo *pi, bool use_uint64)
 {
   assert(bzla);
   assert(pi);
 
   bool res;
   uint32_t i, pos_x, bw, bw_l, clz_t;
+  uint64_t t64, lo64, hi64, t_slice64;
   const BzlaBitVector *t;
   const BzlaBvDomain *x;
   BzlaBvDomain *x_slice;
@@ -327,8 +365,25 @@ bzla_is_cons_srl_const(Bzla *bzla, BzlaPropInfo *pi)
       BzlaBitVectorPtrStack stack;
       BZLA_INIT_STACK(mm, stack);
 
+      if (use_uint64)
+      {
+        t64  = bzla_bv_to_uint64(t);
+        lo64 = bzla_bv_to_uint64(x->lo);
+        hi64 = bzla_bv_to_uint64(x->hi);
+      }
+
       for (i = 0; i <= clz_t; i++)
       {
+        if (use_uint64)
+        {
+          /* mcb(x[bw - 1:i], t[bw - 1 - i:0]) */
+          t_slice64 = t64 & bzla_util_uint64_mask(bw - i);
+          if (((t_slice64 & (hi64 >> i)) | (lo64 >> i)) == t_slice64)
+          {
+            BZLA_PUSH_STACK(stack, bzla_bv_slice(mm, t, bw - 1 - i, 0));
+          }
+          continue;
+        }
         x_slice = bzla_bvdomain_slice(mm, x, bw - 1, i);
         t_slice = bzla_bv_slice(mm, t, bw - 1 - i, 0);
         if (bzla_bvdomain_check_fixed_bits(mm, x_slice, t_slice))
@@ -388,6 +443,23 @@ bzla_is_cons_srl_const(Bzla *bzla, BzlaPropInfo *pi)
   return res;
 }
 
+bool
+bzla_is_cons_srl_const(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  return is_cons_srl_const_aux(
+      bzla, pi, bzla_bv_get_width(pi->target_value) <= 64);
+}
+
+bool
+bzla_is_cons_srl_const_generic(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  return is_cons_srl_const_aux(bzla, pi, false);
+}
+
 /**
  * Check consistency condition (with respect to const bits in x) for:
  *
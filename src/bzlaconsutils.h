@@ -63,6 +63,15 @@ bool bzla_is_cons_sll_const(Bzla *bzla, BzlaPropInfo *pi);
  */
 bool bzla_is_cons_srl_const(Bzla *bzla, BzlaPropInfo *pi);
 
+/**
+ * Generic (GMP-based) versions of the consistency checks for x << s and
+ * x >> s. For bit-widths <= 64, the checks above dispatch to implementations
+ * on uint64_t instead. Both versions yield the same result for the same state
+ * of the random number generator.
+ */
+bool bzla_is_cons_sll_const_generic(Bzla *bzla, BzlaPropInfo *pi);
+bool bzla_is_cons_srl_const_generic(Bzla *bzla, BzlaPropInfo *pi);
+
 /**
  * Check consistency of x >>a s = t or s >>a x = t when solved for x with
  * respect to const bits in x.
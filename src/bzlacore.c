@@ -30,6 +30,7 @@
 #include "bzlaslvprop.h"
 #include "bzlaslvquant.h"
 #include "bzlaslvsls.h"
+#include "bzlastoreidx.h"
 #include "bzlasubst.h"
 #include "preprocess/bzlapreprocess.h"
 #include "preprocess/bzlavarsubst.h"
@@ -502,6 +503,11 @@ bzla_print_stats(Bzla *bzla)
            1,
            "%5d static apply propagations over updates",
            bzla->stats.prop_apply_update);
+  BZLA_MSG(bzla->msg,
+           1,
+           "%5lld reads resolved via store indices (%lld indices)",
+           bzla->stats.store_index_reads,
+           bzla->stats.store_indices_built);
   BZLA_MSG(
       bzla->msg, 1, "%5lld beta reductions", bzla->stats.beta_reduce_calls);
   BZLA_MSG(bzla->msg, 1, "%5lld clone calls", bzla->stats.clone_calls);
@@ -567,6 +573,28 @@ bzla_print_stats(Bzla *bzla)
            1,
            "  %7lld CNF literals",
            bzla->avmgr ? bzla->avmgr->amgr->num_cnf_literals : 0);
+  if (bzla->avmgr && bzla->avmgr->amgr->share.enabled)
+  {
+    BZLA_MSG(bzla->msg,
+             1,
+             "  %7lld exported learned clauses",
+             bzla->avmgr->amgr->num_exported_clauses);
+    BZLA_MSG(bzla->msg,
+             1,
+             "  %7lld imported learned clauses",
+             bzla->avmgr->amgr->num_imported_clauses);
+  }
+  if (bzla->avmgr && bzla_sat_mgr_has_freeze_support(bzla_get_sat_mgr(bzla)))
+  {
+    BZLA_MSG(bzla->msg,
+             1,
+             "  %7lld frozen CNF variables",
+             bzla->avmgr->amgr->num_frozen_cnf_vars);
+    BZLA_MSG(bzla->msg,
+             1,
+             "  %7lld melted CNF variables",
+             bzla->avmgr->amgr->num_melted_cnf_vars);
+  }
 
   if (bzla->slv) bzla->slv->api.print_stats(bzla->slv);
 
@@ -1051,6 +1079,7 @@ bzla_delete(Bzla *bzla)
 
   bzla_rw_cache_delete(bzla->rw_cache);
   BZLA_DELETE(mm, bzla->rw_cache);
+  bzla_store_index_delete_all(bzla);
 
   assert(bzla->rec_rw_calls == 0);
   bzla_msg_delete(bzla->msg);
@@ -2404,6 +2433,7 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
           }
         }
         BZLALOG(2, "  synthesized: %s", bzla_util_node2string(cur));
+        bzla_aig_mgr_ref_frozen(avmgr->amgr, cur->av->aigs, cur->av->width);
         bzla_aigvec_to_sat_tseitin(avmgr, cur->av);
 
         /* continue synthesizing children for apply and feq nodes if
@@ -2624,6 +2654,7 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
       }
       assert(cur->av);
       BZLALOG(2, "  synthesized: %s", bzla_util_node2string(cur));
+      bzla_aig_mgr_ref_frozen(avmgr->amgr, cur->av->aigs, cur->av->width);
       bzla_aigvec_to_sat_tseitin(avmgr, cur->av);
     }
   }
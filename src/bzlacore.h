@@ -112,6 +112,8 @@ struct Bzla
   uint32_t rec_rw_calls; /* calls for recursive rewriting */
   uint32_t valid_assignments;
   BzlaRwCache *rw_cache;
+  /* maps store chains to their index of constant store indices */
+  BzlaIntHashTable *store_indices;
 
   int32_t vis_idx; /* file index for visualizing expressions */
 
@@ -176,6 +178,8 @@ struct Bzla
     uint32_t ackermann_constraints;
     uint_least64_t prop_apply_lambda; /* number of static props over lambdas */
     uint_least64_t prop_apply_update; /* number of static props over updates */
+    uint_least64_t store_index_reads; /* reads resolved via store indices */
+    uint_least64_t store_indices_built;
     uint32_t bv_uc_props;
     uint32_t fun_uc_props;
     uint32_t param_uc_props;
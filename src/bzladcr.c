@@ -16,6 +16,28 @@
 #include "utils/bzlahashptr.h"
 #include "utils/bzlautil.h"
 
+/* Flags in BzlaFunSolver::score_cone, marking the nodes whose cone has
+ * already been searched for nodes that require a score. */
+#define BZLA_DCR_CONE_JUST 1
+#define BZLA_DCR_CONE_DUAL_PROP 2
+
+/* Returns true if the cone of 'exp' has already been searched (in the
+ * current or a previous refinement round), else marks it as searched. */
+static bool
+cone_searched(BzlaFunSolver *slv, BzlaNode *exp, int32_t flag)
+{
+  BzlaHashTableData *d;
+
+  if (!slv->score_cone) slv->score_cone = bzla_hashint_map_new(slv->bzla->mm);
+
+  if (!(d = bzla_hashint_map_get(slv->score_cone, exp->id)))
+    d = bzla_hashint_map_add(slv->score_cone, exp->id);
+  else if (d->as_int & flag)
+    return true;
+  d->as_int |= flag;
+  return false;
+}
+
 /* heuristic: minimum depth to the inputs
  *            (considering the whole formula or the bv skeleton, only) */
 static void
@@ -32,16 +54,20 @@ compute_scores_aux_min_dep(Bzla *bzla, BzlaNodePtrStack *nodes)
   BzlaNode *cur, *e;
   BzlaPtrHashTable *score;
   BzlaPtrHashBucket *b;
-  BzlaIntHashTable *mark;
+  BzlaIntHashTable *mark, *pending;
   BzlaHashTableData *d;
   BzlaMemMgr *mm;
 
   mm = bzla->mm;
   BZLA_INIT_STACK(mm, stack);
 
-  slv   = BZLA_FUN_SOLVER(bzla);
-  score = slv->score;
-  mark  = bzla_hashint_map_new(mm);
+  slv     = BZLA_FUN_SOLVER(bzla);
+  score   = slv->score;
+  mark    = bzla_hashint_map_new(mm);
+  pending = bzla_hashint_table_new(mm);
+
+  for (j = 0; j < BZLA_COUNT_STACK(*nodes); j++)
+    bzla_hashint_table_add(pending, BZLA_PEEK_STACK(*nodes, j)->id);
 
   for (j = 0; j < BZLA_COUNT_STACK(*nodes); j++)
   {
@@ -57,6 +83,16 @@ compute_scores_aux_min_dep(Bzla *bzla, BzlaNodePtrStack *nodes)
       if (!d)
       {
         d = bzla_hashint_map_add(mark, cur->id);
+
+        /* depths of nodes other than the ones to be scored are not
+         * invalidated, i.e., they are kept from previous rounds */
+        if (!bzla_hashint_table_contains(pending, cur->id)
+            && bzla_hashptr_table_get(score, cur))
+        {
+          d->as_int = 1;
+          continue;
+        }
+
         BZLA_PUSH_STACK(stack, cur);
 
         if (cur->arity == 0)
@@ -96,6 +132,7 @@ compute_scores_aux_min_dep(Bzla *bzla, BzlaNodePtrStack *nodes)
 
   BZLA_RELEASE_STACK(stack);
   bzla_hashint_map_delete(mark);
+  bzla_hashint_table_delete(pending);
 }
 
 /* heuristic: minimum number of unique applies on a path to the inputs
@@ -234,7 +271,6 @@ bzla_dcr_compute_scores(Bzla *bzla)
   BzlaNode *cur, *e;
   BzlaPtrHashTableIterator it;
   BzlaNodePtrStack stack, nodes;
-  BzlaIntHashTable *mark;
   BzlaMemMgr *mm;
 
   /* computing scores only required for BZLA_JUST_HEUR_BRANCH_MIN_DEP and
@@ -253,7 +289,6 @@ bzla_dcr_compute_scores(Bzla *bzla)
   mm    = bzla->mm;
   BZLA_INIT_STACK(mm, stack);
   BZLA_INIT_STACK(mm, nodes);
-  mark = bzla_hashint_table_new(mm);
 
   slv = BZLA_FUN_SOLVER(bzla);
 
@@ -271,8 +306,7 @@ bzla_dcr_compute_scores(Bzla *bzla)
     while (!BZLA_EMPTY_STACK(stack))
     {
       cur = bzla_node_real_addr(BZLA_POP_STACK(stack));
-      if (bzla_hashint_table_contains(mark, cur->id)) continue;
-      bzla_hashint_table_add(mark, cur->id);
+      if (cone_searched(slv, cur, BZLA_DCR_CONE_JUST)) continue;
       for (i = 0; i < cur->arity; i++)
       {
         e = bzla_node_real_addr(cur->e[i]);
@@ -289,7 +323,6 @@ bzla_dcr_compute_scores(Bzla *bzla)
   }
 
   BZLA_RELEASE_STACK(stack);
-  bzla_hashint_table_delete(mark);
 
   compute_scores_aux(bzla, &nodes);
 
@@ -309,7 +342,6 @@ bzla_dcr_compute_scores_dual_prop(Bzla *bzla)
   BzlaNode *cur;
   BzlaNodePtrStack stack, nodes;
   BzlaPtrHashTableIterator it;
-  BzlaIntHashTable *mark;
   BzlaMemMgr *mm;
 
   /* computing scores only required for BZLA_JUST_HEUR_BRANCH_MIN_DEP and
@@ -321,7 +353,6 @@ bzla_dcr_compute_scores_dual_prop(Bzla *bzla)
   start = bzla_util_time_stamp();
   mm    = bzla->mm;
   BZLA_INIT_STACK(mm, stack);
-  mark = bzla_hashint_table_new(mm);
 
   slv = BZLA_FUN_SOLVER(bzla);
 
@@ -348,8 +379,7 @@ bzla_dcr_compute_scores_dual_prop(Bzla *bzla)
     while (!BZLA_EMPTY_STACK(stack))
     {
       cur = bzla_node_real_addr(BZLA_POP_STACK(stack));
-      if (bzla_hashint_table_contains(mark, cur->id)) continue;
-      bzla_hashint_table_add(mark, cur->id);
+      if (cone_searched(slv, cur, BZLA_DCR_CONE_DUAL_PROP)) continue;
 
       if (bzla_node_is_apply(cur) || bzla_node_is_fun_eq(cur))
       {
@@ -368,7 +398,6 @@ bzla_dcr_compute_scores_dual_prop(Bzla *bzla)
   }
 
   BZLA_RELEASE_STACK(stack);
-  bzla_hashint_table_delete(mark);
 
   /* compute scores from applies downwards */
   compute_scores_aux(bzla, &nodes);
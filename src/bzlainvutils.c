@@ -157,7 +157,7 @@ bzla_is_inv_eq(Bzla *bzla, BzlaPropInfo *pi)
  * IC: (-s | s ) & t = t
  */
 bool
-bzla_is_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
+bzla_is_inv_mul_generic(Bzla *bzla, BzlaPropInfo *pi)
 {
   assert(bzla);
   assert(pi);
@@ -181,6 +181,22 @@ bzla_is_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
   return res;
 }
 
+bool
+bzla_is_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+
+  uint64_t s, t;
+
+  if (bzla_bv_get_width(pi->target_value) > 64)
+    return bzla_is_inv_mul_generic(bzla, pi);
+
+  s = bzla_bv_to_uint64(pi->bv[1 - pi->pos_x]);
+  t = bzla_bv_to_uint64(pi->target_value);
+  return ((-s | s) & t) == t;
+}
+
 typedef enum
 {
   BZLA_BV_SHIFT_SLL,
@@ -335,8 +351,70 @@ is_inv_shift(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
   return res;
 }
 
+/* Specialization of is_inv_shift for bit-widths <= 64. */
+static bool
+is_inv_shift_uint64(BzlaPropInfo *pi, BzlaBvShiftKind kind)
+{
+  assert(pi);
+  assert(bzla_bv_get_width(pi->target_value) <= 64);
+
+  int32_t pos_x;
+  uint32_t bw, cnt_s, cnt_t;
+  uint64_t s, t, mask, shift, sign;
+
+  pos_x = pi->pos_x;
+  s     = bzla_bv_to_uint64(pi->bv[1 - pos_x]);
+  t     = bzla_bv_to_uint64(pi->target_value);
+  bw    = bzla_bv_get_width(pi->target_value);
+  mask  = bzla_util_uint64_mask(bw);
+
+  if (pos_x == 0)
+  {
+    if (s >= bw) return t == 0 || (kind == BZLA_BV_SHIFT_SRA && t == mask);
+    if (kind == BZLA_BV_SHIFT_SLL) return ((t >> s) << s) == t;
+    shift = (t << s) & mask;
+    if (kind == BZLA_BV_SHIFT_SRL) return (shift >> s) == t;
+    assert(kind == BZLA_BV_SHIFT_SRA);
+    sign = (shift >> (bw - 1)) ? mask & ~(mask >> s) : 0;
+    return ((shift >> s) | sign) == t;
+  }
+
+  assert(pos_x == 1);
+  if (kind == BZLA_BV_SHIFT_SRA)
+  {
+    if (s >> (bw - 1))
+    {
+      s = ~s & mask;
+      t = ~t & mask;
+    }
+    kind = BZLA_BV_SHIFT_SRL;
+  }
+
+  if (kind == BZLA_BV_SHIFT_SLL)
+  {
+    cnt_s = bzla_util_uint64_ctz(s, bw);
+    cnt_t = bzla_util_uint64_ctz(t, bw);
+    if (cnt_s > cnt_t) return false;
+    return t == 0 || ((s << (cnt_t - cnt_s)) & mask) == t;
+  }
+  cnt_s = bzla_util_uint64_clz(s, bw);
+  cnt_t = bzla_util_uint64_clz(t, bw);
+  if (cnt_s > cnt_t) return false;
+  return t == 0 || (s >> (cnt_t - cnt_s)) == t;
+}
+
 bool
 bzla_is_inv_sll(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  if (bzla_bv_get_width(pi->target_value) <= 64)
+    return is_inv_shift_uint64(pi, BZLA_BV_SHIFT_SLL);
+  return is_inv_shift(bzla, pi, BZLA_BV_SHIFT_SLL);
+}
+
+bool
+bzla_is_inv_sll_generic(Bzla *bzla, BzlaPropInfo *pi)
 {
   assert(bzla);
   assert(pi);
@@ -345,6 +423,16 @@ bzla_is_inv_sll(Bzla *bzla, BzlaPropInfo *pi)
 
 bool
 bzla_is_inv_srl(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  if (bzla_bv_get_width(pi->target_value) <= 64)
+    return is_inv_shift_uint64(pi, BZLA_BV_SHIFT_SRL);
+  return is_inv_shift(bzla, pi, BZLA_BV_SHIFT_SRL);
+}
+
+bool
+bzla_is_inv_srl_generic(Bzla *bzla, BzlaPropInfo *pi)
 {
   assert(bzla);
   assert(pi);
@@ -353,6 +441,16 @@ bzla_is_inv_srl(Bzla *bzla, BzlaPropInfo *pi)
 
 bool
 bzla_is_inv_sra(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  if (bzla_bv_get_width(pi->target_value) <= 64)
+    return is_inv_shift_uint64(pi, BZLA_BV_SHIFT_SRA);
+  return is_inv_shift(bzla, pi, BZLA_BV_SHIFT_SRA);
+}
+
+bool
+bzla_is_inv_sra_generic(Bzla *bzla, BzlaPropInfo *pi)
 {
   assert(bzla);
   assert(pi);
@@ -71,6 +71,16 @@ bool bzla_is_inv_sext(Bzla *bzla, BzlaPropInfo *pi);
 /** Check invertibility of x ^ s = t when solved for x. */
 bool bzla_is_inv_xor(Bzla *bzla, BzlaPropInfo *pi);
 
+/**
+ * Generic (GMP-based) versions of the invertibility checks for x * s, x << s,
+ * x >> s and x >>a s. For bit-widths <= 64, the checks above dispatch to
+ * implementations on uint64_t instead.
+ */
+bool bzla_is_inv_mul_generic(Bzla *bzla, BzlaPropInfo *pi);
+bool bzla_is_inv_sll_generic(Bzla *bzla, BzlaPropInfo *pi);
+bool bzla_is_inv_srl_generic(Bzla *bzla, BzlaPropInfo *pi);
+bool bzla_is_inv_sra_generic(Bzla *bzla, BzlaPropInfo *pi);
+
 /* -------------------------------------------------------------------------- */
 /* Check invertibility while considering constant bits in x.                  */
 /* -------------------------------------------------------------------------- */
@@ -66,6 +66,121 @@ update_roots_table(Bzla *bzla,
   }
 }
 
+/* Push 'n' onto binary min-heap 'heap' (ordered by node id). */
+static void
+push_heap(BzlaNodePtrStack *heap, BzlaNode *n)
+{
+  size_t i, p;
+
+  BZLA_PUSH_STACK(*heap, n);
+  i = BZLA_COUNT_STACK(*heap) - 1;
+  while (i > 0)
+  {
+    p = (i - 1) / 2;
+    if (heap->start[p]->id <= n->id) break;
+    heap->start[i] = heap->start[p];
+    i              = p;
+  }
+  heap->start[i] = n;
+}
+
+/* Pop the node with the smallest id from binary min-heap 'heap'. */
+static BzlaNode *
+pop_heap(BzlaNodePtrStack *heap)
+{
+  assert(!BZLA_EMPTY_STACK(*heap));
+
+  size_t i, c, n;
+  BzlaNode *res, *last;
+
+  res  = heap->start[0];
+  last = BZLA_POP_STACK(*heap);
+  n    = BZLA_COUNT_STACK(*heap);
+  if (n == 0) return res;
+
+  i = 0;
+  while ((c = 2 * i + 1) < n)
+  {
+    if (c + 1 < n && heap->start[c + 1]->id < heap->start[c]->id) c++;
+    if (last->id <= heap->start[c]->id) break;
+    heap->start[i] = heap->start[c];
+    i              = c;
+  }
+  heap->start[i] = last;
+  return res;
+}
+
+/* Queue the parents of 'exp' for recomputation (once per cone update). If
+ * the assignment of 'exp' changed, the assignment and score of all parents is
+ * recomputed. Else only its score changed, which only affects the score of
+ * Boolean AND parents (see bzla_slsutils_compute_score_node). 'queued' maps
+ * queued nodes to 1 if their assignment must be recomputed, else 0. */
+static void
+push_parents(Bzla *bzla,
+             BzlaNodePtrStack *heap,
+             BzlaIntHashTable *queued,
+             BzlaNode *exp,
+             bool assignment_changed)
+{
+  BzlaNode *parent;
+  BzlaNodeIterator it;
+  BzlaHashTableData *d;
+
+  bzla_iter_parent_init(&it, exp);
+  while (bzla_iter_parent_has_next(&it))
+  {
+    parent = bzla_iter_parent_next(&it);
+    assert(bzla_node_is_regular(parent));
+    if (bzla_node_is_fun(parent) || bzla_node_is_args(parent)
+        || parent->parameterized)
+      continue;
+    if (!assignment_changed
+        && (!bzla_node_is_bv_and(parent)
+            || bzla_node_bv_get_width(bzla, parent) != 1))
+      continue;
+    if ((d = bzla_hashint_map_get(queued, parent->id)))
+    {
+      d->as_int |= assignment_changed;
+      continue;
+    }
+    bzla_hashint_map_add(queued, parent->id)->as_int = assignment_changed;
+    push_heap(heap, parent);
+  }
+}
+
+/* Recompute the score of 'exp' and its negation. Returns true if any of
+ * them changed. */
+static bool
+update_score(Bzla *bzla,
+             BzlaIntHashTable *bv_model,
+             BzlaIntHashTable *score,
+             BzlaNode *exp)
+{
+  double s, old;
+  int32_t id;
+  bool res;
+  BzlaHashTableData *d;
+
+  id = bzla_node_get_id(exp);
+
+  d   = bzla_hashint_map_get(score, id);
+  old = d->as_dbl;
+  s   = bzla_slsutils_compute_score_node(
+      bzla, bv_model, bzla->fun_model, score, exp);
+  bzla_hashint_map_get(score, id)->as_dbl = s;
+  res                                     = s != old;
+
+  assert(bzla_hashint_map_contains(score, -id));
+  d   = bzla_hashint_map_get(score, -id);
+  old = d->as_dbl;
+  s   = bzla_slsutils_compute_score_node(
+      bzla, bv_model, bzla->fun_model, score, bzla_node_invert(exp));
+  bzla_hashint_map_get(score, -id)->as_dbl = s;
+  res |= s != old;
+
+  return res;
+}
+
 /**
  * Update cone of influence.
  *
@@ -105,15 +220,14 @@ bzla_lsutils_update_cone(Bzla *bzla,
   assert(time_update_cone_reset);
   assert(time_update_cone_model_gen);
 
-  double start, delta;
-  uint32_t i, j;
-  int32_t id;
+  bool changed, score_changed;
+  double start, delta, sdelta, stime;
+  uint32_t j;
   BzlaNode *exp, *cur;
-  BzlaNodeIterator nit;
   BzlaIntHashTableIterator iit;
   BzlaHashTableData *d;
-  BzlaNodePtrStack stack, cone;
-  BzlaIntHashTable *cache;
+  BzlaNodePtrStack heap;
+  BzlaIntHashTable *queued;
   BzlaBitVector *bv, *e[BZLA_NODE_MAX_CHILDREN], *ass;
   BzlaMemMgr *mm;
 
@@ -140,60 +254,32 @@ bzla_lsutils_update_cone(Bzla *bzla,
   }
 #endif
 
-  /* reset cone ----------------------------------------------------------- */
-
-  BZLA_INIT_STACK(mm, cone);
-  BZLA_INIT_STACK(mm, stack);
-  bzla_iter_hashint_init(&iit, exps);
-  while (bzla_iter_hashint_has_next(&iit))
-  {
-    exp = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&iit));
-    assert(bzla_node_is_regular(exp));
-    assert(bzla_lsutils_is_leaf_node(exp));
-    BZLA_PUSH_STACK(stack, exp);
-  }
-  cache = bzla_hashint_table_new(mm);
-  while (!BZLA_EMPTY_STACK(stack))
-  {
-    cur = BZLA_POP_STACK(stack);
-    assert(bzla_node_is_regular(cur));
-
-    if (bzla_node_is_fun(cur) || bzla_node_is_args(cur) || cur->parameterized)
-      continue;
-
-    if (bzla_hashint_table_contains(cache, cur->id)) continue;
-    bzla_hashint_table_add(cache, cur->id);
-    if (!bzla_hashint_table_contains(exps, cur->id)) BZLA_PUSH_STACK(cone, cur);
-    *stats_updates += 1;
-
-    /* push parents */
-    bzla_iter_parent_init(&nit, cur);
-    while (bzla_iter_parent_has_next(&nit))
-      BZLA_PUSH_STACK(stack, bzla_iter_parent_next(&nit));
-  }
-  BZLA_RELEASE_STACK(stack);
-  bzla_hashint_table_delete(cache);
-
-  *time_update_cone_reset += bzla_util_time_stamp() - delta;
-
   /* update assignment and score of exps ----------------------------------- */
 
+  BZLA_INIT_STACK(mm, heap);
+  queued = bzla_hashint_map_new(mm);
+
   bzla_iter_hashint_init(&iit, exps);
   while (bzla_iter_hashint_has_next(&iit))
   {
     ass = (BzlaBitVector *) exps->data[iit.cur_pos].as_ptr;
     exp = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&iit));
+    assert(bzla_node_is_regular(exp));
+    assert(bzla_lsutils_is_leaf_node(exp));
 
     /* update model */
     d = bzla_hashint_map_get(bv_model, exp->id);
     assert(d);
+    changed = bzla_bv_compare(d->as_ptr, ass) != 0;
     if (update_roots
         && (exp->constraint || bzla_hashptr_table_get(bzla->assumptions, exp)
             || bzla_hashptr_table_get(bzla->assumptions, bzla_node_invert(exp)))
-        && bzla_bv_compare(d->as_ptr, ass))
+        && changed)
     {
       /* old assignment != new assignment */
       update_roots_table(bzla, roots, exp, ass);
+      /* model queries in debug mode may add entries */
+      d = bzla_hashint_map_get(bv_model, exp->id);
     }
     bzla_bv_free(mm, d->as_ptr);
     d->as_ptr = bzla_bv_copy(mm, ass);
@@ -202,36 +288,54 @@ bzla_lsutils_update_cone(Bzla *bzla,
       bzla_bv_free(mm, d->as_ptr);
       d->as_ptr = bzla_bv_not(mm, ass);
     }
+    *stats_updates += 1;
 
     /* update score */
+    score_changed = false;
     if (score && bzla_node_bv_get_width(bzla, exp) == 1)
     {
       assert(bzla_hashint_map_contains(score, bzla_node_get_id(exp)));
-      bzla_hashint_map_get(score, bzla_node_get_id(exp))->as_dbl =
-          bzla_slsutils_compute_score_node(
-              bzla, bv_model, bzla->fun_model, score, exp);
-
-      assert(bzla_hashint_map_contains(score, -bzla_node_get_id(exp)));
-      bzla_hashint_map_get(score, -bzla_node_get_id(exp))->as_dbl =
-          bzla_slsutils_compute_score_node(
-              bzla, bv_model, bzla->fun_model, score, bzla_node_invert(exp));
+      score_changed = update_score(bzla, bv_model, score, exp);
     }
+
+    if (changed || score_changed)
+      push_parents(bzla, &heap, queued, exp, changed);
   }
 
-  qsort(cone.start,
-        BZLA_COUNT_STACK(cone),
-        sizeof(BzlaNode *),
-        bzla_node_compare_by_id_qsort_asc);
+  *time_update_cone_reset += bzla_util_time_stamp() - delta;
+
+  /* update model and score of cone ---------------------------------------- */
 
-  /* update model of cone ------------------------------------------------- */
+  /* Only changes are propagated: the assignment of a node is only
+   * recomputed if the assignment of one of its children changed, its score
+   * only if its assignment or the score of a child it depends on changed.
+   * Propagation stops at nodes where neither changed. Nodes are processed in
+   * ascending id order, i.e., all children of a node are up-to-date when the
+   * node is recomputed. */
 
   delta = bzla_util_time_stamp();
+  stime = 0;
 
-  for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
+  while (!BZLA_EMPTY_STACK(heap))
   {
-    cur = BZLA_PEEK_STACK(cone, i);
-
+    cur = pop_heap(&heap);
     assert(bzla_node_is_regular(cur));
+
+    if (bzla_hashint_table_contains(exps, cur->id)) continue;
+
+    /* only the score of 'cur' is affected (if it has one) */
+    if (!bzla_hashint_map_get(queued, cur->id)->as_int)
+    {
+      assert(score);
+      assert(bzla_node_is_bv_and(cur));
+      if (!bzla_hashint_map_contains(score, bzla_node_get_id(cur))) continue;
+      sdelta = bzla_util_time_stamp();
+      if (update_score(bzla, bv_model, score, cur))
+        push_parents(bzla, &heap, queued, cur, false);
+      stime += bzla_util_time_stamp() - sdelta;
+      continue;
+    }
+
     for (j = 0; j < cur->arity; j++)
     {
       if (bzla_node_is_bv_const(cur->e[j]))
@@ -275,78 +379,71 @@ bzla_lsutils_update_cone(Bzla *bzla,
         bv = bzla_bv_is_true(e[0]) ? bzla_bv_copy(mm, e[1])
                                    : bzla_bv_copy(mm, e[2]);
     }
+    for (j = 0; j < cur->arity; j++) bzla_bv_free(mm, e[j]);
+    *stats_updates += 1;
 
     /* update assignment */
 
-    d = bzla_hashint_map_get(bv_model, cur->id);
+    d       = bzla_hashint_map_get(bv_model, cur->id);
+    changed = !d || bzla_bv_compare(d->as_ptr, bv) != 0;
 
-    /* update roots table */
-    if (update_roots
-        && (cur->constraint || bzla_hashptr_table_get(bzla->assumptions, cur)
-            || bzla_hashptr_table_get(bzla->assumptions,
-                                      bzla_node_invert(cur))))
+    if (changed)
     {
-      assert(d); /* must be contained, is root */
-      /* old assignment != new assignment */
-      if (bzla_bv_compare(d->as_ptr, bv))
+      /* update roots table */
+      if (update_roots
+          && (cur->constraint || bzla_hashptr_table_get(bzla->assumptions, cur)
+              || bzla_hashptr_table_get(bzla->assumptions,
+                                        bzla_node_invert(cur))))
+      {
+        assert(d); /* must be contained, is root */
         update_roots_table(bzla, roots, cur, bv);
-    }
+        d = bzla_hashint_map_get(bv_model, cur->id);
+      }
 
-    /* update assignments */
-    /* Note: generate model enabled branch for ite (and does not generate
-     *       model for nodes in the branch, hence !b may happen */
-    if (!d)
-    {
-      bzla_node_copy(bzla, cur);
-      bzla_hashint_map_add(bv_model, cur->id)->as_ptr = bv;
+      /* update assignments */
+      /* Note: generate model enabled branch for ite (and does not generate
+       *       model for nodes in the branch, hence !b may happen */
+      if (!d)
+      {
+        bzla_node_copy(bzla, cur);
+        bzla_hashint_map_add(bv_model, cur->id)->as_ptr = bv;
+      }
+      else
+      {
+        bzla_bv_free(mm, d->as_ptr);
+        d->as_ptr = bv;
+      }
+
+      if ((d = bzla_hashint_map_get(bv_model, -cur->id)))
+      {
+        bzla_bv_free(mm, d->as_ptr);
+        d->as_ptr = bzla_bv_not(mm, bv);
+      }
     }
     else
     {
-      bzla_bv_free(mm, d->as_ptr);
-      d->as_ptr = bv;
+      bzla_bv_free(mm, bv);
     }
 
-    if ((d = bzla_hashint_map_get(bv_model, -cur->id)))
+    /* update score (nodes not reachable from the roots have no score) */
+    score_changed = false;
+    if (score && bzla_node_bv_get_width(bzla, cur) == 1
+        && bzla_hashint_map_contains(score, bzla_node_get_id(cur)))
     {
-      bzla_bv_free(mm, d->as_ptr);
-      d->as_ptr = bzla_bv_not(mm, bv);
+      sdelta        = bzla_util_time_stamp();
+      score_changed = update_score(bzla, bv_model, score, cur);
+      stime += bzla_util_time_stamp() - sdelta;
     }
-    /* cleanup */
-    for (j = 0; j < cur->arity; j++) bzla_bv_free(mm, e[j]);
-  }
-  *time_update_cone_model_gen += bzla_util_time_stamp() - delta;
-
-  /* update score of cone ------------------------------------------------- */
-
-  if (score)
-  {
-    delta = bzla_util_time_stamp();
-    for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
-    {
-      cur = BZLA_PEEK_STACK(cone, i);
-      assert(bzla_node_is_regular(cur));
 
-      if (bzla_node_bv_get_width(bzla, cur) != 1) continue;
-
-      id = bzla_node_get_id(cur);
-      if (!bzla_hashint_map_contains(score, id))
-      {
-        /* not reachable from the roots */
-        assert(!bzla_hashint_map_contains(score, -id));
-        continue;
-      }
-      bzla_hashint_map_get(score, id)->as_dbl =
-          bzla_slsutils_compute_score_node(
-              bzla, bv_model, bzla->fun_model, score, cur);
-      assert(bzla_hashint_map_contains(score, -id));
-      bzla_hashint_map_get(score, -id)->as_dbl =
-          bzla_slsutils_compute_score_node(
-              bzla, bv_model, bzla->fun_model, score, bzla_node_invert(cur));
-    }
-    *time_update_cone_compute_score += bzla_util_time_stamp() - delta;
+    if (changed || score_changed)
+      push_parents(bzla, &heap, queued, cur, changed);
   }
+  /* score computation is accounted for separately */
+  *time_update_cone_model_gen += bzla_util_time_stamp() - delta - stime;
+  *time_update_cone_compute_score += stime;
 
-  BZLA_RELEASE_STACK(cone);
+  bzla_hashint_map_delete(queued);
+  BZLA_RELEASE_STACK(heap);
 
 #ifndef NDEBUG
   bzla_iter_hashptr_init(&pit, bzla->unsynthesized_constraints);
@@ -374,23 +471,26 @@ bzla_lsutils_is_leaf_node(BzlaNode *n)
 
 /**
  * Initialize model values for inputs (var, apply, feq) based on previous
- * model or zero-initialize if no previous model exists.
+ * model, or on the given warm start assignment if no previous model exists,
+ * or zero-initialize if neither contains a value for an input.
  */
 void
-bzla_lsutils_initialize_bv_model(BzlaSolver *slv)
+bzla_lsutils_initialize_bv_model(BzlaSolver *slv, BzlaIntHashTable *warm_model)
 {
   size_t i;
   Bzla *bzla;
   BzlaMemMgr *mm;
   BzlaNode *cur;
   BzlaIntHashTable *bv_model = 0, *cur_bv_model;
+  BzlaHashTableData *d;
   BzlaBitVector *cur_value;
 
   bzla         = slv->bzla;
   mm           = bzla->mm;
   cur_bv_model = slv->bzla->bv_model;
 
-  bzla_model_init_bv(bzla, &bv_model);
+  /* the model covers all nodes during local search, store it densely */
+  bv_model = bzla_hashint_map_new_dense(mm);
 
   for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); ++i)
   {
@@ -403,6 +503,12 @@ bzla_lsutils_initialize_bv_model(BzlaSolver *slv)
         cur_value = bzla_bv_copy(
             mm, bzla_hashint_map_get(cur_bv_model, cur->id)->as_ptr);
       }
+      else if (warm_model && (d = bzla_hashint_map_get(warm_model, cur->id)))
+      {
+        assert(bzla_bv_get_width(d->as_ptr)
+               == bzla_node_bv_get_width(bzla, cur));
+        cur_value = bzla_bv_copy(mm, d->as_ptr);
+      }
       else
       {
         cur_value = bzla_bv_zero(mm, bzla_node_bv_get_width(bzla, cur));
@@ -420,3 +526,26 @@ bzla_lsutils_initialize_bv_model(BzlaSolver *slv)
   bzla_model_delete_bv(bzla, &bzla->bv_model);
   bzla->bv_model = bv_model;
 }
+
+void
+bzla_lsutils_save_bv_model(Bzla *bzla, BzlaIntHashTable **warm_model)
+{
+  assert(bzla);
+  assert(warm_model);
+
+  BzlaNode *cur;
+  BzlaBitVector *bv;
+  BzlaIntHashTableIterator it;
+
+  if (!bzla->bv_model || !bzla->bv_model->count) return;
+
+  bzla_model_init_bv(bzla, warm_model);
+  bzla_iter_hashint_init(&it, bzla->bv_model);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    bv  = bzla->bv_model->data[it.cur_pos].as_ptr;
+    cur = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&it));
+    if (bzla_lsutils_is_leaf_node(cur))
+      bzla_model_add_to_bv(bzla, *warm_model, cur, bv);
+  }
+}
@@ -37,6 +37,15 @@ void bzla_lsutils_update_cone(Bzla* bzla,
 
 bool bzla_lsutils_is_leaf_node(BzlaNode* n);
 
-void bzla_lsutils_initialize_bv_model(BzlaSolver* slv);
+void bzla_lsutils_initialize_bv_model(BzlaSolver* slv,
+                                      BzlaIntHashTable* warm_model);
+
+/**
+ * Save the values of inputs (var, apply, feq) in the current model to
+ * 'warm_model' (replacing its previous content), such that subsequent
+ * incremental calls can start local search from this assignment
+ * (BZLA_OPT_LS_WARM_START). Keeps 'warm_model' if there is no current model.
+ */
+void bzla_lsutils_save_bv_model(Bzla* bzla, BzlaIntHashTable** warm_model);
 
 #endif
@@ -59,27 +59,34 @@ BZLA_DECLARE_STACK(BzlaOption, BzlaOption);
 
 static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_AIGPROP_NPROPS]          = BITWUZLA_OPT_AIGPROP_NPROPS,
+    [BZLA_OPT_AIGPROP_THREADS]         = BITWUZLA_OPT_AIGPROP_THREADS,
     [BZLA_OPT_AIGPROP_USE_BANDIT]      = BITWUZLA_OPT_AIGPROP_USE_BANDIT,
     [BZLA_OPT_AIGPROP_USE_RESTARTS]    = BITWUZLA_OPT_AIGPROP_USE_RESTARTS,
+    [BZLA_OPT_AIGPROP_USE_SIM]         = BITWUZLA_OPT_AIGPROP_USE_SIM,
     [BZLA_OPT_CHECK_MODEL]             = BITWUZLA_OPT_CHECK_MODEL,
     [BZLA_OPT_CHECK_UNCONSTRAINED]     = BITWUZLA_OPT_CHECK_UNCONSTRAINED,
     [BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS] = BITWUZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
     [BZLA_OPT_DECLSORT_BV_WIDTH]       = BITWUZLA_OPT_DECLSORT_BV_WIDTH,
     [BZLA_OPT_ENGINE]                  = BITWUZLA_OPT_ENGINE,
     [BZLA_OPT_EXIT_CODES]              = BITWUZLA_OPT_EXIT_CODES,
+    [BZLA_OPT_FUN_BETA_CACHE_SIZE]     = BITWUZLA_OPT_FUN_BETA_CACHE_SIZE,
     [BZLA_OPT_FUN_DUAL_PROP]           = BITWUZLA_OPT_FUN_DUAL_PROP,
     [BZLA_OPT_FUN_DUAL_PROP_QSORT]     = BITWUZLA_OPT_FUN_DUAL_PROP_QSORT,
     [BZLA_OPT_FUN_EAGER_LEMMAS]        = BITWUZLA_OPT_FUN_EAGER_LEMMAS,
     [BZLA_OPT_FUN_JUST]                = BITWUZLA_OPT_FUN_JUST,
     [BZLA_OPT_FUN_JUST_HEURISTIC]      = BITWUZLA_OPT_FUN_JUST_HEURISTIC,
+    [BZLA_OPT_FUN_LAZY_EXT]            = BITWUZLA_OPT_FUN_LAZY_EXT,
     [BZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BZLA_OPT_FUN_PREPROP]             = BITWUZLA_OPT_FUN_PREPROP,
     [BZLA_OPT_FUN_PRESLS]              = BITWUZLA_OPT_FUN_PRESLS,
+    [BZLA_OPT_FUN_PROP_THREADS]        = BITWUZLA_OPT_FUN_PROP_THREADS,
     [BZLA_OPT_FUN_STORE_LAMBDAS]       = BITWUZLA_OPT_FUN_STORE_LAMBDAS,
+    [BZLA_OPT_FUN_WEAK_EQ_PATHS]       = BITWUZLA_OPT_FUN_WEAK_EQ_PATHS,
     [BZLA_OPT_INCREMENTAL]             = BITWUZLA_OPT_INCREMENTAL,
     [BZLA_OPT_INPUT_FORMAT]            = BITWUZLA_OPT_INPUT_FORMAT,
     [BZLA_OPT_LOGLEVEL]                = BITWUZLA_OPT_LOGLEVEL,
     [BZLA_OPT_LS_SHARE_SAT]            = BITWUZLA_OPT_LS_SHARE_SAT,
+    [BZLA_OPT_LS_WARM_START]           = BITWUZLA_OPT_LS_WARM_START,
     [BZLA_OPT_OUTPUT_FORMAT]           = BITWUZLA_OPT_OUTPUT_FORMAT,
     [BZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BZLA_OPT_PARSE_INTERACTIVE]       = BITWUZLA_OPT_PARSE_INTERACTIVE,
@@ -101,6 +108,8 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PRODUCE_UNSAT_CORES] = BITWUZLA_OPT_PRODUCE_UNSAT_CORES,
     [BZLA_OPT_PROP_CONST_BITS]     = BITWUZLA_OPT_PROP_CONST_BITS,
     [BZLA_OPT_PROP_CONST_DOMAINS]  = BITWUZLA_OPT_PROP_CONST_DOMAINS,
+    [BZLA_OPT_PROP_CONST_DOMAINS_LIMIT] =
+        BITWUZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
     [BZLA_OPT_PROP_ENTAILED]       = BITWUZLA_OPT_PROP_ENTAILED,
     [BZLA_OPT_PROP_FLIP_COND_CONST_DELTA] =
         BITWUZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
@@ -111,6 +120,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PROP_NPROPS]              = BITWUZLA_OPT_PROP_NPROPS,
     [BZLA_OPT_PROP_NUPDATES]            = BITWUZLA_OPT_PROP_NUPDATES,
     [BZLA_OPT_PROP_PATH_SEL]            = BITWUZLA_OPT_PROP_PATH_SEL,
+    [BZLA_OPT_PROP_PORTFOLIO]           = BITWUZLA_OPT_PROP_PORTFOLIO,
     [BZLA_OPT_PROP_PROB_AND_FLIP]       = BITWUZLA_OPT_PROP_PROB_AND_FLIP,
     [BZLA_OPT_PROP_PROB_EQ_FLIP]        = BITWUZLA_OPT_PROP_PROB_EQ_FLIP,
     [BZLA_OPT_PROP_PROB_FALLBACK_RANDOM_VALUE] =
@@ -128,6 +138,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PROP_USE_BANDIT]          = BITWUZLA_OPT_PROP_USE_BANDIT,
     [BZLA_OPT_PROP_USE_INV_LT_CONCAT]   = BITWUZLA_OPT_PROP_USE_INV_LT_CONCAT,
     [BZLA_OPT_PROP_USE_RESTARTS]        = BITWUZLA_OPT_PROP_USE_RESTARTS,
+    [BZLA_OPT_PROP_VALUE_CACHE]         = BITWUZLA_OPT_PROP_VALUE_CACHE,
     [BZLA_OPT_PROP_XOR]                 = BITWUZLA_OPT_PROP_XOR,
     [BZLA_OPT_QUANT_CER]                = BITWUZLA_OPT_QUANT_CER,
     [BZLA_OPT_QUANT_DER]                = BITWUZLA_OPT_QUANT_DER,
@@ -150,8 +161,15 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_SAT_ENGINE]               = BITWUZLA_OPT_SAT_ENGINE,
     [BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE] =
         BITWUZLA_OPT_SAT_ENGINE_CADICAL_FREEZE,
+    [BZLA_OPT_SAT_ENGINE_CALL_STATS] = BITWUZLA_OPT_SAT_ENGINE_CALL_STATS,
+    [BZLA_OPT_SAT_ENGINE_COMPACT]    = BITWUZLA_OPT_SAT_ENGINE_COMPACT,
+    [BZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES] =
+        BITWUZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES,
+    [BZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES] =
+        BITWUZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES,
     [BZLA_OPT_SAT_ENGINE_LGL_FORK]     = BITWUZLA_OPT_SAT_ENGINE_LGL_FORK,
     [BZLA_OPT_SAT_ENGINE_N_THREADS]    = BITWUZLA_OPT_SAT_ENGINE_N_THREADS,
+    [BZLA_OPT_SAT_ENGINE_PHASES]       = BITWUZLA_OPT_SAT_ENGINE_PHASES,
     [BZLA_OPT_SEED]                    = BITWUZLA_OPT_SEED,
     [BZLA_OPT_SLS_JUST]                = BITWUZLA_OPT_SLS_JUST,
     [BZLA_OPT_SLS_MOVE_GW]             = BITWUZLA_OPT_SLS_MOVE_GW,
@@ -168,6 +186,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_SLS_NFLIPS]              = BITWUZLA_OPT_SLS_NFLIPS,
     [BZLA_OPT_SLS_PROB_MOVE_RAND_WALK] = BITWUZLA_OPT_SLS_PROB_MOVE_RAND_WALK,
     [BZLA_OPT_SLS_STRATEGY]            = BITWUZLA_OPT_SLS_STRATEGY,
+    [BZLA_OPT_SLS_THREADS]             = BITWUZLA_OPT_SLS_THREADS,
     [BZLA_OPT_SLS_USE_BANDIT]          = BITWUZLA_OPT_SLS_USE_BANDIT,
     [BZLA_OPT_SLS_USE_RESTARTS]        = BITWUZLA_OPT_SLS_USE_RESTARTS,
     [BZLA_OPT_SMT_COMP_MODE]           = BITWUZLA_OPT_SMT_COMP_MODE,
@@ -531,7 +550,7 @@ bzlamain_opt_has_str_arg(const char *opt, BzlaOpt *bzla_opts)
   {
     if (((bzla_opts[i].shrt && strcmp(opt, bzla_opts[i].shrt) == 0)
          || strcmp(opt, bzla_opts[i].lng) == 0)
-        && bzla_opts[i].options)
+        && (bzla_opts[i].options || bzla_opts[i].isstr))
       return true;
   }
   return false;
@@ -743,7 +762,13 @@ print_opt(BitwuzlaMainApp *app,
 
   if (!strcmp(lng, "time"))
     sprintf(paramstr, "<seconds>");
-  else if (!strcmp(lng, "output"))
+  else if (!strcmp(lng, "output")
+           || !strcmp(lng,
+                      bzla_opt_get_lng(app->bzla,
+                                       BZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES))
+           || !strcmp(lng,
+                      bzla_opt_get_lng(app->bzla,
+                                       BZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES)))
     sprintf(paramstr, "<file>");
   else if (!strcmp(lng, bzla_opt_get_lng(app->bzla, BZLA_OPT_ENGINE))
            || !strcmp(lng, bzla_opt_get_lng(app->bzla, BZLA_OPT_SAT_ENGINE)))
@@ -972,7 +997,7 @@ print_help(BitwuzlaMainApp *app, bool include_expert_opts)
         get_opt_val_string(bzla->options[o].options, bzla->options[o].dflt),
         s,
         bzla->options[o].desc,
-        true);
+        !bzla->options[o].isstr);
     if (s) bzla_mem_freestr(app->mm, s);
     if (o == BZLA_OPT_AUTO_CLEANUP || o == BZLA_OPT_PP_BETA_REDUCE
         || o == BZLA_OPT_INCREMENTAL || o == BZLA_OPT_INPUT_FORMAT
@@ -1357,16 +1382,20 @@ bitwuzla_main(int32_t argc, char **argv)
         bzlamain_error(g_app, "invalid option '%s'", po->orig.start);
         goto DONE;
       }
-      if ((bo->options
+      if (((bo->options || bo->isstr)
            && BZLA_ARG_IS_MISSING(BZLA_ARG_EXPECT_STR, bo->isflag, po->readval))
-          || (!bo->options
+          || (!bo->options && !bo->isstr
               && BZLA_ARG_IS_MISSING(
                   BZLA_ARG_EXPECT_INT, bo->isflag, po->readval)))
       {
         bzlamain_error(g_app, "missing argument for '%s'", po->orig.start);
         goto DONE;
       }
-      if (bo->options)
+      if (bo->isstr)
+      {
+        bitwuzla_set_option_str(bitwuzla, bitwuzla_options[bopt], po->valstr);
+      }
+      else if (bo->options)
       {
         if (strcmp(po->valstr, "help") == 0)
         {
@@ -26,6 +26,7 @@
 #include "bzlalog.h"
 #include "bzlarewrite.h"
 #include "bzlarm.h"
+#include "bzlastoreidx.h"
 #include "utils/bzlaabort.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
@@ -1118,6 +1119,7 @@ erase_local_data_exp(Bzla *bzla, BzlaNode *exp)
     case BZLA_LAMBDA_NODE:
     case BZLA_UPDATE_NODE:
     case BZLA_UF_NODE:
+      if (exp->kind != BZLA_UF_NODE) bzla_store_index_remove(bzla, exp);
       if (exp->kind == BZLA_LAMBDA_NODE)
       {
         static_rho = bzla_node_lambda_get_static_rho(exp);
@@ -1152,6 +1154,7 @@ erase_local_data_exp(Bzla *bzla, BzlaNode *exp)
 
   if (exp->av)
   {
+    bzla_aig_mgr_unref_frozen(bzla->avmgr->amgr, exp->av->aigs, exp->av->width);
     bzla_aigvec_release_delete(bzla->avmgr, exp->av);
     exp->av = 0;
   }
@@ -83,6 +83,36 @@ init_opt(Bzla *bzla,
   }
 }
 
+static void
+init_opt_str(Bzla *bzla, BzlaOption opt, bool expert, char *lng, char *desc)
+{
+  assert(bzla);
+  assert(opt >= 0 && opt < BZLA_OPT_NUM_OPTS);
+  assert(lng);
+
+  char *valstr;
+
+  assert(!bzla_hashptr_table_get(bzla->str2opt, lng));
+
+  bzla->options[opt].expert = expert;
+  bzla->options[opt].isflag = false;
+  bzla->options[opt].isstr  = true;
+  bzla->options[opt].shrt   = 0;
+  bzla->options[opt].lng    = lng;
+  bzla->options[opt].val    = 0;
+  bzla->options[opt].dflt   = 0;
+  bzla->options[opt].min    = 0;
+  bzla->options[opt].max    = 1;
+  bzla->options[opt].desc   = desc;
+
+  bzla_hashptr_table_add(bzla->str2opt, lng)->data.as_int = opt;
+
+  if ((valstr = bzla_util_getenv_value(bzla->mm, lng)))
+  {
+    bzla_opt_set_str(bzla, opt, valstr);
+  }
+}
+
 static void
 add_opt_help(
     BzlaMemMgr *mm, BzlaPtrHashTable *opts, char *key, int32_t value, char *msg)
@@ -776,6 +806,51 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "represent array store as lambda");
 
+  init_opt(bzla,
+           BZLA_OPT_FUN_WEAK_EQ_PATHS,
+           true,
+           true,
+           "fun-weak-eq-paths",
+           0,
+           0,
+           0,
+           1,
+           "skip stores on weak equivalence index paths during propagation");
+
+  init_opt(bzla,
+           BZLA_OPT_FUN_BETA_CACHE_SIZE,
+           true,
+           true,
+           "fun-beta-cache-size",
+           0,
+           0,
+           0,
+           UINT32_MAX,
+           "memory budget in MB for caching partial beta reduction results "
+           "across refinement rounds (0: disable)");
+
+  init_opt(bzla,
+           BZLA_OPT_FUN_LAZY_EXT,
+           true,
+           true,
+           "fun-lazy-ext",
+           0,
+           0,
+           0,
+           1,
+           "create witnesses for function inequalities on demand");
+
+  init_opt(bzla,
+           BZLA_OPT_FUN_PROP_THREADS,
+           true,
+           true,
+           "fun-prop-threads",
+           0,
+           1,
+           1,
+           UINT32_MAX,
+           "number of threads for detecting function congruence conflicts");
+
   /* SLS engine (expert options) -------------------------------------------- */
   init_opt(bzla,
            BZLA_OPT_SLS_NFLIPS,
@@ -830,6 +905,17 @@ bzla_opt_init_opts(Bzla *bzla)
                "always choose propagation move (and recover with SLS move in "
                "case of conflict)");
   bzla->options[BZLA_OPT_SLS_STRATEGY].options = opts;
+  init_opt(bzla,
+           BZLA_OPT_SLS_THREADS,
+           true,
+           false,
+           "sls-threads",
+           0,
+           1,
+           1,
+           UINT32_MAX,
+           "number of threads used to evaluate candidate moves of flip, "
+           "range and segment moves in parallel");
 
   init_opt(bzla,
            BZLA_OPT_SLS_JUST,
@@ -989,6 +1075,16 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use bandit scheme for constraint selection");
+  init_opt(bzla,
+           BZLA_OPT_AIGPROP_USE_SIM,
+           true,
+           true,
+           "aigprop-use-sim",
+           0,
+           0,
+           0,
+           1,
+           "select (re)start assignments by simulating 64 assignments at once");
 
   /* PROP engine (expert options) ------------------------------------------- */
   init_opt(bzla,
@@ -1060,6 +1156,17 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use domain propagators to determine constant bits");
+  init_opt(bzla,
+           BZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
+           true,
+           false,
+           "prop-const-domains-limit",
+           0,
+           0,
+           0,
+           UINT32_MAX,
+           "number of domain propagator applications used as a limit for "
+           "domain propagation");
 #if 0
   init_opt (bzla,
             BZLA_OPT_PROP_DOMAINS,
@@ -1082,6 +1189,16 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use restarts");
+  init_opt(bzla,
+           BZLA_OPT_PROP_VALUE_CACHE,
+           true,
+           true,
+           "prop-value-cache",
+           0,
+           0,
+           0,
+           1,
+           "cache inverse and consistent values per node");
   init_opt(bzla,
            BZLA_OPT_PROP_USE_BANDIT,
            true,
@@ -1117,6 +1234,18 @@ bzla_opt_init_opts(Bzla *bzla)
                "select path based on random inputs");
   bzla->options[BZLA_OPT_PROP_PATH_SEL].options = opts;
 
+  init_opt(bzla,
+           BZLA_OPT_PROP_PORTFOLIO,
+           true,
+           false,
+           "prop-portfolio",
+           0,
+           1,
+           1,
+           UINT32_MAX,
+           "number of prop engine instances run in parallel with different "
+           "seeds and configurations");
+
   init_opt(bzla,
            BZLA_OPT_PROP_PROB_USE_INV_VALUE,
            true,
@@ -1366,6 +1495,16 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            UINT32_MAX,
            "number of propagation steps used as a limit for aigprop engine");
+  init_opt(bzla,
+           BZLA_OPT_AIGPROP_THREADS,
+           true,
+           false,
+           "aigprop-threads",
+           0,
+           1,
+           1,
+           UINT32_MAX,
+           "number of local search walkers run in parallel by aigprop engine");
 
   /* QUANT engine (expert options) ------------------------------------------ */
   init_opt(bzla,
@@ -1557,6 +1696,16 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "share partial models determined via local search with "
            "bit-blasting engine");
+  init_opt(bzla,
+           BZLA_OPT_LS_WARM_START,
+           true,
+           true,
+           "ls-warm-start",
+           0,
+           1,
+           0,
+           1,
+           "start local search from the last assignment in incremental mode");
   init_opt(bzla,
            BZLA_OPT_SAT_ENGINE_LGL_FORK,
            true,
@@ -1577,6 +1726,38 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use CaDiCaL's freeze/melt");
+  init_opt(bzla,
+           BZLA_OPT_SAT_ENGINE_CALL_STATS,
+           true,
+           true,
+           "sat-engine-call-stats",
+           0,
+           0,
+           0,
+           1,
+           "record statistics of each SAT call and print them as JSON with "
+           "the SAT solver statistics");
+  init_opt(bzla,
+           BZLA_OPT_SAT_ENGINE_COMPACT,
+           true,
+           true,
+           "sat-engine-compact",
+           0,
+           0,
+           0,
+           1,
+           "release AIGs after CNF encoding in non-incremental mode");
+  init_opt_str(bzla,
+               BZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES,
+               true,
+               "sat-engine-export-clauses",
+               "export learned clauses of the SAT solver to given file");
+  init_opt_str(bzla,
+               BZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES,
+               true,
+               "sat-engine-import-clauses",
+               "import learned clauses from given file (see "
+               "--sat-engine-export-clauses)");
   init_opt(bzla,
            BZLA_OPT_SAT_ENGINE_N_THREADS,
            true,
@@ -1587,6 +1768,17 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            UINT32_MAX,
            "number of threads to use in the SAT solver");
+  init_opt(bzla,
+           BZLA_OPT_SAT_ENGINE_PHASES,
+           true,
+           true,
+           "sat-engine-phases",
+           0,
+           0,
+           0,
+           1,
+           "seed SAT solver phases with previous and local search model "
+           "values");
   init_opt(bzla,
            BZLA_OPT_DECLSORT_BV_WIDTH,
            true,
@@ -1918,11 +2110,30 @@ bzla_opt_set_str(Bzla *bzla, const BzlaOption opt, const char *str)
 {
   assert(bzla);
   assert(bzla_opt_is_valid(bzla, opt));
-  assert(opt == BZLA_OPT_SAT_ENGINE);
+  assert(opt == BZLA_OPT_SAT_ENGINE || bzla_opt_is_str_option(bzla, opt));
 
+  if (bzla->options[opt].valstr)
+  {
+    bzla_mem_freestr(bzla->mm, bzla->options[opt].valstr);
+    bzla->options[opt].valstr = 0;
+  }
+  if (bzla_opt_is_str_option(bzla, opt))
+  {
+    /* an empty string unsets the option */
+    bzla->options[opt].val = str && str[0] ? 1 : 0;
+    if (!bzla->options[opt].val) return;
+  }
   bzla->options[opt].valstr = bzla_mem_strdup(bzla->mm, str);
 }
 
+bool
+bzla_opt_is_str_option(const Bzla *bzla, const BzlaOption opt)
+{
+  assert(bzla);
+  assert(bzla_opt_is_valid(bzla, opt));
+  return bzla->options[opt].isstr;
+}
+
 bool
 bzla_opt_is_enum_option(const Bzla *bzla, const BzlaOption opt)
 {
@@ -73,6 +73,10 @@ enum BzlaOption
   BZLA_OPT_FUN_LAZY_SYNTHESIZE,
   BZLA_OPT_FUN_EAGER_LEMMAS,
   BZLA_OPT_FUN_STORE_LAMBDAS,
+  BZLA_OPT_FUN_WEAK_EQ_PATHS,
+  BZLA_OPT_FUN_BETA_CACHE_SIZE,
+  BZLA_OPT_FUN_LAZY_EXT,
+  BZLA_OPT_FUN_PROP_THREADS,
 
   /* SLS engine (expert) */
 
@@ -91,6 +95,7 @@ enum BzlaOption
   BZLA_OPT_SLS_NFLIPS,
   BZLA_OPT_SLS_PROB_MOVE_RAND_WALK,
   BZLA_OPT_SLS_STRATEGY,
+  BZLA_OPT_SLS_THREADS,
   BZLA_OPT_SLS_USE_BANDIT,
   BZLA_OPT_SLS_USE_RESTARTS,
 
@@ -99,6 +104,7 @@ enum BzlaOption
   BZLA_OPT_PROP_ASHR,
   BZLA_OPT_PROP_CONST_BITS,
   BZLA_OPT_PROP_CONST_DOMAINS,
+  BZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
 #if 0
   BZLA_OPT_PROP_DOMAINS,
 #endif
@@ -110,6 +116,7 @@ enum BzlaOption
   BZLA_OPT_PROP_NPROPS,
   BZLA_OPT_PROP_NUPDATES,
   BZLA_OPT_PROP_PATH_SEL,
+  BZLA_OPT_PROP_PORTFOLIO,
   BZLA_OPT_PROP_PROB_AND_FLIP,
   BZLA_OPT_PROP_PROB_EQ_FLIP,
   BZLA_OPT_PROP_PROB_FALLBACK_RANDOM_VALUE,
@@ -124,13 +131,16 @@ enum BzlaOption
   BZLA_OPT_PROP_USE_BANDIT,
   BZLA_OPT_PROP_USE_INV_LT_CONCAT,
   BZLA_OPT_PROP_USE_RESTARTS,
+  BZLA_OPT_PROP_VALUE_CACHE,
   BZLA_OPT_PROP_XOR,
 
   /* Aigprop engine (expert) */
 
   BZLA_OPT_AIGPROP_NPROPS,
+  BZLA_OPT_AIGPROP_THREADS,
   BZLA_OPT_AIGPROP_USE_BANDIT,
   BZLA_OPT_AIGPROP_USE_RESTARTS,
+  BZLA_OPT_AIGPROP_USE_SIM,
 
   /* Quantifier engine (expert) */
   BZLA_OPT_QUANT_CER,
@@ -150,10 +160,16 @@ enum BzlaOption
   BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
   BZLA_OPT_DECLSORT_BV_WIDTH,
   BZLA_OPT_LS_SHARE_SAT,
+  BZLA_OPT_LS_WARM_START,
   BZLA_OPT_PARSE_INTERACTIVE,
   BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE,
+  BZLA_OPT_SAT_ENGINE_CALL_STATS,
+  BZLA_OPT_SAT_ENGINE_COMPACT,
+  BZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES,
+  BZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES,
   BZLA_OPT_SAT_ENGINE_LGL_FORK,
   BZLA_OPT_SAT_ENGINE_N_THREADS,
+  BZLA_OPT_SAT_ENGINE_PHASES,
   BZLA_OPT_SMT_COMP_MODE,
 
   /* this MUST be the last entry! */
@@ -304,6 +320,7 @@ struct BzlaOpt
 {
   bool expert;               /* expert option? */
   bool isflag;               /* flag? */
+  bool isstr;                /* string valued (stored in valstr)? */
   const char *shrt;          /* short option identifier (may be 0) */
   const char *lng;           /* long option identifier */
   const char *desc;          /* description */
@@ -432,6 +449,12 @@ void bzla_opt_set(Bzla *bzla, const BzlaOption opt, uint32_t val);
 void bzla_opt_set_str(Bzla *bzla, const BzlaOption opt, const char *str);
 
 bool bzla_opt_is_enum_option(const Bzla *bzla, const BzlaOption opt);
+/**
+ * Return true if given option expects an arbitrary string (e.g., a file name)
+ * as configuration value.  The value is stored in valstr, and val is 1 if the
+ * option is set and 0 otherwise.
+ */
+bool bzla_opt_is_str_option(const Bzla *bzla, const BzlaOption opt);
 bool bzla_opt_is_enum_option_value(const Bzla *bzla,
                                    const BzlaOption opt,
                                    const char *value);
@@ -5047,7 +5047,7 @@ bzla_proputils_inv_sra(Bzla *bzla, BzlaPropInfo *pi)
 /* -------------------------------------------------------------------------- */
 
 BzlaBitVector *
-bzla_proputils_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
+bzla_proputils_inv_mul_generic(Bzla *bzla, BzlaPropInfo *pi)
 {
 #ifndef NDEBUG
   check_inv_dbg(bzla, pi, bzla_is_inv_mul, bzla_is_inv_mul_const, true);
@@ -5199,6 +5199,54 @@ bzla_proputils_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
   return res;
 }
 
+BzlaBitVector *
+bzla_proputils_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
+{
+  uint32_t i, j, bw;
+  uint64_t s, t, mask, bit, res64;
+  BzlaBitVector *res;
+
+  bw = bzla_bv_get_width(pi->target_value);
+  if (bw > 64) return bzla_proputils_inv_mul_generic(bzla, pi);
+
+#ifndef NDEBUG
+  check_inv_dbg(bzla, pi, bzla_is_inv_mul, bzla_is_inv_mul_const, true);
+#endif
+
+  record_inv_stats(bzla, &BZLA_PROP_SOLVER(bzla)->stats.inv_mul);
+
+  s    = bzla_bv_to_uint64(pi->bv[1 - pi->pos_x]);
+  t    = bzla_bv_to_uint64(pi->target_value);
+  mask = bzla_util_uint64_mask(bw);
+
+  /* Same as bzla_proputils_inv_mul_generic (including the order in which
+   * random values are picked) on uint64_t. With s = 2^n * m, m odd:
+   * res = (t >> n) * m^-1, with the n MSBs of res set randomly. */
+  if (s == 0)
+  {
+    assert(t == 0); /* CONFLICT: s = 0 but t != 0 */
+    res = bzla_bv_new_random(bzla->mm, bzla->rng, bw);
+  }
+  else
+  {
+    j = bzla_util_uint64_ctz(s, bw);
+    /* CONFLICT: number of 0-LSB in t < number of 0-LSB in s */
+    assert(bzla_util_uint64_ctz(t, bw) >= j);
+    res64 = ((t >> j) * bzla_util_uint64_mod_inverse(s >> j, bw)) & mask;
+    for (i = 0; i < j; i++)
+    {
+      bit   = (uint64_t) 1 << (bw - 1 - i);
+      res64 = bzla_rng_pick_rand(bzla->rng, 0, 1) ? res64 | bit : res64 & ~bit;
+    }
+    res = bzla_bv_uint64_to_bv(bzla->mm, res64, bw);
+  }
+
+#ifndef NDEBUG
+  check_result_binary_dbg(bzla, bzla_bv_mul, pi, res, "*");
+#endif
+  return res;
+}
+
 /* -------------------------------------------------------------------------- */
 /* INV: udiv                                                                  */
 /* -------------------------------------------------------------------------- */
@@ -7183,6 +7231,204 @@ static BzlaPropIsInvFun kind_to_is_inv_const[BZLA_NUM_OPS_NODE] = {
     [BZLA_COND_NODE]      = bzla_is_inv_cond_const,
 };
 
+/* ========================================================================== */
+/* Value cache                                                                */
+/* ========================================================================== */
+
+/* Number of cached queries per node (replaced round-robin). */
+#define BZLA_PROP_VALUE_CACHE_ENTRIES 4
+/* Max. number of cached values per query. */
+#define BZLA_PROP_VALUE_CACHE_VALUES 4
+
+/* A cached query for an inverse or consistent value of operand 'pos_x' of a
+ * node, and the values computed for it so far. */
+struct BzlaPropValueCacheEntry
+{
+  BzlaPropComputeValueFun fun;  /* the value computation function */
+  int32_t pos_x;                /* the operand to compute a value for */
+  BzlaBitVector *target_value;  /* the target value */
+  BzlaBitVector *bv[3];         /* the values of the other operands */
+  BzlaBitVector *lo, *hi;       /* the domain of operand 'pos_x' (if any) */
+  BzlaBitVector *values[BZLA_PROP_VALUE_CACHE_VALUES];
+  uint32_t nvalues;
+  /* True if no new values are computed for this query anymore, i.e., if
+   * 'values' is full or a computed value was already cached. */
+  bool saturated;
+};
+
+typedef struct BzlaPropValueCacheEntry BzlaPropValueCacheEntry;
+
+struct BzlaPropValueCache
+{
+  BzlaPropValueCacheEntry entries[BZLA_PROP_VALUE_CACHE_ENTRIES];
+  uint32_t nentries;
+  uint32_t next; /* the entry to replace next */
+};
+
+typedef struct BzlaPropValueCache BzlaPropValueCache;
+
+static void
+value_cache_entry_reset(BzlaMemMgr *mm, BzlaPropValueCacheEntry *e)
+{
+  uint32_t i;
+
+  if (e->target_value) bzla_bv_free(mm, e->target_value);
+  for (i = 0; i < 3; i++)
+  {
+    if (e->bv[i]) bzla_bv_free(mm, e->bv[i]);
+  }
+  if (e->lo) bzla_bv_free(mm, e->lo);
+  if (e->hi) bzla_bv_free(mm, e->hi);
+  for (i = 0; i < e->nvalues; i++) bzla_bv_free(mm, e->values[i]);
+  memset(e, 0, sizeof(BzlaPropValueCacheEntry));
+}
+
+void
+bzla_proputils_value_cache_delete(BzlaMemMgr *mm, BzlaIntHashTable *cache)
+{
+  assert(mm);
+  assert(cache);
+
+  uint32_t i;
+  BzlaPropValueCache *c;
+  BzlaIntHashTableIterator it;
+
+  bzla_iter_hashint_init(&it, cache);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    c = bzla_iter_hashint_next_data(&it)->as_ptr;
+    for (i = 0; i < c->nentries; i++)
+      value_cache_entry_reset(mm, &c->entries[i]);
+    BZLA_DELETE(mm, c);
+  }
+  bzla_hashint_map_delete(cache);
+}
+
+static bool
+value_cache_entry_matches(BzlaPropValueCacheEntry *e,
+                          BzlaPropComputeValueFun fun,
+                          BzlaPropInfo *pi,
+                          int32_t arity)
+{
+  int32_t i;
+  const BzlaBvDomain *d;
+
+  if (e->fun != fun || e->pos_x != pi->pos_x) return false;
+  if (bzla_bv_compare(e->target_value, pi->target_value)) return false;
+  for (i = 0; i < arity; i++)
+  {
+    if (i != pi->pos_x && bzla_bv_compare(e->bv[i], pi->bv[i])) return false;
+  }
+  d = pi->bvd[pi->pos_x];
+  if (!d) return e->lo == 0;
+  return e->lo && !bzla_bv_compare(e->lo, d->lo)
+         && !bzla_bv_compare(e->hi, d->hi);
+}
+
+/**
+ * Compute an inverse or consistent value via 'fun', cached per node.
+ *
+ * Queries are identified by the value computation function, the operand to
+ * compute a value for, the target value, the values of the other operands
+ * and the domain of the operand. Up to BZLA_PROP_VALUE_CACHE_VALUES distinct
+ * values are cached per query. Once a query is saturated, a random value of
+ * its cached values is returned instead of computing a new one.
+ */
+static BzlaBitVector *
+compute_value_cached(Bzla *bzla,
+                     BzlaPropComputeValueFun fun,
+                     BzlaPropInfo *pi,
+                     int32_t arity)
+{
+  assert(bzla);
+  assert(bzla->slv->kind == BZLA_PROP_SOLVER_KIND);
+  assert(fun);
+  assert(pi);
+
+  int32_t i;
+  uint32_t j;
+  BzlaMemMgr *mm;
+  BzlaPropSolver *slv;
+  BzlaHashTableData *d;
+  BzlaPropValueCache *c;
+  BzlaPropValueCacheEntry *e;
+  BzlaBitVector *res;
+
+  mm  = bzla->mm;
+  slv = BZLA_PROP_SOLVER(bzla);
+  assert(slv->value_cache);
+
+  if ((d = bzla_hashint_map_get(slv->value_cache, pi->exp->id)))
+  {
+    c = d->as_ptr;
+  }
+  else
+  {
+    BZLA_CNEW(mm, c);
+    bzla_hashint_map_add(slv->value_cache, pi->exp->id)->as_ptr = c;
+  }
+
+  slv->stats.value_cache_lookups += 1;
+
+  for (j = 0, e = 0; j < c->nentries; j++)
+  {
+    if (value_cache_entry_matches(&c->entries[j], fun, pi, arity))
+    {
+      e = &c->entries[j];
+      break;
+    }
+  }
+
+  if (e && e->saturated)
+  {
+    slv->stats.value_cache_hits += 1;
+    j = bzla_rng_pick_rand(bzla->rng, 0, e->nvalues - 1);
+    return bzla_bv_copy(mm, e->values[j]);
+  }
+
+  res = fun(bzla, pi);
+  if (!res) return 0;
+
+  if (!e)
+  {
+    if (c->nentries < BZLA_PROP_VALUE_CACHE_ENTRIES)
+    {
+      e = &c->entries[c->nentries++];
+    }
+    else
+    {
+      e = &c->entries[c->next];
+      c->next = (c->next + 1) % BZLA_PROP_VALUE_CACHE_ENTRIES;
+      value_cache_entry_reset(mm, e);
+    }
+    e->fun          = fun;
+    e->pos_x        = pi->pos_x;
+    e->target_value = bzla_bv_copy(mm, pi->target_value);
+    for (i = 0; i < arity; i++)
+    {
+      if (i != pi->pos_x) e->bv[i] = bzla_bv_copy(mm, pi->bv[i]);
+    }
+    if (pi->bvd[pi->pos_x])
+    {
+      e->lo = bzla_bv_copy(mm, pi->bvd[pi->pos_x]->lo);
+      e->hi = bzla_bv_copy(mm, pi->bvd[pi->pos_x]->hi);
+    }
+  }
+
+  for (j = 0; j < e->nvalues; j++)
+  {
+    if (!bzla_bv_compare(e->values[j], res))
+    {
+      e->saturated = true;
+      return res;
+    }
+  }
+  assert(e->nvalues < BZLA_PROP_VALUE_CACHE_VALUES);
+  e->values[e->nvalues++] = bzla_bv_copy(mm, res);
+  e->saturated            = e->nvalues == BZLA_PROP_VALUE_CACHE_VALUES;
+  return res;
+}
+
 /* ========================================================================== */
 /* Propagation move                                                           */
 /* ========================================================================== */
@@ -7497,7 +7743,7 @@ bzla_proputils_select_move_prop(Bzla *bzla,
   int32_t i, arity, nconst;
   uint64_t nprops;
   BzlaNode *cur, *real_cur;
-  BzlaIntHashTable *domains;
+  BzlaIntHashTable *domains, *value_cache;
   BzlaHashTableData *d;
   BzlaBitVector *bv_s[BZLA_NODE_MAX_CHILDREN] = {0, 0, 0};
   BzlaBitVector *bv_t, *bv_s_new, *tmp;
@@ -7555,6 +7801,12 @@ bzla_proputils_select_move_prop(Bzla *bzla,
   domains = BZLA_PROP_SOLVER(bzla)->domains;
   assert(domains);
 
+  value_cache = 0;
+  if (bzla->slv->kind == BZLA_PROP_SOLVER_KIND)
+  {
+    value_cache = BZLA_PROP_SOLVER(bzla)->value_cache;
+  }
+
   tmp = (BzlaBitVector *) bzla_model_get_bv(bzla, root);
   if (!bzla_bv_compare(bvroot, tmp))
   {
@@ -7863,7 +8115,14 @@ bzla_proputils_select_move_prop(Bzla *bzla,
 
       /* compute new assignment */
       compute_value_fun = pick_inv && is_inv ? inv_value_fun : cons_value_fun;
-      bv_s_new          = compute_value_fun(bzla, &pi);
+      if (value_cache && !bzla_node_is_cond(real_cur))
+      {
+        bv_s_new = compute_value_cached(bzla, compute_value_fun, &pi, arity);
+      }
+      else
+      {
+        bv_s_new = compute_value_fun(bzla, &pi);
+      }
 
       if (pi.res_x)
       {
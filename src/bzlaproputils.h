@@ -77,6 +77,10 @@ uint64_t bzla_proputils_select_move_prop(Bzla* bzla,
                                          BzlaNode** input,
                                          BzlaBitVector** assignment);
 
+/* Delete the per-node cache of inverse and consistent values (see
+ * BZLA_OPT_PROP_VALUE_CACHE). */
+void bzla_proputils_value_cache_delete(BzlaMemMgr* mm, BzlaIntHashTable* cache);
+
 /*=========================================================================*/
 
 typedef bool (*BzlaPropIsEssFun)(Bzla* bzla, BzlaPropInfo* pi, uint32_t pos_x);
@@ -300,6 +304,13 @@ BzlaBitVector* bzla_proputils_inv_sra(Bzla* bzla, BzlaPropInfo* pi);
  */
 BzlaBitVector* bzla_proputils_inv_mul(Bzla* bzla, BzlaPropInfo* pi);
 
+/**
+ * Generic (GMP-based) version of bzla_proputils_inv_mul, which dispatches to
+ * an implementation on uint64_t for bit-widths <= 64. Both versions yield
+ * the same result for the same state of the random number generator.
+ */
+BzlaBitVector* bzla_proputils_inv_mul_generic(Bzla* bzla, BzlaPropInfo* pi);
+
 /**
  * Determine inverse value for 'x' given 'x / s = t' or 's / x = t'.
  * This inverse value computation does not consider constant bits.
@@ -19,6 +19,7 @@
 #include "bzlaexp.h"
 #include "bzlafp.h"
 #include "bzlalog.h"
+#include "bzlastoreidx.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
 #include "utils/bzlamem.h"
@@ -403,47 +404,6 @@ is_concat_simplifiable(BzlaNode *exp)
   return bzla_node_is_bv_var(exp) || bzla_node_is_bv_const(exp);
 }
 
-static bool
-is_write_exp(BzlaNode *exp,
-             BzlaNode **array,
-             BzlaNode **index,
-             BzlaNode **value)
-{
-  assert(exp);
-  assert(bzla_node_is_regular(exp));
-
-  BzlaNode *param, *body, *eq, *app;
-
-  if (!bzla_node_is_lambda(exp) || bzla_node_fun_get_arity(exp->bzla, exp) > 1)
-    return false;
-
-  param = exp->e[0];
-  body  = bzla_node_binder_get_body(exp);
-
-  if (bzla_node_is_inverted(body) || !bzla_node_is_bv_cond(body)) return false;
-
-  /* check condition */
-  eq = body->e[0];
-  if (bzla_node_is_inverted(eq) || !bzla_node_is_bv_eq(eq) || !eq->parameterized
-      || (eq->e[0] != param && eq->e[1] != param))
-    return false;
-
-  /* check value */
-  if (bzla_node_real_addr(body->e[1])->parameterized) return false;
-
-  /* check apply on unmodified array */
-  app = body->e[2];
-  if (bzla_node_is_inverted(app) || !bzla_node_is_apply(app)
-      || bzla_node_args_get_arity(app->bzla, app->e[1]) > 1
-      || app->e[1]->e[0] != param)
-    return false;
-
-  if (array) *array = app->e[0];
-  if (index) *index = eq->e[1] == param ? eq->e[0] : eq->e[1];
-  if (value) *value = body->e[1];
-  return true;
-}
-
 static bool
 is_true_cond(BzlaNode *cond)
 {
@@ -5704,6 +5664,7 @@ apply_prop_apply_lambda(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
   BzlaNode *index, *write_index, *value;
   bool done, inv_result_tmp;
   uint32_t propagations, apply_propagations, inv_result;
+  BzlaStoreIndex *sidx;
 
   done               = 0;
   result             = 0;
@@ -5715,6 +5676,21 @@ apply_prop_apply_lambda(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
   cur_fun  = e0;
   cur_args = bzla_node_copy(bzla, e1);
 
+  /* resolve reads at constant indices on chains of array writes via the
+   * store index of the chain */
+  if (bzla_node_args_get_arity(bzla, e1) == 1
+      && bzla_node_is_bv_const(e1->e[0])
+      && (sidx = bzla_store_index_get(bzla, e0)))
+  {
+    bzla->stats.store_index_reads++;
+    cur_fun = bzla_store_index_lookup(bzla, sidx, e1->e[0]);
+    if (bzla_store_index_is_const_store(cur_fun, 0, 0, &value))
+    {
+      bzla_node_release(bzla, cur_args);
+      return bzla_node_copy(bzla, value);
+    }
+  }
+
   /* try to propagate apply over bv conditionals were conditions evaluate to
    * true if beta reduced with 'cur_args'. */
   cur_cond =
@@ -5735,7 +5711,7 @@ apply_prop_apply_lambda(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 
     next_fun = 0;
     /* optimization for lambdas representing array writes */
-    if (is_write_exp(cur_fun, &array, &write_index, &value))
+    if (bzla_store_index_is_write_exp(cur_fun, &array, &write_index, &value))
     {
       index = cur_args->e[0];
       /* found value at 'index' */
@@ -5944,8 +5920,20 @@ apply_prop_apply_update(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
   bool prop_down;
   BzlaNode *cur, *args, *value, *a1, *a2, *result = 0, *eq;
   BzlaArgsIterator it1, it2;
+  BzlaStoreIndex *sidx;
 
   cur = e0;
+
+  /* resolve reads at constant indices via the store index of the chain */
+  if (bzla_node_args_get_arity(bzla, e1) == 1
+      && bzla_node_is_bv_const(e1->e[0])
+      && (sidx = bzla_store_index_get(bzla, e0)))
+  {
+    bzla->stats.store_index_reads++;
+    cur = bzla_store_index_lookup(bzla, sidx, e1->e[0]);
+    if (bzla_store_index_is_const_store(cur, 0, 0, &value))
+      return bzla_node_copy(bzla, value);
+  }
   while (bzla_node_is_update(cur))
   {
     args  = cur->e[1];
@@ -110,6 +110,12 @@ init(BzlaSATMgr *smgr)
   return smgr->api.init(smgr);
 }
 
+static inline void
+freeze(BzlaSATMgr *smgr, int32_t lit)
+{
+  if (smgr->api.freeze) smgr->api.freeze(smgr, lit);
+}
+
 static inline void
 melt(BzlaSATMgr *smgr, int32_t lit)
 {
@@ -117,6 +123,12 @@ melt(BzlaSATMgr *smgr, int32_t lit)
   // TODO: else case warning?
 }
 
+static inline void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  if (smgr->api.phase) smgr->api.phase(smgr, lit);
+}
+
 static inline int32_t
 repr(BzlaSATMgr *smgr, int32_t lit)
 {
@@ -156,12 +168,31 @@ setterm(BzlaSATMgr *smgr)
   if (smgr->api.setterm) smgr->api.setterm(smgr);
 }
 
+static inline void
+setlearn(BzlaSATMgr *smgr)
+{
+  if (smgr->api.setlearn) smgr->api.setlearn(smgr);
+}
+
 static inline void
 stats(BzlaSATMgr *smgr)
 {
   if (smgr->api.stats) smgr->api.stats(smgr);
 }
 
+static inline void
+counters(BzlaSATMgr *smgr,
+         int64_t *conflicts,
+         int64_t *decisions,
+         int64_t *propagations)
+{
+  *conflicts    = -1;
+  *decisions    = -1;
+  *propagations = -1;
+  if (smgr->api.counters)
+    smgr->api.counters(smgr, conflicts, decisions, propagations);
+}
+
 /*------------------------------------------------------------------------*/
 
 BzlaSATMgr *
@@ -174,6 +205,7 @@ bzla_sat_mgr_new(Bzla *bzla)
   BZLA_CNEW(bzla->mm, smgr);
   smgr->bzla   = bzla;
   smgr->output = stdout;
+  BZLA_INIT_STACK(bzla->mm, smgr->calls.records);
   return smgr;
 }
 
@@ -191,6 +223,40 @@ bzla_sat_mgr_has_incremental_support(const BzlaSATMgr *smgr)
   return smgr->api.assume != 0 && smgr->api.failed != 0;
 }
 
+bool
+bzla_sat_mgr_has_phase_support(const BzlaSATMgr *smgr)
+{
+  if (!smgr) return false;
+  return smgr->api.phase != 0;
+}
+
+bool
+bzla_sat_mgr_has_freeze_support(const BzlaSATMgr *smgr)
+{
+  if (!smgr) return false;
+  return smgr->api.freeze != 0;
+}
+
+bool
+bzla_sat_mgr_has_learn_support(const BzlaSATMgr *smgr)
+{
+  if (!smgr) return false;
+  return smgr->api.setlearn != 0;
+}
+
+void
+bzla_sat_mgr_set_learn(BzlaSATMgr *smgr,
+                       uint32_t max_size,
+                       void (*fun)(void *, int32_t *),
+                       void *state)
+{
+  assert(smgr);
+  assert(!smgr->initialized);
+  smgr->learn.fun      = fun;
+  smgr->learn.state    = state;
+  smgr->learn.max_size = max_size;
+}
+
 void
 bzla_sat_mgr_set_term(BzlaSATMgr *smgr, int32_t (*fun)(void *), void *state)
 {
@@ -199,6 +265,16 @@ bzla_sat_mgr_set_term(BzlaSATMgr *smgr, int32_t (*fun)(void *), void *state)
   smgr->term.state = state;
 }
 
+void
+bzla_sat_mgr_set_call_callback(BzlaSATMgr *smgr,
+                               void (*fun)(void *, const BzlaSATCall *),
+                               void *state)
+{
+  assert(smgr);
+  smgr->calls.fun   = fun;
+  smgr->calls.state = state;
+}
+
 // FIXME log output handling, in particular: sat manager name output
 // (see lingeling_sat) should be unique, which is not the case for
 // clones
@@ -224,6 +300,10 @@ bzla_sat_mgr_clone(Bzla *bzla, BzlaSATMgr *smgr)
          &smgr->inc_required,
          (char *) smgr + sizeof(*smgr) - (char *) &smgr->inc_required);
   BZLA_CLR(&res->term);
+  BZLA_CLR(&res->learn);
+  BZLA_INIT_STACK(mm, res->calls.records);
+  res->calls.fun   = 0;
+  res->calls.state = 0;
   return res;
 }
 
@@ -266,6 +346,7 @@ bzla_sat_mgr_delete(BzlaSATMgr *smgr)
    * reset_sat has not been called
    */
   if (smgr->initialized) bzla_sat_reset(smgr);
+  BZLA_RELEASE_STACK(smgr->calls.records);
   BZLA_DELETE(smgr->bzla->mm, smgr);
 }
 
@@ -365,6 +446,12 @@ bzla_sat_init(BzlaSATMgr *smgr)
     setterm(smgr);
   }
 
+  /* Set learned clause callback if SAT solver supports it */
+  if (smgr->learn.fun)
+  {
+    setlearn(smgr);
+  }
+
   smgr->true_lit = bzla_sat_mgr_next_cnf_id(smgr);
   bzla_sat_add(smgr, smgr->true_lit);
   bzla_sat_add(smgr, 0);
@@ -381,6 +468,61 @@ bzla_sat_print_stats(BzlaSATMgr *smgr)
            "%d SAT calls in %.1f seconds",
            smgr->satcalls,
            smgr->sat_time);
+  if (bzla_opt_get(smgr->bzla, BZLA_OPT_SAT_ENGINE_CALL_STATS))
+  {
+    bzla_sat_print_call_stats(smgr, smgr->output);
+  }
+}
+
+static void
+print_call_stats_counter(FILE *file, const char *name, int64_t value)
+{
+  if (value < 0)
+    fprintf(file, ", \"%s\": null", name);
+  else
+    fprintf(file, ", \"%s\": %lld", name, (long long) value);
+}
+
+void
+bzla_sat_print_call_stats(BzlaSATMgr *smgr, FILE *file)
+{
+  assert(smgr);
+  assert(file);
+
+  size_t i;
+  BzlaSATCall *call;
+  const char *result;
+
+  fprintf(file, "{\n  \"solver\": \"%s\",\n", smgr->name ? smgr->name : "");
+  fprintf(file, "  \"calls\": [");
+  for (i = 0; i < BZLA_COUNT_STACK(smgr->calls.records); i++)
+  {
+    call = smgr->calls.records.start + i;
+    switch (call->result)
+    {
+      case BZLA_RESULT_SAT: result = "sat"; break;
+      case BZLA_RESULT_UNSAT: result = "unsat"; break;
+      default: result = "unknown";
+    }
+    fprintf(file,
+            "%s\n    {\"call\": %u, \"result\": \"%s\", \"time\": %.6f, "
+            "\"limit\": %d, \"clauses\": %u, \"vars\": %u, "
+            "\"assumptions\": %u",
+            i ? "," : "",
+            call->id,
+            result,
+            call->time,
+            call->limit,
+            call->clauses,
+            call->vars,
+            call->assumptions);
+    print_call_stats_counter(file, "conflicts", call->conflicts);
+    print_call_stats_counter(file, "decisions", call->decisions);
+    print_call_stats_counter(file, "propagations", call->propagations);
+    fprintf(file, "}");
+  }
+  fprintf(file, "%s]\n}\n", BZLA_COUNT_STACK(smgr->calls.records) ? "\n  " : "");
+  fflush(file);
 }
 
 void
@@ -401,9 +543,21 @@ bzla_sat_check_sat(BzlaSATMgr *smgr, int32_t limit)
   assert(smgr->initialized);
   assert(!smgr->inc_required || bzla_sat_mgr_has_incremental_support(smgr));
 
-  double start = bzla_util_time_stamp();
+  double start = bzla_util_time_stamp(), wall_start = 0;
   int32_t sat_res;
+  int64_t conflicts = -1, decisions = -1, propagations = -1;
+  bool record_calls, record;
   BzlaSolverResult res;
+  BzlaSATCall call;
+
+  record_calls = bzla_opt_get(smgr->bzla, BZLA_OPT_SAT_ENGINE_CALL_STATS) != 0;
+  record       = record_calls || smgr->calls.fun;
+  if (record)
+  {
+    wall_start = bzla_util_current_time();
+    counters(smgr, &conflicts, &decisions, &propagations);
+  }
+
   BZLA_MSG(smgr->bzla->msg,
            2,
            "calling SAT solver %s with limit %d",
@@ -420,6 +574,28 @@ bzla_sat_check_sat(BzlaSATMgr *smgr, int32_t limit)
     case 20: res = BZLA_RESULT_UNSAT; break;
     default: assert(sat_res == 0); res = BZLA_RESULT_UNKNOWN;
   }
+
+  if (record)
+  {
+    BZLA_CLR(&call);
+    call.id          = smgr->satcalls;
+    call.limit       = limit;
+    call.time        = bzla_util_current_time() - wall_start;
+    call.clauses     = smgr->clauses - smgr->calls.clauses;
+    call.vars        = smgr->maxvar - smgr->calls.maxvar;
+    call.assumptions = smgr->calls.assumptions;
+    call.result      = res;
+    counters(smgr, &call.conflicts, &call.decisions, &call.propagations);
+    if (call.conflicts >= 0 && conflicts >= 0) call.conflicts -= conflicts;
+    if (call.decisions >= 0 && decisions >= 0) call.decisions -= decisions;
+    if (call.propagations >= 0 && propagations >= 0)
+      call.propagations -= propagations;
+    if (record_calls) BZLA_PUSH_STACK(smgr->calls.records, call);
+    if (smgr->calls.fun) smgr->calls.fun(smgr->calls.state, &call);
+  }
+  smgr->calls.clauses     = smgr->clauses;
+  smgr->calls.maxvar      = smgr->maxvar;
+  smgr->calls.assumptions = 0;
   return res;
 }
 
@@ -474,6 +650,7 @@ bzla_sat_assume(BzlaSATMgr *smgr, int32_t lit)
   assert(smgr->initialized);
   assert(abs(lit) <= smgr->maxvar);
   assert(!smgr->satcalls || smgr->inc_required);
+  smgr->calls.assumptions++;
   assume(smgr, lit);
 }
 
@@ -487,6 +664,26 @@ bzla_sat_failed(BzlaSATMgr *smgr, int32_t lit)
   return failed(smgr, lit);
 }
 
+void
+bzla_sat_phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  assert(smgr != NULL);
+  assert(smgr->initialized);
+  assert(lit);
+  assert(abs(lit) <= smgr->maxvar);
+  phase(smgr, lit);
+}
+
+void
+bzla_sat_freeze(BzlaSATMgr *smgr, int32_t lit)
+{
+  assert(smgr != NULL);
+  assert(smgr->initialized);
+  assert(lit);
+  assert(abs(lit) <= smgr->maxvar);
+  freeze(smgr, lit);
+}
+
 /*------------------------------------------------------------------------*/
 /* DIMACS printer                                                         */
 /*------------------------------------------------------------------------*/
@@ -527,6 +724,13 @@ dimacs_printer_assume(BzlaSATMgr *smgr, int32_t lit)
   assume(printer->smgr, lit);
 }
 
+static void
+dimacs_printer_phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCnfPrinter *printer = (BzlaCnfPrinter *) smgr->solver;
+  phase(printer->smgr, lit);
+}
+
 static int32_t
 dimacs_printer_deref(BzlaSATMgr *smgr, int32_t lit)
 {
@@ -648,6 +852,16 @@ dimacs_printer_stats(BzlaSATMgr *smgr)
   stats(printer->smgr);
 }
 
+static void
+dimacs_printer_counters(BzlaSATMgr *smgr,
+                        int64_t *conflicts,
+                        int64_t *decisions,
+                        int64_t *propagations)
+{
+  BzlaCnfPrinter *printer = (BzlaCnfPrinter *) smgr->solver;
+  counters(printer->smgr, conflicts, decisions, propagations);
+}
+
 static void
 clone_int_stack(BzlaMemMgr *mm, BzlaIntStack *clone, BzlaIntStack *stack)
 {
@@ -689,6 +903,15 @@ dimacs_printer_setterm(BzlaSATMgr *smgr)
   setterm(printer->smgr);
 }
 
+static void
+dimacs_printer_setlearn(BzlaSATMgr *smgr)
+{
+  BzlaCnfPrinter *printer  = (BzlaCnfPrinter *) smgr->solver;
+  BzlaSATMgr *wrapped_smgr = printer->smgr;
+  wrapped_smgr->learn      = smgr->learn;
+  setlearn(wrapped_smgr);
+}
+
 static int32_t
 dimacs_printer_inc_max_var(BzlaSATMgr *smgr)
 {
@@ -699,6 +922,15 @@ dimacs_printer_inc_max_var(BzlaSATMgr *smgr)
   return inc_max_var(wrapped_smgr);
 }
 
+static void
+dimacs_printer_freeze(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCnfPrinter *printer    = (BzlaCnfPrinter *) smgr->solver;
+  BzlaSATMgr *wrapped_smgr   = printer->smgr;
+  wrapped_smgr->inc_required = smgr->inc_required;
+  freeze(wrapped_smgr, lit);
+}
+
 static void
 dimacs_printer_melt(BzlaSATMgr *smgr, int32_t lit)
 {
@@ -726,6 +958,8 @@ enable_dimacs_printer(BzlaSATMgr *smgr)
   BZLA_CNEW(smgr->bzla->mm, printer);
   BZLA_CNEW(smgr->bzla->mm, printer->smgr);
   memcpy(printer->smgr, smgr, sizeof(BzlaSATMgr));
+  /* Calls are recorded by the DIMACS printer. */
+  BZLA_INIT_STACK(smgr->bzla->mm, printer->smgr->calls.records);
 
   /* Clear API */
   memset(&smgr->api, 0, sizeof(smgr->api));
@@ -746,12 +980,17 @@ enable_dimacs_printer(BzlaSATMgr *smgr)
   smgr->api.set_prefix       = dimacs_printer_set_prefix;
   smgr->api.stats            = dimacs_printer_stats;
   smgr->api.setterm          = dimacs_printer_setterm;
+  smgr->api.counters         = dimacs_printer_counters;
 
   /* These function are used in bzla_sat_mgr_has_* testers and should only be
    * set if the underlying SAT solver also has support for it. */
   smgr->api.assume = printer->smgr->api.assume ? dimacs_printer_assume : 0;
   smgr->api.failed = printer->smgr->api.failed ? dimacs_printer_failed : 0;
   smgr->api.clone  = printer->smgr->api.clone ? dimacs_printer_clone : 0;
+  smgr->api.phase  = printer->smgr->api.phase ? dimacs_printer_phase : 0;
+  smgr->api.freeze = printer->smgr->api.freeze ? dimacs_printer_freeze : 0;
+  smgr->api.setlearn =
+      printer->smgr->api.setlearn ? dimacs_printer_setlearn : 0;
 
   return true;
 }
@@ -23,6 +23,26 @@
 
 typedef struct BzlaSATMgr BzlaSATMgr;
 
+/* Statistics of a single SAT solver call (see bzla_sat_check_sat). */
+struct BzlaSATCall
+{
+  uint32_t id;          /* number of the SAT call (starting with 1) */
+  int32_t limit;        /* conflict/decision limit (< 0: no limit) */
+  double time;          /* wall-clock time in seconds */
+  uint32_t clauses;     /* clauses added since previous call */
+  uint32_t vars;        /* variables added since previous call */
+  uint32_t assumptions; /* assumptions added for this call */
+  /* solver counters of this call, -1 if not provided by the SAT solver */
+  int64_t conflicts;
+  int64_t decisions;
+  int64_t propagations;
+  BzlaSolverResult result;
+};
+
+typedef struct BzlaSATCall BzlaSATCall;
+
+BZLA_DECLARE_STACK(BzlaSATCall, BzlaSATCall);
+
 struct BzlaSATMgr
 {
   /* Note: direct solver reference for PicoSAT, wrapper object for for
@@ -54,6 +74,23 @@ struct BzlaSATMgr
     void *state;
   } term;
 
+  struct
+  {
+    void (*fun)(void *, int32_t *); /* learned clause callback */
+    void *state;
+    uint32_t max_size; /* max. size of learned clauses passed to callback */
+  } learn;
+
+  struct
+  {
+    BzlaSATCallStack records; /* per-call statistics (if enabled) */
+    void (*fun)(void *, const BzlaSATCall *); /* per-call callback */
+    void *state;
+    uint32_t assumptions; /* assumptions added since previous call */
+    int32_t clauses;      /* number of clauses at previous call */
+    int32_t maxvar;       /* max. variable at previous call */
+  } calls;
+
   bool have_restore;
   struct
   {
@@ -63,9 +100,11 @@ struct BzlaSATMgr
     void (*enable_verbosity)(BzlaSATMgr *, int32_t);
     int32_t (*failed)(BzlaSATMgr *, int32_t);
     int32_t (*fixed)(BzlaSATMgr *, int32_t);
+    void (*freeze)(BzlaSATMgr *, int32_t);
     int32_t (*inc_max_var)(BzlaSATMgr *);
     void *(*init)(BzlaSATMgr *); /* required */
     void (*melt)(BzlaSATMgr *, int32_t);
+    void (*phase)(BzlaSATMgr *, int32_t);
     int32_t (*repr)(BzlaSATMgr *, int32_t);
     void (*reset)(BzlaSATMgr *);           /* required */
     int32_t (*sat)(BzlaSATMgr *, int32_t); /* required */
@@ -74,6 +113,10 @@ struct BzlaSATMgr
     void (*stats)(BzlaSATMgr *);
     void *(*clone)(Bzla *bzla, BzlaSATMgr *);
     void (*setterm)(BzlaSATMgr *);
+    void (*setlearn)(BzlaSATMgr *);
+    /* cumulative number of conflicts, decisions and propagations,
+     * -1 if not supported */
+    void (*counters)(BzlaSATMgr *, int64_t *, int64_t *, int64_t *);
   } api;
 };
 
@@ -100,10 +143,35 @@ bool bzla_sat_mgr_has_clone_support(const BzlaSATMgr *smgr);
 
 bool bzla_sat_mgr_has_incremental_support(const BzlaSATMgr *smgr);
 
+bool bzla_sat_mgr_has_phase_support(const BzlaSATMgr *smgr);
+
+/* Checks whether variables are frozen explicitly via 'bzla_sat_freeze'
+ * rather than implicitly on creation.  If so, only variables that were
+ * frozen via 'bzla_sat_freeze' may be melted.
+ */
+bool bzla_sat_mgr_has_freeze_support(const BzlaSATMgr *smgr);
+
 void bzla_sat_mgr_set_term(BzlaSATMgr *smgr,
                            int32_t (*fun)(void *),
                            void *state);
 
+bool bzla_sat_mgr_has_learn_support(const BzlaSATMgr *smgr);
+
+/* Sets callback that is called with each (0-terminated) learned clause of
+ * size <= max_size.  Must be called before bzla_sat_init.
+ * Requires that SAT solver supports this.
+ */
+void bzla_sat_mgr_set_learn(BzlaSATMgr *smgr,
+                            uint32_t max_size,
+                            void (*fun)(void *, int32_t *),
+                            void *state);
+
+/* Sets callback that is called with the statistics of each SAT call after
+ * the call returned. */
+void bzla_sat_mgr_set_call_callback(BzlaSATMgr *smgr,
+                                    void (*fun)(void *, const BzlaSATCall *),
+                                    void *state);
+
 /* Clones existing SAT manager (and underlying SAT solver). */
 BzlaSATMgr *bzla_sat_mgr_clone(Bzla *bzla, BzlaSATMgr *smgr);
 
@@ -133,9 +201,15 @@ bool bzla_sat_is_initialized(BzlaSATMgr *smgr);
 /* Sets the output file of the SAT solver. */
 void bzla_sat_set_output(BzlaSATMgr *smgr, FILE *output);
 
-/* Prints statistics of SAT solver. */
+/* Prints statistics of SAT solver (and the per-call statistics if enabled
+ * via sat-engine-call-stats to the output of the SAT solver). */
 void bzla_sat_print_stats(BzlaSATMgr *smgr);
 
+/* Prints the statistics of all SAT calls recorded so far as JSON object.
+ * Calls are only recorded if enabled via sat-engine-call-stats.
+ */
+void bzla_sat_print_call_stats(BzlaSATMgr *smgr, FILE *file);
+
 /* Adds literal to the current clause of the SAT solver.
  * 0 terminates the current clause.
  */
@@ -151,6 +225,19 @@ void bzla_sat_assume(BzlaSATMgr *smgr, int32_t lit);
  */
 int32_t bzla_sat_failed(BzlaSATMgr *smgr, int32_t lit);
 
+/* Sets the preferred (initial) phase of the variable of a literal to the
+ * sign of the literal.  The phase is a decision hint only, the SAT solver
+ * may still override it (e.g., due to phase saving).
+ * Requires that SAT solver supports this.
+ */
+void bzla_sat_phase(BzlaSATMgr *smgr, int32_t lit);
+
+/* Freezes the variable of a literal, i.e., protects it from being eliminated
+ * by the SAT solver until it is melted again.
+ * Requires that SAT solver supports this.
+ */
+void bzla_sat_freeze(BzlaSATMgr *smgr, int32_t lit);
+
 /* Solves the SAT instance.
  * limit < 0 -> no limit.
  */
@@ -453,7 +453,7 @@ bzla_slsutils_compute_sls_scores(Bzla *bzla,
 
   mm = bzla->mm;
   BZLA_INIT_STACK(mm, stack);
-  mark = bzla_hashint_map_new(mm);
+  mark = bzla_hashint_map_new_dense(mm);
 
   /* collect roots */
   bzla_iter_hashptr_init(&pit, bzla->unsynthesized_constraints);
@@ -72,7 +72,7 @@ get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
   if (aig == BZLA_AIG_TRUE) return 1;
   if (aig == BZLA_AIG_FALSE) return -1;
   /* initialize don't care bits with false */
-  if (!bzla_hashint_map_contains(aprop->model, BZLA_REAL_ADDR_AIG(aig)->id))
+  if (!bzla_aigprop_has_assignment_aig(aprop, aig))
     return BZLA_IS_INVERTED_AIG(aig) ? 1 : -1;
   return bzla_aigprop_get_assignment_aig(aprop, aig);
 }
@@ -245,6 +245,8 @@ sat_aigprop_solver(BzlaAIGPropSolver *slv)
   slv->aprop->seed         = bzla_opt_get(bzla, BZLA_OPT_SEED);
   slv->aprop->use_restarts = bzla_opt_get(bzla, BZLA_OPT_AIGPROP_USE_RESTARTS);
   slv->aprop->use_bandit   = bzla_opt_get(bzla, BZLA_OPT_AIGPROP_USE_BANDIT);
+  slv->aprop->use_sim      = bzla_opt_get(bzla, BZLA_OPT_AIGPROP_USE_SIM);
+  slv->aprop->nthreads     = bzla_opt_get(bzla, BZLA_OPT_AIGPROP_THREADS);
 
   /* collect roots AIGs */
   roots = bzla_hashint_table_new(bzla->mm);
@@ -284,11 +286,7 @@ DONE:
       slv->aprop->time.update_cone_model_gen;
   slv->time.aprop_update_cone_compute_score =
       slv->aprop->time.update_cone_compute_score;
-  if (slv->aprop->model)
-  {
-    bzla_hashint_map_delete(slv->aprop->model);
-    slv->aprop->model = 0;
-  }
+  bzla_aigprop_delete_model(slv->aprop);
   if (roots) bzla_hashint_table_delete(roots);
   return sat_result;
 }
@@ -387,6 +385,8 @@ bzla_new_aigprop_solver(Bzla *bzla)
       bzla_opt_get(bzla, BZLA_OPT_SEED),
       bzla_opt_get(bzla, BZLA_OPT_AIGPROP_USE_RESTARTS),
       bzla_opt_get(bzla, BZLA_OPT_AIGPROP_USE_BANDIT),
+      bzla_opt_get(bzla, BZLA_OPT_AIGPROP_USE_SIM),
+      bzla_opt_get(bzla, BZLA_OPT_AIGPROP_THREADS),
       bzla_opt_get(bzla, BZLA_OPT_AIGPROP_NPROPS));
 
   BZLA_MSG(bzla->msg, 1, "enabled aigprop engine");
@@ -10,6 +10,10 @@
 
 #include "bzlaslvfun.h"
 
+#ifdef BZLA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
 #include "bzlabeta.h"
 #include "bzlaclone.h"
 #include "bzlacore.h"
@@ -23,6 +27,7 @@
 #include "bzlaprintmodel.h"
 #include "bzlaslvprop.h"
 #include "bzlaslvsls.h"
+#include "bzlastoreidx.h"
 #include "preprocess/bzlapreprocess.h"
 #include "utils/bzlaabort.h"
 #include "utils/bzlahash.h"
@@ -35,6 +40,41 @@
 
 /*------------------------------------------------------------------------*/
 
+/* Max. size of learned clauses exported via --sat-engine-export-clauses. */
+#define BZLA_FUN_SHARE_MAX_CLAUSE_SIZE 8
+
+/*------------------------------------------------------------------------*/
+
+static void
+clone_data_as_lemma_prems(BzlaMemMgr *mm,
+                          const void *map,
+                          BzlaHashTableData *data,
+                          BzlaHashTableData *cloned_data)
+{
+  assert(mm);
+  assert(data);
+  assert(cloned_data);
+
+  BzlaLemmaPrems *prems, *res;
+
+  (void) map;
+  prems = data->as_ptr;
+  BZLA_NEW(mm, res);
+  BZLA_INIT_STACK(mm, res->sets);
+  if (BZLA_SIZE_STACK(prems->sets) > 0)
+  {
+    BZLA_CNEWN(mm, res->sets.start, BZLA_SIZE_STACK(prems->sets));
+    res->sets.end = res->sets.start + BZLA_SIZE_STACK(prems->sets);
+    res->sets.top = res->sets.start + BZLA_COUNT_STACK(prems->sets);
+    memcpy(res->sets.start,
+           prems->sets.start,
+           BZLA_COUNT_STACK(prems->sets) * sizeof(int32_t));
+  }
+  res->first =
+      bzla_hashint_map_clone(mm, prems->first, bzla_clone_data_as_int, 0);
+  cloned_data->as_ptr = res;
+}
+
 static BzlaFunSolver *
 clone_fun_solver(Bzla *clone, BzlaFunSolver *slv, BzlaNodeMap *exp_map)
 {
@@ -46,6 +86,7 @@ clone_fun_solver(Bzla *clone, BzlaFunSolver *slv, BzlaNodeMap *exp_map)
   uint32_t h;
   Bzla *bzla;
   BzlaFunSolver *res;
+  BzlaNodeMapIterator it;
 
   bzla = slv->bzla;
 
@@ -55,6 +96,12 @@ clone_fun_solver(Bzla *clone, BzlaFunSolver *slv, BzlaNodeMap *exp_map)
   res->bzla   = clone;
   res->lemmas = bzla_hashptr_table_clone(
       clone->mm, slv->lemmas, bzla_clone_key_as_node, 0, exp_map, 0);
+  res->lemma_prems = bzla_hashptr_table_clone(clone->mm,
+                                              slv->lemma_prems,
+                                              bzla_clone_key_as_node,
+                                              clone_data_as_lemma_prems,
+                                              exp_map,
+                                              0);
 
   bzla_clone_node_ptr_stack(
       clone->mm, &slv->cur_lemmas, &res->cur_lemmas, exp_map, false);
@@ -102,9 +149,293 @@ clone_fun_solver(Bzla *clone, BzlaFunSolver *slv, BzlaNodeMap *exp_map)
            BZLA_SIZE_STACK(slv->stats.lemmas_size) * sizeof(uint32_t));
   }
 
+  if (slv->phases)
+  {
+    res->phases = bzla_hashint_map_clone(
+        clone->mm, slv->phases, bzla_clone_data_as_bv_ptr, 0);
+  }
+
+  res->beta_cache = 0;
+  res->score_cone = 0;
+
+  /* The dual prop clone is not cloned. Release the references to the cloned
+   * expressions that correspond to the keys of its expression map. */
+  if (slv->dp_clone)
+  {
+    bzla_iter_nodemap_init(&it, slv->dp_exp_map);
+    while (bzla_iter_nodemap_has_next(&it))
+    {
+      bzla_node_release(
+          clone, bzla_nodemap_mapped(exp_map, bzla_iter_nodemap_next(&it)));
+    }
+  }
+  res->dp_clone       = 0;
+  res->dp_exp_map     = 0;
+  res->dp_root        = 0;
+  res->dp_constraints = 0;
+  res->conf_pool      = 0;
+
   return res;
 }
 
+static void
+delete_phases(BzlaFunSolver *slv)
+{
+  BzlaIntHashTableIterator it;
+
+  if (!slv->phases) return;
+
+  bzla_iter_hashint_init(&it, slv->phases);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    bzla_bv_free(slv->bzla->mm, bzla_iter_hashint_next_data(&it)->as_ptr);
+  }
+  bzla_hashint_map_delete(slv->phases);
+  slv->phases = 0;
+}
+
+static void
+delete_dual_prop_clone(BzlaFunSolver *slv)
+{
+  if (!slv->dp_clone) return;
+
+  bzla_nodemap_delete(slv->dp_exp_map);
+  bzla_node_release(slv->dp_clone, slv->dp_root);
+  bzla_delete(slv->dp_clone);
+  bzla_hashint_table_delete(slv->dp_constraints);
+  slv->dp_clone       = 0;
+  slv->dp_exp_map     = 0;
+  slv->dp_root        = 0;
+  slv->dp_constraints = 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+/* A read with its value and the values of its arguments, fetched for
+ * checking function congruence conflicts in parallel. */
+struct BzlaFunConfRead
+{
+  BzlaNode *app;
+  BzlaBitVectorTuple *args; /* assignment of the arguments */
+  BzlaBitVector *value;     /* assignment of the read */
+  uint32_t hash;            /* hash of 'args' */
+  uint32_t pos;             /* position in the initial applies */
+  int32_t conf;             /* position in the group of the first read with
+                               the same arguments and a different value,
+                               -1 if there is none */
+};
+
+typedef struct BzlaFunConfRead BzlaFunConfRead;
+
+/* The reads of group i (reads of the same function) are reads[groups[i]] to
+ * reads[groups[i + 1] - 1]. */
+struct BzlaFunConfBatch
+{
+  BzlaFunConfRead *reads;
+  uint32_t *groups;
+  uint32_t ngroups;
+  uint32_t next; /* the next group to check, updated atomically */
+};
+
+typedef struct BzlaFunConfBatch BzlaFunConfBatch;
+
+static int32_t
+cmp_conf_read_qsort(const void *a, const void *b)
+{
+  const BzlaFunConfRead *r1, *r2;
+
+  r1 = a;
+  r2 = b;
+  if (r1->hash != r2->hash) return r1->hash < r2->hash ? -1 : 1;
+  if (r1->pos != r2->pos) return r1->pos < r2->pos ? -1 : 1;
+  return 0;
+}
+
+/* Check the 'n' reads of a group for function congruence conflicts. As during
+ * propagation, every read is checked against the first read (in the order of
+ * the initial applies) with the same arguments. Only compares the fetched
+ * values and does not access the solver, hence it is safe to check different
+ * groups concurrently. */
+static void
+check_conf_group(BzlaFunConfRead *reads, uint32_t n)
+{
+  uint32_t i, j, k, l;
+
+  for (i = 0; i < n; i++)
+  {
+    reads[i].hash = bzla_bv_hash_tuple(reads[i].args);
+    reads[i].conf = -1;
+  }
+  qsort(reads, n, sizeof(BzlaFunConfRead), cmp_conf_read_qsort);
+
+  for (i = 0; i < n; i = j)
+  {
+    for (j = i + 1; j < n && reads[j].hash == reads[i].hash; j++)
+      ;
+    for (k = i + 1; k < j; k++)
+    {
+      for (l = i; l < k; l++)
+      {
+        if (bzla_bv_compare_tuple(reads[l].args, reads[k].args)) continue;
+        if (bzla_bv_compare(reads[l].value, reads[k].value)) reads[k].conf = l;
+        break;
+      }
+    }
+  }
+}
+
+/* Check groups of 'batch' until all groups are taken. */
+static void
+check_conf_batch(BzlaFunConfBatch *batch)
+{
+  uint32_t g;
+
+  for (;;)
+  {
+    g = __atomic_fetch_add(&batch->next, 1, __ATOMIC_RELAXED);
+    if (g >= batch->ngroups) break;
+    check_conf_group(batch->reads + batch->groups[g],
+                     batch->groups[g + 1] - batch->groups[g]);
+  }
+}
+
+#ifdef BZLA_HAVE_PTHREADS
+/* The main thread checks groups of each batch, too. Threads that could not be
+ * started are simply missing, the remaining threads take their groups. */
+struct BzlaFunConfPool
+{
+  pthread_mutex_t mutex;
+  pthread_cond_t batch_cond; /* signalled if a new batch is available */
+  pthread_cond_t done_cond;  /* signalled if all threads finished a batch */
+  BzlaFunConfBatch *batch;   /* the current batch */
+  uint64_t nbatches;         /* the number of batches so far */
+  uint32_t running;          /* threads still working on the current batch */
+  bool shutdown;             /* true if threads must exit */
+  pthread_t *threads;
+  bool *started;
+  uint32_t nstarted;
+  uint32_t nthreads;
+};
+
+static void *
+conf_pool_thread(void *state)
+{
+  uint64_t nbatches;
+  BzlaFunConfPool *pool;
+
+  pool     = state;
+  nbatches = 0;
+
+  pthread_mutex_lock(&pool->mutex);
+  for (;;)
+  {
+    while (!pool->shutdown && pool->nbatches == nbatches)
+      pthread_cond_wait(&pool->batch_cond, &pool->mutex);
+    if (pool->shutdown) break;
+    nbatches = pool->nbatches;
+    pthread_mutex_unlock(&pool->mutex);
+
+    check_conf_batch(pool->batch);
+
+    pthread_mutex_lock(&pool->mutex);
+    assert(pool->running);
+    pool->running -= 1;
+    if (!pool->running) pthread_cond_signal(&pool->done_cond);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  return 0;
+}
+
+static BzlaFunConfPool *
+new_conf_pool(BzlaMemMgr *mm, uint32_t nthreads)
+{
+  uint32_t i;
+  BzlaFunConfPool *pool;
+
+  BZLA_CNEW(mm, pool);
+  pthread_mutex_init(&pool->mutex, 0);
+  pthread_cond_init(&pool->batch_cond, 0);
+  pthread_cond_init(&pool->done_cond, 0);
+  pool->nthreads = nthreads;
+  BZLA_CNEWN(mm, pool->threads, nthreads);
+  BZLA_CNEWN(mm, pool->started, nthreads);
+  for (i = 0; i < nthreads; i++)
+  {
+    pool->started[i] =
+        pthread_create(&pool->threads[i], 0, conf_pool_thread, pool) == 0;
+    if (pool->started[i]) pool->nstarted += 1;
+  }
+  return pool;
+}
+#endif
+
+static void
+delete_conf_pool(BzlaFunSolver *slv)
+{
+#ifdef BZLA_HAVE_PTHREADS
+  uint32_t i;
+  BzlaMemMgr *mm;
+  BzlaFunConfPool *pool;
+
+  if (!(pool = slv->conf_pool)) return;
+
+  mm = slv->bzla->mm;
+  pthread_mutex_lock(&pool->mutex);
+  pool->shutdown = true;
+  pthread_cond_broadcast(&pool->batch_cond);
+  pthread_mutex_unlock(&pool->mutex);
+  for (i = 0; i < pool->nthreads; i++)
+  {
+    if (pool->started[i]) pthread_join(pool->threads[i], 0);
+  }
+  pthread_cond_destroy(&pool->done_cond);
+  pthread_cond_destroy(&pool->batch_cond);
+  pthread_mutex_destroy(&pool->mutex);
+  BZLA_DELETEN(mm, pool->started, pool->nthreads);
+  BZLA_DELETEN(mm, pool->threads, pool->nthreads);
+  BZLA_DELETE(mm, pool);
+  slv->conf_pool = 0;
+#else
+  (void) slv;
+#endif
+}
+
+/* Check the groups of 'batch' on the thread pool of 'slv', which is created
+ * on first use with 'nthreads' threads in total. */
+static void
+run_conf_batch(BzlaFunSolver *slv, BzlaFunConfBatch *batch, uint32_t nthreads)
+{
+  assert(nthreads > 1);
+
+#ifdef BZLA_HAVE_PTHREADS
+  BzlaFunConfPool *pool;
+
+  if (slv->conf_pool && slv->conf_pool->nthreads != nthreads - 1)
+    delete_conf_pool(slv);
+  if (!slv->conf_pool)
+    slv->conf_pool = new_conf_pool(slv->bzla->mm, nthreads - 1);
+  pool = slv->conf_pool;
+
+  pthread_mutex_lock(&pool->mutex);
+  pool->batch = batch;
+  pool->nbatches += 1;
+  pool->running = pool->nstarted;
+  pthread_cond_broadcast(&pool->batch_cond);
+  pthread_mutex_unlock(&pool->mutex);
+
+  check_conf_batch(batch);
+
+  pthread_mutex_lock(&pool->mutex);
+  while (pool->running) pthread_cond_wait(&pool->done_cond, &pool->mutex);
+  pool->batch = 0;
+  pthread_mutex_unlock(&pool->mutex);
+#else
+  (void) slv;
+  (void) nthreads;
+  check_conf_batch(batch);
+#endif
+}
+
 static void
 delete_fun_solver(BzlaFunSolver *slv)
 {
@@ -116,6 +447,7 @@ delete_fun_solver(BzlaFunSolver *slv)
   BzlaPtrHashTable *t;
   BzlaPtrHashTableIterator it, iit;
   BzlaNode *exp;
+  BzlaLemmaPrems *prems;
   Bzla *bzla;
 
   bzla = slv->bzla;
@@ -125,6 +457,17 @@ delete_fun_solver(BzlaFunSolver *slv)
     bzla_node_release(bzla, bzla_iter_hashptr_next(&it));
   bzla_hashptr_table_delete(slv->lemmas);
 
+  bzla_iter_hashptr_init(&it, slv->lemma_prems);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    prems = it.bucket->data.as_ptr;
+    bzla_node_release(bzla, bzla_iter_hashptr_next(&it));
+    BZLA_RELEASE_STACK(prems->sets);
+    bzla_hashint_map_delete(prems->first);
+    BZLA_DELETE(bzla->mm, prems);
+  }
+  bzla_hashptr_table_delete(slv->lemma_prems);
+
   if (slv->score)
   {
     bzla_iter_hashptr_init(&it, slv->score);
@@ -151,6 +494,7 @@ delete_fun_solver(BzlaFunSolver *slv)
     }
     bzla_hashptr_table_delete(slv->score);
   }
+  if (slv->score_cone) bzla_hashint_map_delete(slv->score_cone);
 
   BZLA_RELEASE_STACK(slv->cur_lemmas);
   while (!BZLA_EMPTY_STACK(slv->constraints))
@@ -159,6 +503,10 @@ delete_fun_solver(BzlaFunSolver *slv)
   }
   BZLA_RELEASE_STACK(slv->constraints);
   BZLA_RELEASE_STACK(slv->stats.lemmas_size);
+  delete_phases(slv);
+  if (slv->beta_cache) bzla_beta_cache_delete(slv->beta_cache);
+  delete_dual_prop_clone(slv);
+  delete_conf_pool(slv);
   BZLA_DELETE(bzla->mm, slv);
   bzla->slv = 0;
 }
@@ -225,6 +573,104 @@ incremental_required(Bzla *bzla)
   return res;
 }
 
+static bool
+is_clause_sharing_enabled(Bzla *bzla)
+{
+  return bzla_opt_get_valstr(bzla, BZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES)
+         || bzla_opt_get_valstr(bzla, BZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES);
+}
+
+/* Identify the AIG variables of the bits of symbolic bit-vector constants by
+ * their symbol and bit index rather than their creation order, such that
+ * exported clauses can be matched independently of the order in which the
+ * constants are bit-blasted. */
+static void
+name_clause_sharing_vars(Bzla *bzla)
+{
+  uint32_t i;
+  uint64_t h;
+  char *sym;
+  BzlaNode *cur;
+  BzlaAIG *aig;
+  BzlaAIGMgr *amgr;
+  BzlaPtrHashTableIterator it;
+
+  amgr = bzla_get_aig_mgr(bzla);
+  bzla_iter_hashptr_init(&it, bzla->bv_vars);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_node_real_addr(bzla_iter_hashptr_next(&it));
+    if (!cur->av || !(sym = bzla_node_get_symbol(bzla, cur))) continue;
+    h = (uint64_t) bzla_hash_str(sym) << 32;
+    for (i = 0; i < cur->av->width; i++)
+    {
+      aig = cur->av->aigs[i];
+      if (bzla_aig_is_const(aig) || !BZLA_REAL_ADDR_AIG(aig)->is_var) continue;
+      bzla_aig_mgr_set_var_name(amgr, aig, h | (i + 1));
+    }
+  }
+}
+
+static void
+import_clauses(Bzla *bzla)
+{
+  bool parsed;
+  const char *path;
+  FILE *file;
+
+  path = bzla_opt_get_valstr(bzla, BZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES);
+  if (!path) return;
+  file = fopen(path, "r");
+  BZLA_ABORT(!file, "failed to open '%s' for importing clauses", path);
+  parsed = bzla_aig_mgr_import_clauses(bzla_get_aig_mgr(bzla), file);
+  fclose(file);
+  BZLA_ABORT(!parsed, "invalid clause file '%s'", path);
+}
+
+static void
+export_clauses(Bzla *bzla)
+{
+  const char *path;
+  FILE *file;
+
+  path = bzla_opt_get_valstr(bzla, BZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES);
+  if (!path) return;
+  file = fopen(path, "w");
+  BZLA_ABORT(!file, "failed to open '%s' for exporting clauses", path);
+  bzla_aig_mgr_export_clauses(bzla_get_aig_mgr(bzla), file);
+  fclose(file);
+}
+
+/* Enables tracking of the CNF variables to be frozen, i.e., of the AIGs of
+ * synthesized nodes, which may be referenced by future assertions,
+ * assumptions and lemmas.  All other CNF variables can be eliminated by the
+ * SAT solver.  Nodes synthesized before are registered once here, later
+ * changes are tracked on synthesis and deletion of AIG vectors. */
+static void
+enable_frozen_cnf_vars(Bzla *bzla)
+{
+  assert(bzla);
+
+  uint32_t i;
+  BzlaAIGMgr *amgr;
+  BzlaSATMgr *smgr;
+  BzlaNode *cur;
+
+  amgr = bzla_get_aig_mgr(bzla);
+  smgr = bzla_get_sat_mgr(bzla);
+
+  if (!smgr->inc_required || !bzla_sat_mgr_has_freeze_support(smgr)) return;
+  if (amgr->freeze.enabled) return;
+
+  bzla_aig_mgr_enable_freeze(amgr);
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); i++)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || !cur->av) continue;
+    bzla_aig_mgr_ref_frozen(amgr, cur->av->aigs, cur->av->width);
+  }
+}
+
 static void
 configure_sat_mgr(Bzla *bzla)
 {
@@ -233,6 +679,12 @@ configure_sat_mgr(Bzla *bzla)
   smgr = bzla_get_sat_mgr(bzla);
   if (bzla_sat_is_initialized(smgr)) return;
   bzla_sat_enable_solver(smgr);
+  if (is_clause_sharing_enabled(bzla))
+  {
+    bzla_aig_mgr_enable_clause_sharing(bzla_get_aig_mgr(bzla),
+                                       BZLA_FUN_SHARE_MAX_CLAUSE_SIZE);
+    import_clauses(bzla);
+  }
   bzla_sat_init(smgr);
 
   /* reset SAT solver to non-incremental if all functions have been
@@ -255,6 +707,62 @@ configure_sat_mgr(Bzla *bzla)
   BZLA_ABORT(smgr->inc_required && !bzla_sat_mgr_has_incremental_support(smgr),
              "selected SAT solver '%s' does not support incremental mode",
              smgr->name);
+
+  enable_frozen_cnf_vars(bzla);
+}
+
+/* In non-incremental mode without functions, the SAT solver is called only
+ * once and model values of all terms except inputs are computed by evaluation
+ * (see bzla_model_generate).  Hence, after encoding the formula to CNF, the
+ * AIG vectors of all other terms (and thus all internal AIGs) can be released.
+ * The AIG vectors of inputs map input bits to CNF variables and are kept, as
+ * well as the AIG vectors of terms inputs have been substituted with (their
+ * model values are also read from the SAT assignment). */
+static void
+compact_aigs(Bzla *bzla)
+{
+  assert(bzla);
+  assert(!bzla_get_sat_mgr(bzla)->inc_required);
+
+  uint32_t i, num_released = 0;
+  BzlaNode *cur;
+  BzlaAIGMgr *amgr;
+  BzlaIntHashTable *keep;
+
+  amgr = bzla_get_aig_mgr(bzla);
+  if (amgr->share.enabled) return;
+  if (bzla->ufs->count > 0 || bzla->lambdas->count > 0) return;
+
+  keep = bzla_hashint_table_new(bzla->mm);
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); i++)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || !bzla_node_is_var(cur) || !cur->simplified) continue;
+    cur = bzla_node_real_addr(bzla_node_get_simplified(bzla, cur));
+    if (!bzla_hashint_table_contains(keep, cur->id))
+    {
+      bzla_hashint_table_add(keep, cur->id);
+    }
+  }
+
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); i++)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || !cur->av || bzla_node_is_var(cur)) continue;
+    if (bzla_hashint_table_contains(keep, cur->id)) continue;
+    bzla_aig_mgr_unref_frozen(amgr, cur->av->aigs, cur->av->width);
+    bzla_aigvec_release_delete(bzla->avmgr, cur->av);
+    cur->av = 0;
+    num_released++;
+  }
+  bzla_hashint_table_delete(keep);
+  bzla_aig_mgr_shrink_unique_table(amgr);
+
+  BZLA_MSG(bzla->msg,
+           1,
+           "released %u AIG vectors, %u AIG ands left",
+           num_released,
+           amgr->cur_num_aigs);
 }
 
 static BzlaSolverResult
@@ -277,11 +785,20 @@ timed_sat_sat(Bzla *bzla, int32_t limit)
            amgr->cur_num_aigs,
            amgr->num_cnf_vars,
            amgr->num_cnf_clauses);
+  if (amgr->share.enabled)
+  {
+    name_clause_sharing_vars(bzla);
+    /* add previously exported learned clauses that became applicable */
+    bzla_aig_mgr_add_imported_clauses(amgr);
+  }
+  bzla_aig_mgr_update_frozen(amgr);
+
   smgr  = bzla_get_sat_mgr(bzla);
   start = bzla_util_time_stamp();
   res   = bzla_sat_check_sat(smgr, limit);
   delta = bzla_util_time_stamp() - start;
   BZLA_FUN_SOLVER(bzla)->time.sat += delta;
+  if (amgr->share.enabled) export_clauses(bzla);
 
   BZLA_MSG(
       bzla->msg, 2, "SAT solver returns %d after %.1f seconds", res, delta);
@@ -344,29 +861,161 @@ get_bv_assignment(Bzla *bzla, BzlaNode *exp)
   return result;
 }
 
-/*------------------------------------------------------------------------*/
+/* Returns true if the assignment of given node is read from the SAT solver
+ * (or constant) rather than computed by evaluation (see get_bv_assignment). */
+static bool
+has_direct_bv_assignment(BzlaNode *exp)
+{
+  assert(bzla_node_is_regular(exp));
+  return bzla_node_is_synth(exp) || bzla_node_is_bv_const(exp)
+         || bzla_node_is_bv_var(exp) || bzla_node_is_apply(exp)
+         || bzla_node_is_fun_eq(exp);
+}
 
-static Bzla *
-new_exp_layer_clone_for_dual_prop(Bzla *bzla,
-                                  BzlaNodeMap **exp_map,
-                                  BzlaNode **root)
+/* Returns true if the current direct assignment of given node differs from
+ * given (previous) assignment. */
+static bool
+direct_bv_assignment_changed(Bzla *bzla, BzlaNode *exp, BzlaBitVector *bv)
+{
+  assert(has_direct_bv_assignment(exp));
+
+  uint32_t i, width;
+  int32_t bit;
+  BzlaAIGMgr *amgr;
+
+  if (bzla_node_is_bv_const(exp)) return false;
+  /* not synthesized inputs, applies and function equalities are
+   * zero-initialized */
+  if (!bzla_node_is_synth(exp)) return !bzla_bv_is_zero(bv);
+
+  amgr  = bzla_get_aig_mgr(bzla);
+  width = exp->av->width;
+  assert(width == bzla_bv_get_width(bv));
+  for (i = 0; i < width; i++)
+  {
+    bit = bzla_aig_get_assignment(amgr, exp->av->aigs[width - 1 - i]);
+    if ((bit == 1) != (bzla_bv_get_bit(bv, i) == 1)) return true;
+  }
+  return false;
+}
+
+/* Removes all assignments from the bit-vector model that may have changed
+ * since the previous SAT call.  Direct assignments are compared against the
+ * current SAT assignment, evaluated assignments are invalidated if any
+ * assignment in their cone (up to direct assignments, as in bzla_eval_exp)
+ * changed.  The assignments that are kept do not need to be recomputed in the
+ * next refinement round. */
+static void
+update_bv_model(Bzla *bzla)
 {
   assert(bzla);
-  assert(bzla->slv);
-  assert(bzla->slv->kind == BZLA_FUN_SOLVER_KIND);
-  assert(exp_map);
-  assert(root);
+  assert(bzla->bv_model);
+  assert(!bzla->word_blaster);
 
-  double start;
-  Bzla *clone;
-  BzlaNode *cur, *and;
-  BzlaPtrHashTableIterator it;
+  uint32_t i, j;
+  bool changed;
+  BzlaMemMgr *mm;
+  BzlaFunSolver *slv;
+  BzlaNode *cur, *real_cur;
+  BzlaNodePtrStack entries, visit;
+  BzlaIntHashTable *mark;
+  BzlaHashTableData *d, *dm;
+  BzlaIntHashTableIterator iit;
 
-  /* empty formula */
-  if (bzla->unsynthesized_constraints->count == 0) return 0;
+  mm   = bzla->mm;
+  slv  = BZLA_FUN_SOLVER(bzla);
+  mark = bzla_hashint_map_new(mm); /* 0: visited, 1: unchanged, 2: changed */
 
-  start = bzla_util_time_stamp();
-  clone = bzla_clone_exp_layer(bzla, exp_map, true);
+  BZLA_INIT_STACK(mm, entries);
+  BZLA_INIT_STACK(mm, visit);
+  bzla_iter_hashint_init(&iit, bzla->bv_model);
+  while (bzla_iter_hashint_has_next(&iit))
+  {
+    cur = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&iit));
+    BZLA_PUSH_STACK(entries, bzla_node_real_addr(cur));
+  }
+
+  for (i = 0; i < BZLA_COUNT_STACK(entries); i++)
+  {
+    BZLA_PUSH_STACK(visit, BZLA_PEEK_STACK(entries, i));
+    while (!BZLA_EMPTY_STACK(visit))
+    {
+      cur      = bzla_node_get_simplified(bzla, BZLA_POP_STACK(visit));
+      real_cur = bzla_node_real_addr(cur);
+      assert(!real_cur->parameterized);
+      d = bzla_hashint_map_get(mark, real_cur->id);
+
+      if (!d)
+      {
+        if (has_direct_bv_assignment(real_cur))
+        {
+          dm      = bzla_hashint_map_get(bzla->bv_model, real_cur->id);
+          changed = !dm
+                    || direct_bv_assignment_changed(bzla, real_cur, dm->as_ptr);
+          bzla_hashint_map_add(mark, real_cur->id)->as_int = changed ? 2 : 1;
+          continue;
+        }
+        BZLA_PUSH_STACK(visit, real_cur);
+        bzla_hashint_map_add(mark, real_cur->id);
+        for (j = 0; j < real_cur->arity; j++)
+        {
+          BZLA_PUSH_STACK(visit, real_cur->e[j]);
+        }
+      }
+      else if (d->as_int == 0)
+      {
+        d->as_int = 1;
+        for (j = 0; j < real_cur->arity; j++)
+        {
+          cur = bzla_node_get_simplified(bzla, real_cur->e[j]);
+          dm  = bzla_hashint_map_get(mark, bzla_node_real_addr(cur)->id);
+          assert(dm);
+          assert(dm->as_int > 0);
+          if (dm->as_int == 2)
+          {
+            d->as_int = 2;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  for (i = 0; i < BZLA_COUNT_STACK(entries); i++)
+  {
+    cur = BZLA_PEEK_STACK(entries, i);
+    d   = bzla_hashint_map_get(mark, cur->id);
+    assert(d);
+    if (d->as_int == 2)
+    {
+      bzla_model_remove_from_bv(bzla, bzla->bv_model, cur);
+      slv->stats.model_values_invalidated++;
+    }
+    else
+    {
+      slv->stats.model_values_reused++;
+    }
+  }
+
+  BZLA_RELEASE_STACK(entries);
+  BZLA_RELEASE_STACK(visit);
+  bzla_hashint_map_delete(mark);
+}
+
+/*------------------------------------------------------------------------*/
+
+static void
+new_exp_layer_clone_for_dual_prop(BzlaFunSolver *slv)
+{
+  assert(slv);
+  assert(!slv->dp_clone);
+
+  Bzla *bzla, *clone;
+  BzlaNode *cur, *and, *root;
+  BzlaPtrHashTableIterator it;
+
+  bzla  = slv->bzla;
+  clone = bzla_clone_exp_layer(bzla, &slv->dp_exp_map, true);
   assert(!clone->synthesized_constraints->count);
   assert(clone->embedded_constraints->count == 0);
   assert(clone->unsynthesized_constraints->count);
@@ -381,21 +1030,23 @@ new_exp_layer_clone_for_dual_prop(Bzla *bzla,
   bzla_opt_set_str(clone, BZLA_OPT_SAT_ENGINE, "plain=1");
   configure_sat_mgr(clone);
 
+  /* assumptions are only added to the root of the current sat call (see
+   * get_dual_prop_clone) */
+  root = 0;
   bzla_iter_hashptr_init(&it, clone->unsynthesized_constraints);
-  bzla_iter_hashptr_queue(&it, clone->assumptions);
   while (bzla_iter_hashptr_has_next(&it))
   {
     cur                                  = bzla_iter_hashptr_next(&it);
     bzla_node_real_addr(cur)->constraint = 0;
-    if (!*root)
+    if (!root)
     {
-      *root = bzla_node_copy(clone, cur);
+      root = bzla_node_copy(clone, cur);
     }
     else
     {
-      and = bzla_exp_bv_and(clone, *root, cur);
-      bzla_node_release(clone, *root);
-      *root = and;
+      and = bzla_exp_bv_and(clone, root, cur);
+      bzla_node_release(clone, root);
+      root = and;
     }
   }
 
@@ -414,9 +1065,21 @@ new_exp_layer_clone_for_dual_prop(Bzla *bzla,
                              (BzlaHashPtr) bzla_node_hash_by_id,
                              (BzlaCmpPtr) bzla_node_compare_by_id);
 
-  BZLA_FUN_SOLVER(bzla)->time.search_init_apps_cloning +=
-      bzla_util_time_stamp() - start;
-  return clone;
+  /* remember the constraints the clone was built from */
+  slv->dp_constraints = bzla_hashint_table_new(bzla->mm);
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_iter_hashptr_next(&it);
+    if (!bzla_hashint_table_contains(slv->dp_constraints,
+                                     bzla_node_get_id(cur)))
+      bzla_hashint_table_add(slv->dp_constraints, bzla_node_get_id(cur));
+  }
+
+  slv->dp_clone = clone;
+  slv->dp_root  = root;
+  slv->stats.dp_clones++;
 }
 
 static void
@@ -505,11 +1168,14 @@ create_function_inequality(Bzla *bzla, BzlaNode *feq)
 }
 
 /* for every function equality f = g, add
- * f != g -> f(a) != g(a) */
+ * f != g -> f(a) != g(a)
+ * If witnesses are created lazily (see add_function_inequality_witness),
+ * function equalities are only collected and checked for support here. */
 static void
 add_function_inequality_constraints(Bzla *bzla)
 {
   uint32_t i;
+  bool opt_lazy_ext;
   BzlaNode *cur, *neq, *con;
   BzlaNodePtrStack feqs, visit;
   BzlaPtrHashTableIterator it;
@@ -563,6 +1229,7 @@ add_function_inequality_constraints(Bzla *bzla)
   }
 
   /* add inequality constraint for every reachable function equality */
+  opt_lazy_ext = bzla_opt_get(bzla, BZLA_OPT_FUN_LAZY_EXT) != 0;
   while (!BZLA_EMPTY_STACK(feqs))
   {
     cur = BZLA_POP_STACK(feqs);
@@ -571,6 +1238,7 @@ add_function_inequality_constraints(Bzla *bzla)
     b = bzla_hashptr_table_get(bzla->feqs, cur);
     assert(b);
     assert(b->data.as_int == 0);
+    if (opt_lazy_ext) continue;
     b->data.as_int = 1;
     neq            = create_function_inequality(bzla, cur);
     con            = bzla_exp_implies(bzla, bzla_node_invert(cur), neq);
@@ -942,6 +1610,79 @@ add_lemma_to_dual_prop_clone(Bzla *bzla,
   *root = and;
 }
 
+/* Get the dual prop clone for the current sat call and its root, i.e., the
+ * conjunction of all constraints and assumptions. The clone is kept across
+ * sat calls and only synchronized with constraints added since the last call.
+ * It is rebuilt from scratch if any of the constraints it was built from got
+ * eliminated or rewritten (e.g., due to variable substitution). */
+static Bzla *
+get_dual_prop_clone(BzlaFunSolver *slv, BzlaNode **root)
+{
+  assert(slv);
+  assert(root);
+
+  double start;
+  uint32_t num_found;
+  int32_t id;
+  Bzla *bzla;
+  BzlaNode *cur;
+  BzlaPtrHashTableIterator it;
+
+  bzla  = slv->bzla;
+  start = bzla_util_time_stamp();
+
+  if (slv->dp_clone)
+  {
+    num_found = 0;
+    bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+    bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+    while (bzla_iter_hashptr_has_next(&it))
+    {
+      id = bzla_node_get_id(bzla_iter_hashptr_next(&it));
+      if (bzla_hashint_table_contains(slv->dp_constraints, id)) num_found++;
+    }
+    if (num_found < slv->dp_constraints->count) delete_dual_prop_clone(slv);
+  }
+
+  if (slv->dp_clone)
+  {
+    bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+    bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+    while (bzla_iter_hashptr_has_next(&it))
+    {
+      cur = bzla_iter_hashptr_next(&it);
+      id  = bzla_node_get_id(cur);
+      if (bzla_hashint_table_contains(slv->dp_constraints, id)) continue;
+      add_lemma_to_dual_prop_clone(
+          bzla, slv->dp_clone, &slv->dp_root, cur, slv->dp_exp_map);
+      bzla_hashint_table_add(slv->dp_constraints, id);
+    }
+    slv->stats.dp_clones_reused++;
+  }
+  else
+  {
+    /* empty formula */
+    if (bzla->unsynthesized_constraints->count == 0
+        && bzla->synthesized_constraints->count == 0)
+      return 0;
+    new_exp_layer_clone_for_dual_prop(slv);
+  }
+
+  *root = bzla_node_copy(slv->dp_clone, slv->dp_root);
+  bzla_iter_hashptr_init(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    add_lemma_to_dual_prop_clone(bzla,
+                                 slv->dp_clone,
+                                 root,
+                                 bzla_iter_hashptr_next(&it),
+                                 slv->dp_exp_map);
+  }
+
+  slv->time.search_init_apps_cloning += bzla_util_time_stamp() - start;
+  return slv->dp_clone;
+}
+
 /*------------------------------------------------------------------------*/
 
 static void
@@ -1448,6 +2189,124 @@ mk_premise(Bzla *bzla, BzlaNode *args, BzlaNode *prem[], uint32_t num_prem)
   return res;
 }
 
+static int32_t
+cmp_int(const void *a, const void *b)
+{
+  int32_t x = *(const int32_t *) a;
+  int32_t y = *(const int32_t *) b;
+  return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+/* Collect the (signed) ids of the conjuncts of premise 'prem' in ascending
+ * order. */
+static void
+collect_premise_ids(Bzla *bzla, BzlaNode *prem, BzlaIntStack *ids)
+{
+  assert(bzla);
+  assert(prem);
+  assert(ids);
+
+  int32_t id;
+  BzlaNode *cur;
+  BzlaNodePtrStack visit;
+  BzlaIntHashTable *cache;
+
+  cache = bzla_hashint_table_new(bzla->mm);
+  BZLA_INIT_STACK(bzla->mm, visit);
+  BZLA_PUSH_STACK(visit, prem);
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    cur = BZLA_POP_STACK(visit);
+    id  = bzla_node_get_id(cur);
+    if (bzla_hashint_table_contains(cache, id)) continue;
+    bzla_hashint_table_add(cache, id);
+
+    if (bzla_node_is_regular(cur) && bzla_node_is_bv_and(cur))
+    {
+      BZLA_PUSH_STACK(visit, cur->e[0]);
+      BZLA_PUSH_STACK(visit, cur->e[1]);
+    }
+    else
+      BZLA_PUSH_STACK(*ids, id);
+  }
+  BZLA_RELEASE_STACK(visit);
+  bzla_hashint_table_delete(cache);
+  qsort(ids->start, BZLA_COUNT_STACK(*ids), sizeof(int32_t), cmp_int);
+}
+
+/* Check if sorted array 'a' of size 'na' is a subset of sorted array 'b' of
+ * size 'nb'. */
+static bool
+is_subset_ids(const int32_t *a, uint32_t na, const int32_t *b, uint32_t nb)
+{
+  uint32_t i, j;
+
+  if (na > nb) return false;
+  for (i = 0, j = 0; i < na; i++)
+  {
+    while (j < nb && b[j] < a[i]) j++;
+    if (j == nb || b[j] != a[i]) return false;
+    j++;
+  }
+  return true;
+}
+
+/* Record the lemma with conclusion 'con' and premise set 'ids' in the lemma
+ * store. Returns false (and does not record the lemma) if it is subsumed by a
+ * lemma already in the store, i.e., a lemma with the same conclusion and a
+ * subset of its premises. Only premise sets with no premises or with their
+ * smallest id in 'ids' are checked. */
+static bool
+add_to_lemma_store(BzlaFunSolver *slv, BzlaNode *con, BzlaIntStack *ids)
+{
+  assert(slv);
+  assert(con);
+  assert(ids);
+
+  int32_t pos, key;
+  uint32_t i, n, nids;
+  BzlaLemmaPrems *prems;
+  BzlaPtrHashBucket *b;
+  BzlaHashTableData *d;
+  Bzla *bzla;
+
+  bzla = slv->bzla;
+  b    = bzla_hashptr_table_get(slv->lemma_prems, con);
+  if (!b)
+  {
+    BZLA_NEW(bzla->mm, prems);
+    BZLA_INIT_STACK(bzla->mm, prems->sets);
+    prems->first = bzla_hashint_map_new(bzla->mm);
+    b = bzla_hashptr_table_add(slv->lemma_prems, bzla_node_copy(bzla, con));
+    b->data.as_ptr = prems;
+  }
+  prems = b->data.as_ptr;
+  nids  = BZLA_COUNT_STACK(*ids);
+
+  for (i = 0; i <= nids; i++)
+  {
+    key = i == 0 ? 0 : BZLA_PEEK_STACK(*ids, i - 1);
+    d   = bzla_hashint_map_get(prems->first, key);
+    for (pos = d ? d->as_int : -1; pos >= 0;
+         pos = BZLA_PEEK_STACK(prems->sets, pos))
+    {
+      n = BZLA_PEEK_STACK(prems->sets, pos + 1);
+      if (is_subset_ids(prems->sets.start + pos + 2, n, ids->start, nids))
+        return false;
+    }
+  }
+
+  key = nids == 0 ? 0 : BZLA_PEEK_STACK(*ids, 0);
+  d   = bzla_hashint_map_get(prems->first, key);
+  BZLA_PUSH_STACK(prems->sets, d ? d->as_int : -1);
+  if (!d) d = bzla_hashint_map_add(prems->first, key);
+  d->as_int = BZLA_COUNT_STACK(prems->sets) - 1;
+  BZLA_PUSH_STACK(prems->sets, nids);
+  for (i = 0; i < nids; i++)
+    BZLA_PUSH_STACK(prems->sets, BZLA_PEEK_STACK(*ids, i));
+  return true;
+}
+
 static void
 add_lemma(Bzla *bzla, BzlaNode *fun, BzlaNode *app1, BzlaNode *app2)
 {
@@ -1466,6 +2325,7 @@ add_lemma(Bzla *bzla, BzlaNode *fun, BzlaNode *app1, BzlaNode *app2)
   double start;
   uint32_t i, lemma_size = 1;
   BzlaIntHashTable *cache_app1, *cache_app2;
+  BzlaIntStack prem_ids;
   BzlaNodePtrStack prem_app1, prem_app2, prem;
   BzlaNode *value, *tmp, *and, *con, *lemma;
   BzlaMemMgr *mm;
@@ -1479,6 +2339,7 @@ add_lemma(Bzla *bzla, BzlaNode *fun, BzlaNode *app1, BzlaNode *app2)
   BZLA_INIT_STACK(mm, prem_app1);
   BZLA_INIT_STACK(mm, prem_app2);
   BZLA_INIT_STACK(mm, prem);
+  BZLA_INIT_STACK(mm, prem_ids);
 
   /* collect premise and conclusion */
 
@@ -1534,17 +2395,25 @@ add_lemma(Bzla *bzla, BzlaNode *fun, BzlaNode *app1, BzlaNode *app2)
 
   /* create lemma */
   if (BZLA_EMPTY_STACK(prem))
-    lemma = con;
+    lemma = bzla_node_copy(bzla, con);
   else
   {
     and   = bzla_exp_bv_and_n(bzla, prem.start, BZLA_COUNT_STACK(prem));
     lemma = bzla_exp_implies(bzla, and, con);
+    collect_premise_ids(bzla, and, &prem_ids);
     bzla_node_release(bzla, and);
-    bzla_node_release(bzla, con);
   }
 
   assert(lemma != bzla->true_exp);
-  if (!bzla_hashptr_table_get(slv->lemmas, lemma))
+  if (bzla_hashptr_table_get(slv->lemmas, lemma))
+  {
+    slv->stats.lemmas_duplicate++;
+  }
+  else if (!add_to_lemma_store(slv, con, &prem_ids))
+  {
+    slv->stats.lemmas_subsumed++;
+  }
+  else
   {
     bzla_hashptr_table_add(slv->lemmas, bzla_node_copy(bzla, lemma));
     BZLA_PUSH_STACK(slv->cur_lemmas, lemma);
@@ -1555,6 +2424,7 @@ add_lemma(Bzla *bzla, BzlaNode *fun, BzlaNode *app1, BzlaNode *app2)
     slv->stats.lemmas_size.start[lemma_size] += 1;
   }
   bzla_node_release(bzla, lemma);
+  bzla_node_release(bzla, con);
 
   /* cleanup */
   for (i = 0; i < BZLA_COUNT_STACK(prem); i++)
@@ -1566,6 +2436,7 @@ add_lemma(Bzla *bzla, BzlaNode *fun, BzlaNode *app1, BzlaNode *app2)
   BZLA_RELEASE_STACK(prem_app1);
   BZLA_RELEASE_STACK(prem_app2);
   BZLA_RELEASE_STACK(prem);
+  BZLA_RELEASE_STACK(prem_ids);
   bzla_hashint_table_delete(cache_app1);
   bzla_hashint_table_delete(cache_app2);
   BZLA_FUN_SOLVER(bzla)->time.lemma_gen += bzla_util_time_stamp() - start;
@@ -1666,6 +2537,293 @@ find_conflict_app(Bzla *bzla, BzlaNode *app, BzlaIntHashTable *conf_apps)
   return res;
 }
 
+/* Check the initial applies 'apps' for function congruence conflicts between
+ * reads of the same function before they are propagated. The reads are
+ * grouped by function and the groups are checked on a thread pool (see
+ * fun-prop-threads). The model is not thread-safe, hence all values are
+ * fetched upfront. Lemmas are added in the order of the first read of each
+ * function in 'apps', and within a group in the order of the checked reads,
+ * hence they do not depend on the number of threads. */
+static void
+find_congruence_conflicts_parallel(Bzla *bzla, BzlaNodePtrStack *apps)
+{
+  assert(bzla);
+  assert(bzla->slv);
+  assert(bzla->slv->kind == BZLA_FUN_SOLVER_KIND);
+  assert(apps);
+
+  double start;
+  bool restart;
+  uint32_t i, j, g, n, nreads, opt_eager_lemmas;
+  BzlaMemMgr *mm;
+  BzlaFunSolver *slv;
+  BzlaNode *app, *fun, *args;
+  BzlaHashTableData *d;
+  BzlaIntHashTable *fun_groups, *conf_apps;
+  BzlaNodePtrStack funs, group_funs;
+  BzlaUIntStack counts, starts, groups;
+  BzlaArgsIterator it;
+  BzlaFunConfRead *r;
+  BzlaFunConfBatch batch;
+
+  start            = bzla_util_time_stamp();
+  mm               = bzla->mm;
+  slv              = BZLA_FUN_SOLVER(bzla);
+  opt_eager_lemmas = bzla_opt_get(bzla, BZLA_OPT_FUN_EAGER_LEMMAS);
+  fun_groups       = bzla_hashint_map_new(mm);
+  BZLA_INIT_STACK(mm, funs);
+  BZLA_INIT_STACK(mm, group_funs);
+  BZLA_INIT_STACK(mm, counts);
+  BZLA_INIT_STACK(mm, starts);
+  BZLA_INIT_STACK(mm, groups);
+
+  /* count the reads of each function */
+  for (i = 0; i < BZLA_COUNT_STACK(*apps); i++)
+  {
+    app = BZLA_PEEK_STACK(*apps, i);
+    fun = bzla_node_get_simplified(bzla, app->e[0]);
+    if (!(d = bzla_hashint_map_get(fun_groups, fun->id)))
+    {
+      d         = bzla_hashint_map_add(fun_groups, fun->id);
+      d->as_int = BZLA_COUNT_STACK(funs);
+      BZLA_PUSH_STACK(funs, fun);
+      BZLA_PUSH_STACK(counts, 0);
+    }
+    counts.start[d->as_int] += 1;
+  }
+
+  /* only functions with more than one read can have conflicts */
+  nreads = 0;
+  for (i = 0; i < BZLA_COUNT_STACK(funs); i++)
+  {
+    n = BZLA_PEEK_STACK(counts, i);
+    BZLA_PUSH_STACK(starts, n > 1 ? nreads : UINT32_MAX);
+    if (n < 2) continue;
+    BZLA_PUSH_STACK(group_funs, BZLA_PEEK_STACK(funs, i));
+    BZLA_PUSH_STACK(groups, nreads);
+    nreads += n;
+  }
+  BZLA_PUSH_STACK(groups, nreads);
+
+  if (nreads == 0) goto DONE;
+
+  BZLA_CNEWN(mm, batch.reads, nreads);
+  for (i = 0; i < BZLA_COUNT_STACK(*apps); i++)
+  {
+    app = BZLA_PEEK_STACK(*apps, i);
+    fun = bzla_node_get_simplified(bzla, app->e[0]);
+    g   = bzla_hashint_map_get(fun_groups, fun->id)->as_int;
+    if (BZLA_PEEK_STACK(starts, g) == UINT32_MAX) continue;
+
+    r = &batch.reads[starts.start[g]++];
+    assert(bzla_node_is_regular(app->e[1]));
+    args    = bzla_node_get_simplified(bzla, app->e[1]);
+    r->app  = app;
+    r->args = bzla_bv_new_tuple(mm, bzla_node_args_get_arity(bzla, args));
+    r->pos  = i;
+    j       = 0;
+    bzla_iter_args_init(&it, args);
+    while (bzla_iter_args_has_next(&it))
+      r->args->bv[j++] = get_bv_assignment(bzla, bzla_iter_args_next(&it));
+    r->value = get_bv_assignment(bzla, app);
+  }
+
+  batch.groups  = groups.start;
+  batch.ngroups = BZLA_COUNT_STACK(group_funs);
+  batch.next    = 0;
+  run_conf_batch(slv, &batch, bzla_opt_get(bzla, BZLA_OPT_FUN_PROP_THREADS));
+
+  conf_apps = bzla_hashint_table_new(mm);
+  restart   = false;
+  for (g = 0; g < batch.ngroups && !restart; g++)
+  {
+    fun = BZLA_PEEK_STACK(group_funs, g);
+    for (i = batch.groups[g]; i < batch.groups[g + 1] && !restart; i++)
+    {
+      r = &batch.reads[i];
+      if (r->conf < 0) continue;
+      app = batch.reads[batch.groups[g] + r->conf].app;
+      BZLALOG(1, "\e[1;31m");
+      BZLALOG(1, "FC conflict at: %s", bzla_util_node2string(fun));
+      BZLALOG(1, "add_lemma:");
+      BZLALOG(1, "  fun: %s", bzla_util_node2string(fun));
+      BZLALOG(1, "  app1: %s", bzla_util_node2string(app));
+      BZLALOG(1, "  app2: %s", bzla_util_node2string(r->app));
+      BZLALOG(1, "\e[0;39m");
+      restart = true;
+      if (opt_eager_lemmas == BZLA_FUN_EAGER_LEMMAS_CONF)
+      {
+        bzla_hashint_table_add(conf_apps, r->app->id);
+        restart = find_conflict_app(bzla, r->app, conf_apps);
+      }
+      else if (opt_eager_lemmas == BZLA_FUN_EAGER_LEMMAS_ALL)
+        restart = false;
+      slv->stats.function_congruence_conflicts++;
+      slv->stats.function_congruence_conflicts_pre++;
+      add_lemma(bzla, fun, app, r->app);
+    }
+  }
+  bzla_hashint_table_delete(conf_apps);
+
+  for (i = 0; i < nreads; i++)
+  {
+    bzla_bv_free_tuple(mm, batch.reads[i].args);
+    bzla_bv_free(mm, batch.reads[i].value);
+  }
+  BZLA_DELETEN(mm, batch.reads, nreads);
+DONE:
+  BZLA_RELEASE_STACK(groups);
+  BZLA_RELEASE_STACK(starts);
+  BZLA_RELEASE_STACK(counts);
+  BZLA_RELEASE_STACK(group_funs);
+  BZLA_RELEASE_STACK(funs);
+  bzla_hashint_map_delete(fun_groups);
+  slv->time.find_conf_app += bzla_util_time_stamp() - start;
+}
+
+/* Add store 'fun' of the weak equivalence path index 'sidx' to 'chains',
+ * which maps all functions on weak equivalence paths to their index.
+ * The indices of skipped functions are premisses of the lemmas generated for
+ * reads propagated over them, hence their values must be checked. Further,
+ * the values of skipped updates are checked as if the reads were propagated
+ * over them one by one. */
+static void
+add_weak_eq_path_store(Bzla *bzla,
+                       BzlaStoreIndex *sidx,
+                       BzlaNode *fun,
+                       BzlaIntHashTable *chains,
+                       BzlaNodePtrStack *prop_stack,
+                       BzlaIntHashTable *apply_search_cache)
+{
+  assert(bzla_node_is_regular(fun));
+  assert(!bzla_hashint_map_contains(chains, fun->id));
+
+  BzlaNode *args;
+  BzlaPtrHashTableIterator it;
+
+  bzla_hashint_map_add(chains, fun->id)->as_ptr = sidx;
+  if (bzla_node_is_update(fun))
+  {
+    push_applies_for_propagation(
+        bzla, fun->e[1], prop_stack, apply_search_cache);
+    push_applies_for_propagation(
+        bzla, fun->e[2], prop_stack, apply_search_cache);
+  }
+  else
+  {
+    bzla_iter_hashptr_init(&it, bzla_node_lambda_get_static_rho(fun));
+    while (bzla_iter_hashptr_has_next(&it))
+    {
+      args = bzla_node_get_simplified(bzla, bzla_iter_hashptr_next(&it));
+      push_applies_for_propagation(bzla, args, prop_stack, apply_search_cache);
+    }
+  }
+}
+
+/* Get the index of the weak equivalence path that 'fun' is on, or create a
+ * new one starting at 'fun'. The path consists of updates and array lambdas
+ * extracted from memset/memcpy/iterative initialization patterns, and is
+ * indexed by the current assignment of the update and static_rho indices
+ * (see bzlastoreidx.h). It ends at functions that are not on such a path,
+ * and at functions on other paths. */
+static BzlaStoreIndex *
+get_weak_eq_path(Bzla *bzla,
+                 BzlaNode *fun,
+                 BzlaIntHashTable *chains,
+                 BzlaVoidPtrStack *indices,
+                 BzlaNodePtrStack *prop_stack,
+                 BzlaIntHashTable *apply_search_cache)
+{
+  assert(bzla);
+  assert(fun);
+  assert(bzla_node_is_regular(fun));
+  assert(chains);
+  assert(indices);
+
+  BzlaHashTableData *d;
+  BzlaStoreIndex *res;
+
+  if ((d = bzla_hashint_map_get(chains, fun->id))) return d->as_ptr;
+
+  res = bzla_store_index_new(bzla,
+                             BZLA_STORE_INDEX_ASSIGNMENT,
+                             fun,
+                             (BzlaHashPtr) hash_args_assignment,
+                             (BzlaCmpPtr) compare_args_assignments);
+  BZLA_PUSH_STACK(*indices, res);
+  add_weak_eq_path_store(
+      bzla, res, fun, chains, prop_stack, apply_search_cache);
+  return res;
+}
+
+/* Find the first function below 'upd' in 'sidx' with an index assigned to
+ * the same value as 'args', or the base of 'sidx' if there is none. The
+ * index is extended as far as required. Read 'app' is recorded in the rho of
+ * all functions in between, as if it was propagated over them one by one, and
+ * their number is stored in 'skipped'. */
+static BzlaNode *
+find_weak_eq_path_target(Bzla *bzla,
+                         BzlaStoreIndex *sidx,
+                         BzlaNode *upd,
+                         BzlaNode *app,
+                         BzlaNode *args,
+                         uint32_t *skipped,
+                         BzlaIntHashTable *chains,
+                         BzlaNodePtrStack *prop_stack,
+                         BzlaPtrHashTable *cleanup_table,
+                         BzlaIntHashTable *apply_search_cache)
+{
+  assert(sidx);
+  assert(sidx->kind == BZLA_STORE_INDEX_ASSIGNMENT);
+  assert(upd);
+  assert(app);
+  assert(args);
+  assert(skipped);
+
+  bool found;
+  int32_t i, pos, target;
+  BzlaNode *cur;
+
+  pos   = bzla_store_index_get_pos(sidx, upd);
+  found = bzla_store_index_find(sidx, args, pos, &target);
+
+  /* no match on the path indexed so far, extend it until a match is found */
+  while (!found && !sidx->base
+         && (cur = bzla_store_index_extend(bzla, sidx, chains)))
+  {
+    add_weak_eq_path_store(
+        bzla, sidx, cur, chains, prop_stack, apply_search_cache);
+    found = bzla_store_index_find(sidx, args, pos, &target);
+  }
+  if (!found) target = bzla_store_index_get_bottom(sidx) - 1;
+  assert(target < pos);
+
+  for (i = pos - 1; i > target; i--)
+  {
+    cur = bzla_store_index_get_store(sidx, i);
+    if (!cur->rho)
+    {
+      cur->rho = bzla_hashptr_table_new(bzla->mm,
+                                        (BzlaHashPtr) hash_args_assignment,
+                                        (BzlaCmpPtr) compare_args_assignments);
+      if (!bzla_hashptr_table_get(cleanup_table, cur))
+        bzla_hashptr_table_add(cleanup_table, cur);
+    }
+    /* function congruence conflicts with reads that are already recorded
+     * are detected at the target, which both reads propagate to */
+    if (!bzla_hashptr_table_get(cur->rho, args))
+      bzla_hashptr_table_add(cur->rho, args)->data.as_ptr = app;
+  }
+
+  *skipped = pos - target - 1;
+  if (!found)
+  {
+    assert(sidx->base);
+    return sidx->base;
+  }
+  return bzla_store_index_get_store(sidx, target);
+}
+
 static void
 propagate(Bzla *bzla,
           BzlaNodePtrStack *prop_stack,
@@ -1680,26 +2838,32 @@ propagate(Bzla *bzla,
   assert(apply_search_cache);
 
   double start;
-  uint32_t opt_eager_lemmas;
-  bool prop_down, conflict, restart;
+  uint32_t opt_eager_lemmas, skipped;
+  bool prop_down, conflict, restart, opt_weak_eq_paths;
   BzlaBitVector *bv;
   BzlaMemMgr *mm;
   BzlaFunSolver *slv;
-  BzlaNode *fun, *app, *args, *fun_value, *cur;
+  BzlaNode *fun, *app, *args, *fun_value, *cur, *next;
   BzlaNode *hashed_app;
   BzlaPtrHashBucket *b;
   BzlaPtrHashTableIterator it;
   BzlaPtrHashTable *conds;
-  BzlaIntHashTable *conf_apps;
-
-  start            = bzla_util_time_stamp();
-  mm               = bzla->mm;
-  slv              = BZLA_FUN_SOLVER(bzla);
-  conf_apps        = bzla_hashint_table_new(mm);
-  opt_eager_lemmas = bzla_opt_get(bzla, BZLA_OPT_FUN_EAGER_LEMMAS);
+  BzlaIntHashTable *conf_apps, *upd_chains;
+  BzlaVoidPtrStack chains;
+  BzlaStoreIndex *sidx;
+
+  start             = bzla_util_time_stamp();
+  mm                = bzla->mm;
+  slv               = BZLA_FUN_SOLVER(bzla);
+  conf_apps         = bzla_hashint_table_new(mm);
+  upd_chains        = bzla_hashint_map_new(mm);
+  opt_eager_lemmas  = bzla_opt_get(bzla, BZLA_OPT_FUN_EAGER_LEMMAS);
+  opt_weak_eq_paths = bzla_opt_get(bzla, BZLA_OPT_FUN_WEAK_EQ_PATHS) != 0;
+  BZLA_INIT_STACK(mm, chains);
 
   BZLALOG(1, "");
   BZLALOG(1, "*** %s", __FUNCTION__);
+
   while (!BZLA_EMPTY_STACK(*prop_stack))
   {
     fun = bzla_node_get_simplified(bzla, BZLA_POP_STACK(*prop_stack));
@@ -1841,9 +3005,35 @@ propagate(Bzla *bzla,
       }
       else
       {
+        next = fun->e[0];
+        /* skip updates with indices assigned to values different from
+         * 'args' on the weak equivalence path below 'fun' */
+        if (opt_weak_eq_paths
+            && bzla_store_index_get_next(bzla,
+                                         BZLA_STORE_INDEX_ASSIGNMENT,
+                                         bzla_node_get_simplified(bzla, next)))
+        {
+          sidx = get_weak_eq_path(bzla,
+                                  fun,
+                                  upd_chains,
+                                  &chains,
+                                  prop_stack,
+                                  apply_search_cache);
+          next = find_weak_eq_path_target(bzla,
+                                          sidx,
+                                          fun,
+                                          app,
+                                          args,
+                                          &skipped,
+                                          upd_chains,
+                                          prop_stack,
+                                          cleanup_table,
+                                          apply_search_cache);
+          slv->stats.propagations_skipped += skipped;
+        }
         app->propagated = 0;
         BZLA_PUSH_STACK(*prop_stack, app);
-        BZLA_PUSH_STACK(*prop_stack, fun->e[0]);
+        BZLA_PUSH_STACK(*prop_stack, next);
         slv->stats.propagations_down++;
       }
       push_applies_for_propagation(
@@ -1869,8 +3059,40 @@ propagate(Bzla *bzla,
     if (prop_down)
     {
       assert(bzla_node_is_apply(fun_value));
+      next = bzla_node_real_addr(fun_value)->e[0];
+      /* skip extracted lambdas without a static_rho index assigned to the
+       * same value as 'args' (and updates) on the chain below 'fun'.
+       * Note: 'next' is not necessarily the array below 'fun' on the chain,
+       *       e.g., reads within the range of a memcpy lambda propagate
+       *       down to the source array. */
+      if (opt_weak_eq_paths
+          && bzla_node_get_simplified(bzla, next)
+                 == bzla_store_index_get_next(
+                     bzla, BZLA_STORE_INDEX_ASSIGNMENT, fun)
+          && bzla_store_index_get_next(bzla,
+                                       BZLA_STORE_INDEX_ASSIGNMENT,
+                                       bzla_node_get_simplified(bzla, next)))
+      {
+        sidx = get_weak_eq_path(bzla,
+                                fun,
+                                upd_chains,
+                                &chains,
+                                prop_stack,
+                                apply_search_cache);
+        next = find_weak_eq_path_target(bzla,
+                                        sidx,
+                                        fun,
+                                        app,
+                                        args,
+                                        &skipped,
+                                        upd_chains,
+                                        prop_stack,
+                                        cleanup_table,
+                                        apply_search_cache);
+        slv->stats.propagations_skipped += skipped;
+      }
       BZLA_PUSH_STACK(*prop_stack, app);
-      BZLA_PUSH_STACK(*prop_stack, bzla_node_real_addr(fun_value)->e[0]);
+      BZLA_PUSH_STACK(*prop_stack, next);
       slv->stats.propagations_down++;
       app->propagated = 0;
       BZLALOG(1, "  propagate down: %s", bzla_util_node2string(app));
@@ -1930,6 +3152,10 @@ propagate(Bzla *bzla,
     /* stop at first conflict */
     if (restart && conflict) break;
   }
+  while (!BZLA_EMPTY_STACK(chains))
+    bzla_store_index_delete(bzla, BZLA_POP_STACK(chains));
+  BZLA_RELEASE_STACK(chains);
+  bzla_hashint_map_delete(upd_chains);
   bzla_hashint_table_delete(conf_apps);
   slv->time.prop += bzla_util_time_stamp() - start;
 }
@@ -2037,6 +3263,72 @@ generate_table(Bzla *bzla, BzlaNode *fun, BzlaNode **base_array)
   return table;
 }
 
+/* Add witness f(a) != g(a) for function equality f = g as a lemma
+ * f != g -> f(a) != g(a) if f = g is false in the current model (lazy
+ * extensionality). The witness is not required if the model already assigns
+ * f and g different values at some index. Returns true if a lemma was
+ * added. */
+static bool
+add_function_inequality_witness(Bzla *bzla, BzlaNode *feq)
+{
+  assert(bzla);
+  assert(bzla_node_is_regular(feq));
+  assert(bzla_node_is_fun_eq(feq));
+
+  bool needed;
+  BzlaNode *base0, *base1, *value, *neq, *con;
+  BzlaPtrHashTable *table0, *table1;
+  BzlaPtrHashTableIterator it;
+  BzlaPtrHashBucket *b;
+  BzlaFunSolver *slv;
+
+  slv = BZLA_FUN_SOLVER(bzla);
+
+  /* witness already created */
+  b = bzla_hashptr_table_get(bzla->feqs, feq);
+  assert(b);
+  if (b->data.as_int) return false;
+
+  /* not part of the bv skeleton, unconstrained */
+  if (!bzla_node_is_synth(feq)) return false;
+
+  base0 = base1 = 0;
+  table0        = generate_table(bzla, feq->e[0], &base0);
+  table1        = generate_table(bzla, feq->e[1], &base1);
+
+  needed = true;
+  bzla_iter_hashptr_init(&it, table0);
+  while (needed && bzla_iter_hashptr_has_next(&it))
+  {
+    value = it.bucket->data.as_ptr;
+    b     = bzla_hashptr_table_get(table1, bzla_iter_hashptr_next(&it));
+    if (b && !equal_bv_assignments(value, b->data.as_ptr)) needed = false;
+  }
+  bzla_hashptr_table_delete(table0);
+  bzla_hashptr_table_delete(table1);
+
+  if (!needed)
+  {
+    slv->stats.ext_witnesses_skipped++;
+    return false;
+  }
+
+  b = bzla_hashptr_table_get(bzla->feqs, feq);
+  b->data.as_int = 1;
+  neq            = create_function_inequality(bzla, feq);
+  con            = bzla_exp_implies(bzla, bzla_node_invert(feq), neq);
+  /* witness applies are fresh, hence the lemma is always new */
+  assert(!bzla_hashptr_table_get(slv->lemmas, con));
+  bzla_hashptr_table_add(slv->lemmas, bzla_node_copy(bzla, con));
+  BZLA_PUSH_STACK(slv->cur_lemmas, con);
+  slv->stats.ext_witnesses++;
+  slv->stats.lod_refinements++;
+  BZLALOG(1, "  add witness for %s", bzla_util_node2string(feq));
+  bzla_node_release(bzla, neq);
+  bzla_node_release(bzla, con);
+  return true;
+}
+
 static void
 add_extensionality_lemmas(Bzla *bzla)
 {
@@ -2045,7 +3337,7 @@ add_extensionality_lemmas(Bzla *bzla)
   assert(bzla->slv->kind == BZLA_FUN_SOLVER_KIND);
 
   double start, delta;
-  bool skip;
+  bool skip, opt_lazy_ext;
   BzlaBitVector *evalbv;
   uint32_t num_lemmas = 0;
   BzlaNode *cur, *cur_args, *app0, *app1, *eq, *con, *value;
@@ -2063,8 +3355,9 @@ add_extensionality_lemmas(Bzla *bzla)
   BZLALOG(1, "");
   BZLALOG(1, "*** %s", __FUNCTION__);
 
-  slv = BZLA_FUN_SOLVER(bzla);
-  mm  = bzla->mm;
+  slv          = BZLA_FUN_SOLVER(bzla);
+  mm           = bzla->mm;
+  opt_lazy_ext = bzla_opt_get(bzla, BZLA_OPT_FUN_LAZY_EXT) != 0;
   BZLA_INIT_STACK(mm, feqs);
   BZLA_INIT_STACK(mm, const_arrays);
 
@@ -2087,7 +3380,12 @@ add_extensionality_lemmas(Bzla *bzla)
     skip = bzla_bv_is_false(evalbv);
     bzla_bv_free(bzla->mm, evalbv);
 
-    if (skip) continue;
+    if (skip)
+    {
+      if (opt_lazy_ext && add_function_inequality_witness(bzla, cur))
+        num_lemmas++;
+      continue;
+    }
 
     base0 = base1 = 0;
     table0        = generate_table(bzla, cur->e[0], &base0);
@@ -2350,7 +3648,13 @@ check_and_resolve_conflicts(Bzla *bzla,
     BZLALOG(2, "push apply: %s", bzla_util_node2string(app));
   }
 
-  propagate(bzla, &prop_stack, cleanup_table, apply_search_cache);
+  if (bzla_opt_get(bzla, BZLA_OPT_FUN_PROP_THREADS) > 1)
+    find_congruence_conflicts_parallel(bzla, init_apps);
+
+  /* conflicts between the initial applies were already found, propagation
+   * would stop at (one of) them */
+  if (BZLA_EMPTY_STACK(slv->cur_lemmas))
+    propagate(bzla, &prop_stack, cleanup_table, apply_search_cache);
   found_conflicts = BZLA_COUNT_STACK(slv->cur_lemmas) > 0;
 
   /* check consistency of array/uf equalities */
@@ -2417,20 +3721,124 @@ check_and_resolve_conflicts(Bzla *bzla,
   slv->time.check_consistency += bzla_util_time_stamp() - start;
 }
 
+/* If lemmas are assumed, they are only active until the assumptions are
+ * reset. Re-assume the lemmas added in previous calls that are no longer
+ * assumed (they are still valid) instead of re-deriving them. The dual prop
+ * clone root is rebuilt for every call and receives all lemmas.
+ * Note: Only required if lemmas are assumed (see assume_lemmas). Lemmas added
+ *       as constraints stay active after pop. */
 static void
-reset_lemma_cache(BzlaFunSolver *slv)
+reactivate_lemmas(BzlaFunSolver *slv,
+                  Bzla *clone,
+                  BzlaNode **clone_root,
+                  BzlaNodeMap *exp_map)
 {
+  assert(slv);
+  assert(slv->assume_lemmas);
+
   Bzla *bzla;
+  BzlaNode *lemma;
   BzlaPtrHashTableIterator it;
+
   bzla = slv->bzla;
   bzla_iter_hashptr_init(&it, slv->lemmas);
   while (bzla_iter_hashptr_has_next(&it))
-    bzla_node_release(bzla, bzla_iter_hashptr_next(&it));
-  bzla_hashptr_table_delete(slv->lemmas);
+  {
+    lemma = bzla_iter_hashptr_next(&it);
+    if (!bzla_is_assumption_exp(bzla, lemma))
+    {
+      bzla_assume_exp(bzla, lemma);
+      slv->stats.lemmas_reactivated++;
+    }
+    if (clone)
+      add_lemma_to_dual_prop_clone(bzla,
+                                   clone,
+                                   clone_root,
+                                   bzla_simplify_exp(bzla, lemma),
+                                   exp_map);
+  }
+}
 
-  slv->lemmas = bzla_hashptr_table_new(bzla->mm,
-                                       (BzlaHashPtr) bzla_node_hash_by_id,
-                                       (BzlaCmpPtr) bzla_node_compare_by_id);
+/* Record the current assignments of all inputs (vars, applies, feqs) for
+ * seeding the phases of the SAT solver in the next SAT call. If 'from_sat'
+ * is true, the assignments are taken from the SAT solver, else from the
+ * current bit-vector model (the partial model of the local search engine). */
+static void
+save_phases(BzlaFunSolver *slv, bool from_sat)
+{
+  size_t i;
+  Bzla *bzla;
+  BzlaNode *cur;
+  BzlaBitVector *bv;
+  BzlaHashTableData *d;
+
+  bzla = slv->bzla;
+
+  delete_phases(slv);
+  slv->phases = bzla_hashint_map_new(bzla->mm);
+
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); i++)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || bzla_node_is_proxy(cur) || cur->parameterized) continue;
+    if (!bzla_lsutils_is_leaf_node(cur)) continue;
+
+    if (from_sat)
+    {
+      if (!cur->av) continue;
+      bv = bzla_model_get_bv_assignment(bzla, cur);
+    }
+    else
+    {
+      if (!bzla->bv_model) break;
+      d = bzla_hashint_map_get(bzla->bv_model, cur->id);
+      if (!d) continue;
+      bv = bzla_bv_copy(bzla->mm, d->as_ptr);
+    }
+    bzla_hashint_map_add(slv->phases, cur->id)->as_ptr = bv;
+  }
+}
+
+/* Seed the phases of the SAT variables of all synthesized inputs with the
+ * assignments recorded via save_phases. */
+static void
+seed_phases(BzlaFunSolver *slv)
+{
+  uint32_t i, j, width;
+  int32_t id;
+  Bzla *bzla;
+  BzlaNode *cur;
+  BzlaBitVector *bv;
+  BzlaAIGMgr *amgr;
+  BzlaIntHashTableIterator it;
+
+  if (!slv->phases) return;
+
+  bzla = slv->bzla;
+  amgr = bzla_get_aig_mgr(bzla);
+
+  if (bzla_sat_mgr_has_phase_support(bzla_get_sat_mgr(bzla)))
+  {
+    bzla_iter_hashint_init(&it, slv->phases);
+    while (bzla_iter_hashint_has_next(&it))
+    {
+      bv  = slv->phases->data[it.cur_pos].as_ptr;
+      id  = bzla_iter_hashint_next(&it);
+      cur = bzla_node_get_by_id(bzla, id);
+      if (!cur || bzla_node_is_proxy(cur) || !cur->av) continue;
+
+      width = cur->av->width;
+      if (width != bzla_bv_get_width(bv)) continue;
+
+      for (i = 0, j = width - 1; i < width; i++, j--)
+      {
+        bzla_aig_set_phase(
+            amgr, cur->av->aigs[j], bzla_bv_get_bit(bv, i) ? 1 : -1);
+      }
+      slv->stats.phases_seeded += width;
+    }
+  }
+  delete_phases(slv);
 }
 
 static void
@@ -2528,6 +3936,14 @@ check_sat_prels(BzlaFunSolver *slv, BzlaSolver **ls_slv)
                ? "sat"
                : (result == BZLA_RESULT_UNSAT ? "unsat" : "unknown"));
 
+  /* Use the partial model of the prels engine as initial phases of the
+   * bit-blasting engine. */
+  if (result == BZLA_RESULT_UNKNOWN
+      && bzla_opt_get(bzla, BZLA_OPT_SAT_ENGINE_PHASES) && !bzla_terminate(bzla))
+  {
+    save_phases(slv, false);
+  }
+
   /* Use the partial model of the prels engine and determine input assignments
    * that already satisfy constraints and separated from all other unsatisfied
    * constraints. Assert these assignments to the bit-blasting engine. */
@@ -2648,7 +4064,8 @@ sat_fun_solver(BzlaFunSolver *slv)
   assert(slv->bzla->slv == (BzlaSolver *) slv);
 
   uint32_t i;
-  bool opt_prels, opt_prop_const_bits;
+  bool opt_prels, opt_prop_const_bits, opt_phases, opt_compact;
+  bool bb_model = false, reuse_bv_model = false;
   BzlaSolverResult result;
   Bzla *bzla, *clone;
   BzlaNode *clone_root, *lemma;
@@ -2663,6 +4080,8 @@ sat_fun_solver(BzlaFunSolver *slv)
   opt_prels = bzla_opt_get(bzla, BZLA_OPT_FUN_PREPROP)
               || bzla_opt_get(bzla, BZLA_OPT_FUN_PRESLS);
   opt_prop_const_bits = bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_BITS) != 0;
+  opt_phases          = bzla_opt_get(bzla, BZLA_OPT_SAT_ENGINE_PHASES) != 0;
+  opt_compact         = bzla_opt_get(bzla, BZLA_OPT_SAT_ENGINE_COMPACT) != 0;
 
   assert(!bzla->inconsistent);
 
@@ -2683,16 +4102,21 @@ sat_fun_solver(BzlaFunSolver *slv)
     goto DONE;
   }
 
-  if (slv->assume_lemmas) reset_lemma_cache(slv);
-
   if (bzla->feqs->count > 0) add_function_inequality_constraints(bzla);
 
   /* initialize dual prop clone */
   if (bzla_opt_get(bzla, BZLA_OPT_FUN_DUAL_PROP))
   {
-    clone = new_exp_layer_clone_for_dual_prop(bzla, &exp_map, &clone_root);
+    clone   = get_dual_prop_clone(slv, &clone_root);
+    exp_map = slv->dp_exp_map;
+  }
+  else
+  {
+    delete_dual_prop_clone(slv);
   }
 
+  if (slv->assume_lemmas) reactivate_lemmas(slv, clone, &clone_root, exp_map);
+
   BzlaPtrHashTableIterator it;
   bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
   bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
@@ -2730,6 +4154,7 @@ sat_fun_solver(BzlaFunSolver *slv)
       }
       result = check_sat_prels(slv, &ls_slv);
     }
+    bb_model = false;
 
     if (result == BZLA_RESULT_UNKNOWN)
     {
@@ -2747,14 +4172,28 @@ sat_fun_solver(BzlaFunSolver *slv)
       assert(bzla_dbg_check_all_hash_tables_proxy_free(bzla));
       assert(bzla_dbg_check_all_hash_tables_simp_free(bzla));
 
+      /* seed phases with previous model or partial prels model */
+      if (opt_phases) seed_phases(slv);
+
+      if (opt_compact && !bzla_get_sat_mgr(bzla)->inc_required)
+      {
+        compact_aigs(bzla);
+      }
+
       /* make SAT call on bv skeleton */
-      result = timed_sat_sat(bzla, slv->sat_limit);
+      result   = timed_sat_sat(bzla, slv->sat_limit);
+      bb_model = true;
 
       /* Initialize new bit vector model, which will be constructed while
-       * consistency checking. This also deletes the model from the previous
-       * run.
+       * consistency checking. If the model of the previous refinement round
+       * was also generated from a SAT assignment, only invalidate the values
+       * that may have changed, else delete the model from the previous run.
        */
-      bzla_model_init_bv(bzla, &bzla->bv_model);
+      if (reuse_bv_model && bzla->bv_model && !bzla->word_blaster)
+        update_bv_model(bzla);
+      else
+        bzla_model_init_bv(bzla, &bzla->bv_model);
+      reuse_bv_model = !opt_prels;
     }
 
     if (result == BZLA_RESULT_UNSAT)
@@ -2789,7 +4228,19 @@ sat_fun_solver(BzlaFunSolver *slv)
       else
         bzla_insert_unsynthesized_constraint(bzla, lemma);
       if (clone)
+      {
         add_lemma_to_dual_prop_clone(bzla, clone, &clone_root, lemma, exp_map);
+        /* lemmas added as constraints are kept in the clone */
+        if (!slv->assume_lemmas && !bzla_node_is_bv_const(lemma))
+        {
+          add_lemma_to_dual_prop_clone(
+              bzla, clone, &slv->dp_root, lemma, exp_map);
+          if (!bzla_hashint_table_contains(slv->dp_constraints,
+                                           bzla_node_get_id(lemma)))
+            bzla_hashint_table_add(slv->dp_constraints,
+                                   bzla_node_get_id(lemma));
+        }
+      }
       BZLA_PUSH_STACK(slv->constraints, bzla_node_copy(bzla, lemma));
     }
     BZLA_RESET_STACK(slv->cur_lemmas);
@@ -2815,17 +4266,15 @@ sat_fun_solver(BzlaFunSolver *slv)
     }
   }
 
+  /* Remember model values as initial phases for the next SAT call. */
+  if (result == BZLA_RESULT_SAT && opt_phases) save_phases(slv, bb_model);
+
 DONE:
   BZLA_RELEASE_STACK(init_apps);
   bzla_hashint_table_delete(init_apps_cache);
 
-  if (clone)
-  {
-    assert(exp_map);
-    bzla_nodemap_delete(exp_map);
-    bzla_node_release(clone, clone_root);
-    bzla_delete(clone);
-  }
+  /* the dual prop clone is kept for subsequent sat calls */
+  if (clone) bzla_node_release(clone, clone_root);
   if (ls_slv)
   {
     bzla->slv = ls_slv;
@@ -2885,6 +4334,15 @@ print_stats_fun_solver(BzlaFunSolver *slv)
              slv->stats.prels_shared);
   }
 
+  if (bzla_opt_get(bzla, BZLA_OPT_SAT_ENGINE_PHASES))
+  {
+    BZLA_MSG(bzla->msg, 1, "");
+    BZLA_MSG(bzla->msg,
+             1,
+             "%7lld SAT variable phases seeded from model values",
+             slv->stats.phases_seeded);
+  }
+
   if (bzla->ufs->count || bzla->lambdas->count)
   {
     BZLA_MSG(bzla->msg, 1, "");
@@ -2900,6 +4358,13 @@ print_stats_fun_solver(BzlaFunSolver *slv)
                1,
                "  %4d function congruence conflicts",
                slv->stats.function_congruence_conflicts);
+      if (bzla_opt_get(bzla, BZLA_OPT_FUN_PROP_THREADS) > 1)
+      {
+        BZLA_MSG(bzla->msg,
+                 1,
+                 "    %4d found before propagation",
+                 slv->stats.function_congruence_conflicts_pre);
+      }
       BZLA_MSG(bzla->msg,
                1,
                "  %4d beta reduction conflicts",
@@ -2908,6 +4373,34 @@ print_stats_fun_solver(BzlaFunSolver *slv)
                1,
                "  %4d extensionality lemmas",
                slv->stats.extensionality_lemmas);
+      if (bzla_opt_get(bzla, BZLA_OPT_FUN_LAZY_EXT))
+      {
+        BZLA_MSG(bzla->msg,
+                 1,
+                 "  %4d function inequality witnesses (%d skipped)",
+                 slv->stats.ext_witnesses,
+                 slv->stats.ext_witnesses_skipped);
+      }
+      BZLA_MSG(bzla->msg,
+               1,
+               "  %4d duplicate lemmas (%.1f%%)",
+               slv->stats.lemmas_duplicate,
+               100 * BZLA_AVERAGE_UTIL(slv->stats.lemmas_duplicate,
+                                       slv->stats.lod_refinements
+                                           + slv->stats.lemmas_duplicate
+                                           + slv->stats.lemmas_subsumed));
+      BZLA_MSG(bzla->msg,
+               1,
+               "  %4d subsumed lemmas (%.1f%%)",
+               slv->stats.lemmas_subsumed,
+               100 * BZLA_AVERAGE_UTIL(slv->stats.lemmas_subsumed,
+                                       slv->stats.lod_refinements
+                                           + slv->stats.lemmas_duplicate
+                                           + slv->stats.lemmas_subsumed));
+      BZLA_MSG(bzla->msg,
+               1,
+               "  %4d reactivated lemmas",
+               slv->stats.lemmas_reactivated);
       BZLA_MSG(bzla->msg,
                1,
                "  %.1f average lemma size",
@@ -2928,13 +4421,52 @@ print_stats_fun_solver(BzlaFunSolver *slv)
              1,
              "%7lld expression evaluations",
              slv->stats.eval_exp_calls);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%7lld model values reused",
+             slv->stats.model_values_reused);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%7lld model values invalidated",
+             slv->stats.model_values_invalidated);
     BZLA_MSG(bzla->msg,
              1,
              "%7lld partial beta reductions",
              bzla->stats.betap_reduce_calls);
+    if (slv->beta_cache)
+    {
+      BZLA_MSG(bzla->msg,
+               1,
+               "%7lld partial beta reduction cache hits (%.1f%%)",
+               slv->beta_cache->stats.hits,
+               100 * BZLA_AVERAGE_UTIL(slv->beta_cache->stats.hits,
+                                       slv->beta_cache->stats.hits
+                                           + slv->beta_cache->stats.misses));
+      BZLA_MSG(bzla->msg,
+               1,
+               "%7lld partial beta reduction cache misses",
+               slv->beta_cache->stats.misses);
+      BZLA_MSG(bzla->msg,
+               1,
+               "%7lld partial beta reduction cache invalidations",
+               slv->beta_cache->stats.invalidated);
+      BZLA_MSG(bzla->msg,
+               1,
+               "%7lld partial beta reduction cache evictions",
+               slv->beta_cache->stats.evictions);
+      BZLA_MSG(bzla->msg,
+               1,
+               "%7u partial beta reduction cache entries (%zu bytes)",
+               slv->beta_cache->table->count,
+               slv->beta_cache->bytes);
+    }
     BZLA_MSG(bzla->msg, 1, "%7lld propagations", slv->stats.propagations);
     BZLA_MSG(
         bzla->msg, 1, "%7lld propagations down", slv->stats.propagations_down);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%7lld propagations skipped",
+             slv->stats.propagations_skipped);
   }
 
   if (bzla_opt_get(bzla, BZLA_OPT_FUN_DUAL_PROP))
@@ -2949,6 +4481,11 @@ print_stats_fun_solver(BzlaFunSolver *slv)
              "%d/%d dual prop. applies (failed/assumed)",
              slv->stats.dp_failed_applies,
              slv->stats.dp_assumed_applies);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%d/%d dual prop. clones (built/reused)",
+             slv->stats.dp_clones,
+             slv->stats.dp_clones_reused);
   }
 }
 
@@ -3086,6 +4623,10 @@ bzla_new_fun_solver(Bzla *bzla)
   slv->lemmas = bzla_hashptr_table_new(bzla->mm,
                                        (BzlaHashPtr) bzla_node_hash_by_id,
                                        (BzlaCmpPtr) bzla_node_compare_by_id);
+  slv->lemma_prems =
+      bzla_hashptr_table_new(bzla->mm,
+                             (BzlaHashPtr) bzla_node_hash_by_id,
+                             (BzlaCmpPtr) bzla_node_compare_by_id);
   BZLA_INIT_STACK(bzla->mm, slv->cur_lemmas);
   BZLA_INIT_STACK(bzla->mm, slv->constraints);
 
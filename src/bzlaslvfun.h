@@ -11,25 +11,78 @@
 #ifndef BZLASLVFUN_H_INCLUDED
 #define BZLASLVFUN_H_INCLUDED
 
+#include "bzlabeta.h"
 #include "bzlanode.h"
 #include "bzlaslv.h"
+#include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
+#include "utils/bzlanodemap.h"
 
 #define BZLA_FUN_SOLVER(bzla) ((BzlaFunSolver *) (bzla)->slv)
 
+/* Premise sets of the lemmas with the same conclusion. */
+struct BzlaLemmaPrems
+{
+  /* Each premise set is stored as the position of the previous set with the
+   * same smallest id (-1 if none), its size and the sorted ids of its
+   * conjuncts. */
+  BzlaIntStack sets;
+  /* Maps the smallest id of a premise set (0 if empty) to the position of the
+   * last set added with that id. A premise set can only be a subset of
+   * another if its smallest id occurs in the other set. */
+  BzlaIntHashTable *first;
+};
+
+typedef struct BzlaLemmaPrems BzlaLemmaPrems;
+typedef struct BzlaFunConfPool BzlaFunConfPool;
+
 struct BzlaFunSolver
 {
   BZLA_SOLVER_STRUCT;
 
   BzlaPtrHashTable *lemmas;
+  /* Maps lemma conclusions to the premise sets of the lemmas added for them
+   * (BzlaLemmaPrems). Used for detecting subsumed lemmas. */
+  BzlaPtrHashTable *lemma_prems;
   BzlaNodePtrStack cur_lemmas;
   BzlaNodePtrStack constraints;
 
   BzlaPtrHashTable *score; /* dcr score */
+  /* Nodes whose cone has already been searched for nodes that require a dcr
+   * score, kept across refinement rounds. Not cloned. */
+  BzlaIntHashTable *score_cone;
+
+  /* Maps input ids to model values used for seeding the phases of the SAT
+   * solver in the next SAT call (if enabled via sat-engine-phases). */
+  BzlaIntHashTable *phases;
+
+  /* Partial beta reduction results kept across refinement rounds (if enabled
+   * via fun-beta-cache-size). Not cloned. */
+  BzlaBetaCache *beta_cache;
+
+  /* Expression layer clone for dual propagation (if enabled via
+   * fun-dual-prop), kept across sat calls. 'dp_root' is the conjunction of
+   * the constraints in the clone, 'dp_constraints' holds the ids of the
+   * constraints it was built from. Not cloned. */
+  Bzla *dp_clone;
+  BzlaNodeMap *dp_exp_map;
+  BzlaNode *dp_root;
+  BzlaIntHashTable *dp_constraints;
+
+  /* Thread pool for checking reads for function congruence conflicts (if
+   * enabled via fun-prop-threads), kept across sat calls. Not cloned. */
+  BzlaFunConfPool *conf_pool;
 
   // TODO (ma): make options for these
   int32_t lod_limit;
   int32_t sat_limit;
+  /* Assume lemmas instead of adding them as constraints. Only set for the
+   * ground solver of the quantifier engine, which resets its assumptions for
+   * every sat call, hence cached lemmas are re-assumed (reactivate_lemmas).
+   * Otherwise, lemmas are permanent constraints that are valid independent
+   * of the context level (assertions at levels > 0 are assumptions, see
+   * bitwuzla_assert), hence they are not affected by pop and need not be
+   * re-activated or re-derived. */
   bool assume_lemmas;
 
   struct
@@ -38,8 +91,20 @@ struct BzlaFunSolver
     uint32_t refinement_iterations;
 
     uint32_t function_congruence_conflicts;
+    /* function congruence conflicts found before propagation (if enabled
+     * via fun-prop-threads) */
+    uint32_t function_congruence_conflicts_pre;
     uint32_t beta_reduction_conflicts;
     uint32_t extensionality_lemmas;
+    /* number of function inequality witnesses added/not required (if
+     * created lazily via fun-lazy-ext) */
+    uint32_t ext_witnesses;
+    uint32_t ext_witnesses_skipped;
+    uint32_t lemmas_duplicate; /* lemmas generated more than once */
+    uint32_t lemmas_subsumed;  /* lemmas subsumed by a lemma with the same
+                                  conclusion and fewer premises */
+    uint32_t lemmas_reactivated; /* cached lemmas re-assumed in subsequent
+                                    sat calls (if lemmas are assumed) */
 
     BzlaUIntStack lemmas_size;      /* distribution of n-size lemmas */
     uint_least64_t lemmas_size_sum; /* sum of the size of all added lemmas */
@@ -52,13 +117,23 @@ struct BzlaFunSolver
     uint32_t dp_assumed_applies;
     uint32_t dp_failed_eqs;
     uint32_t dp_assumed_eqs;
+    uint32_t dp_clones;        /* number of dual prop clones built */
+    uint32_t dp_clones_reused; /* number of sat calls reusing the clone */
 
     /* number of assignments shared from local search engine */
     uint32_t prels_shared;
 
+    /* number of SAT variables with phases seeded from model values */
+    uint_least64_t phases_seeded;
+
     uint_least64_t eval_exp_calls;
+    /* number of model values kept/invalidated between refinement rounds */
+    uint_least64_t model_values_reused;
+    uint_least64_t model_values_invalidated;
     uint_least64_t propagations;
     uint_least64_t propagations_down;
+    /* number of updates skipped on weak equivalence index paths */
+    uint_least64_t propagations_skipped;
   } stats;
 
   struct
@@ -31,8 +31,14 @@
 #include "utils/bzlahash.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
+#include "utils/bzlanodeiter.h"
 #include "utils/bzlautil.h"
 
+#ifdef BZLA_HAVE_PTHREADS
+#include <pthread.h>
+#include <time.h>
+#endif
+
 /*------------------------------------------------------------------------*/
 
 #define BZLA_PROP_MAXSTEPS_CFACT 100
@@ -297,6 +303,21 @@ DONE:
 
 /*------------------------------------------------------------------------*/
 
+static void
+clone_data_as_bvdomain(BzlaMemMgr *mm,
+                       const void *map,
+                       BzlaHashTableData *data,
+                       BzlaHashTableData *cloned_data)
+{
+  assert(mm);
+  assert(data);
+  assert(cloned_data);
+
+  (void) map;
+
+  cloned_data->as_ptr = bzla_bvdomain_copy(mm, data->as_ptr);
+}
+
 static BzlaPropSolver *
 clone_prop_solver(Bzla *clone, BzlaPropSolver *slv, BzlaNodeMap *exp_map)
 {
@@ -315,7 +336,12 @@ clone_prop_solver(Bzla *clone, BzlaPropSolver *slv, BzlaNodeMap *exp_map)
   res->roots = bzla_hashint_map_clone(clone->mm, slv->roots, 0, 0);
   res->score =
       bzla_hashint_map_clone(clone->mm, slv->score, bzla_clone_data_as_dbl, 0);
-  // TODO clone const_bits
+  res->domains = bzla_hashint_map_clone(
+      clone->mm, slv->domains, clone_data_as_bvdomain, 0);
+  if (slv->warm_model)
+    res->warm_model = bzla_model_clone_bv(clone, slv->warm_model, false);
+  /* only maintained during a satisfiability check, not cloned */
+  res->value_cache = 0;
 
   bzla_proputils_clone_prop_info_stack(
       clone->mm, &slv->toprop, &res->toprop, exp_map);
@@ -346,6 +372,9 @@ delete_prop_solver(BzlaPropSolver *slv)
     bzla_bvdomain_free(slv->bzla->mm, bzla_iter_hashint_next_data(&it)->as_ptr);
   }
   bzla_hashint_map_delete(slv->domains);
+  bzla_model_delete_bv(slv->bzla, &slv->warm_model);
+  if (slv->value_cache)
+    bzla_proputils_value_cache_delete(slv->bzla->mm, slv->value_cache);
 
   assert(BZLA_EMPTY_STACK(slv->toprop));
   BZLA_RELEASE_STACK(slv->toprop);
@@ -443,197 +472,419 @@ bzla_prop_solver_init_domains(Bzla *bzla,
   BZLA_RELEASE_STACK(visit);
 }
 
+/* Returns the number of fixed bits of domain 'd'. */
+static uint32_t
+count_fixed_bits(const BzlaBvDomain *d)
+{
+  uint32_t i, bw, res;
+
+  bw = bzla_bvdomain_get_width(d);
+  for (i = 0, res = 0; i < bw; i++)
+  {
+    if (bzla_bvdomain_is_fixed_bit(d, i)) res += 1;
+  }
+  return res;
+}
+
+/* Refine the domain of 'n' with 'new_domain', i.e., fix all bits that are
+ * fixed in 'new_domain'. Note that if 'n' is inverted, 'new_domain' is the
+ * domain of the inverted node. The domain of the inverted node is updated
+ * accordingly. Returns true if the domain of 'n' changed. Sets 'conflict' to
+ * true (and does not update the domain) if the refined domain is invalid. */
 static bool
 update_domain(Bzla *bzla,
               BzlaIntHashTable *domains,
               const BzlaNode *n,
-              BzlaBvDomain *old_domain,
-              BzlaBvDomain *new_domain)
+              const BzlaBvDomain *new_domain,
+              bool *conflict)
 {
   assert(domains);
   assert(n);
-  assert(old_domain);
+  assert(conflict);
 
   int32_t id;
   BzlaHashTableData *d;
   BzlaMemMgr *mm;
+  BzlaBitVector *lo, *hi, *tmp;
+  BzlaBvDomain *old_domain, *res;
 
   if (!new_domain) return false;
-  if (bzla_bvdomain_is_equal(old_domain, new_domain)) return false;
 
   mm = bzla->mm;
   id = bzla_node_get_id(bzla_node_real_addr(n));
   d  = bzla_hashint_map_get(domains, id);
   assert(d);
-  bzla_bvdomain_free(mm, d->as_ptr);
-  d->as_ptr = bzla_bvdomain_copy(mm, new_domain);
+  old_domain = d->as_ptr;
+  assert(bzla_bvdomain_get_width(old_domain)
+         == bzla_bvdomain_get_width(new_domain));
+
+  if (bzla_node_is_inverted(n))
+  {
+    lo = bzla_bv_not(mm, new_domain->hi);
+    hi = bzla_bv_not(mm, new_domain->lo);
+  }
+  else
+  {
+    lo = bzla_bv_copy(mm, new_domain->lo);
+    hi = bzla_bv_copy(mm, new_domain->hi);
+  }
+  /* The domains of the children of a node may have been updated since they
+   * were propagated (e.g., if a node occurs as both operands), hence we
+   * always intersect with the current domain. */
+  tmp = bzla_bv_or(mm, old_domain->lo, lo);
+  bzla_bv_free(mm, lo);
+  lo  = tmp;
+  tmp = bzla_bv_and(mm, old_domain->hi, hi);
+  bzla_bv_free(mm, hi);
+  hi  = tmp;
+  res = bzla_bvdomain_new(mm, lo, hi);
+  bzla_bv_free(mm, lo);
+  bzla_bv_free(mm, hi);
+
+  if (!bzla_bvdomain_is_valid(mm, res))
+  {
+    *conflict = true;
+    bzla_bvdomain_free(mm, res);
+    return false;
+  }
+  if (bzla_bvdomain_is_equal(old_domain, res))
+  {
+    bzla_bvdomain_free(mm, res);
+    return false;
+  }
+
+  BZLA_PROP_SOLVER(bzla)->stats.domain_fixed_bits +=
+      count_fixed_bits(res) - count_fixed_bits(old_domain);
+
+  bzla_bvdomain_free(mm, old_domain);
+  d->as_ptr = res;
 
   d = bzla_hashint_map_get(domains, -id);
   assert(d);
   bzla_bvdomain_free(mm, d->as_ptr);
-  d->as_ptr = bzla_bvdomain_not(mm, new_domain);
+  d->as_ptr = bzla_bvdomain_not(mm, res);
   return true;
 }
 
+/* Returns true if domains are propagated via the domain propagator of 'n'. */
+static bool
+has_domain_propagator(BzlaNode *n)
+{
+  assert(bzla_node_is_regular(n));
+  return n->arity > 0 && !bzla_lsutils_is_leaf_node(n)
+         && !bzla_node_is_fun(n) && !bzla_node_is_args(n);
+}
+
+/* Apply the domain propagator of node 'n' with domain 'd_n' and domains 'd_e'
+ * of its children. Resulting domains are stored in 'res_d_n' and 'res_d_e'
+ * (0 if there is no propagator for the kind of 'n'). Returns false if a
+ * conflict was detected, i.e., if an invalid domain was computed. */
+static bool
+propagate_domain(BzlaMemMgr *mm,
+                 BzlaNode *n,
+                 BzlaBvDomain *d_n,
+                 BzlaBvDomain **d_e,
+                 BzlaBvDomain **res_d_n,
+                 BzlaBvDomain **res_d_e)
+{
+  assert(bzla_node_is_regular(n));
+
+  bool res;
+
+  res = true;
+  if (bzla_node_is_bv_slice(n))
+  {
+    res = bzla_bvprop_slice(mm,
+                            d_e[0],
+                            d_n,
+                            bzla_node_bv_slice_get_upper(n),
+                            bzla_node_bv_slice_get_lower(n),
+                            &res_d_e[0],
+                            res_d_n);
+  }
+  else if (bzla_node_is_bv_and(n))
+  {
+    res = bzla_bvprop_and(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_eq(n))
+  {
+    res = bzla_bvprop_eq(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_add(n))
+  {
+    res = bzla_bvprop_add(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_mul(n))
+  {
+    res = bzla_bvprop_mul(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_ult(n))
+  {
+    res = bzla_bvprop_ult(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_slt(n))
+  {
+    res = bzla_bvprop_slt(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_sll(n))
+  {
+    res = bzla_bvprop_sll(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_srl(n))
+  {
+    res = bzla_bvprop_srl(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_udiv(n))
+  {
+    res = bzla_bvprop_udiv(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_urem(n))
+  {
+    res = bzla_bvprop_urem(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_concat(n))
+  {
+    res = bzla_bvprop_concat(
+        mm, d_e[0], d_e[1], d_n, &res_d_e[0], &res_d_e[1], res_d_n);
+  }
+  else if (bzla_node_is_bv_cond(n))
+  {
+    res = bzla_bvprop_cond(mm,
+                           d_e[1],
+                           d_e[2],
+                           d_n,
+                           d_e[0],
+                           &res_d_e[1],
+                           &res_d_e[2],
+                           res_d_n,
+                           &res_d_e[0]);
+  }
+  return res;
+}
+
+/* Queue node 'n' for domain propagation (if it is not queued yet). */
+static void
+queue_domain_propagation(BzlaNodePtrQueue *queue,
+                         BzlaIntHashTable *queued,
+                         BzlaNode *n)
+{
+  assert(bzla_node_is_regular(n));
+
+  if (!has_domain_propagator(n)) return;
+  if (bzla_hashint_table_contains(queued, n->id)) return;
+  bzla_hashint_table_add(queued, n->id);
+  BZLA_ENQUEUE(*queue, n);
+}
+
+/* Queue node 'n' and all its parents below the roots (given in 'cache') for
+ * domain propagation. */
 static void
-propagate_domains(Bzla *bzla,
-                  BzlaNode *root,
-                  BzlaIntHashTable *domains,
-                  BzlaIntHashTable *cache)
+queue_domain_propagations(BzlaNodePtrQueue *queue,
+                          BzlaIntHashTable *queued,
+                          BzlaIntHashTable *cache,
+                          BzlaNode *n)
 {
-  int32_t id, child_id;
+  assert(bzla_node_is_regular(n));
+
+  BzlaNode *parent;
+  BzlaNodeIterator it;
+
+  queue_domain_propagation(queue, queued, n);
+  bzla_iter_parent_init(&it, n);
+  while (bzla_iter_parent_has_next(&it))
+  {
+    parent = bzla_iter_parent_next(&it);
+    assert(bzla_node_is_regular(parent));
+    if (!bzla_hashint_table_contains(cache, parent->id)) continue;
+    queue_domain_propagation(queue, queued, parent);
+  }
+}
+
+/* Propagate the domains of all nodes below the roots up and down until a
+ * fixed point is reached (or the limit on the number of propagator
+ * applications given by BZLA_OPT_PROP_CONST_DOMAINS_LIMIT).
+ *
+ * All roots are assumed to be true, i.e., domains are only valid for
+ * satisfying assignments. Whenever the domain of a node changes, the node
+ * and its parents are queued for propagation. Since domains can only be
+ * refined, this terminates. Returns false if a conflict was detected, i.e., if
+ * the roots are unsatisfiable. */
+static bool
+propagate_domains(Bzla *bzla, BzlaIntHashTable *domains)
+{
+  assert(bzla);
+  assert(domains);
+
+  bool res, conflict;
   uint32_t i;
-  BzlaNode *cur, *real_cur;
+  uint64_t limit, nprops;
+  BzlaNode *cur, *real_cur, *e;
   BzlaNodePtrStack visit;
-  BzlaBvDomain *d_cur, *d_res_cur, *d_e[3], *d_res_e[3];
+  BzlaNodePtrQueue queue;
+  BzlaPtrHashTableIterator it;
+  BzlaIntHashTable *cache, *queued;
+  BzlaHashTableData *d;
+  BzlaBvDomain *d_true, *d_cur, *d_e[3], *d_res_cur, *d_res_e[3];
   BzlaMemMgr *mm;
   BzlaPropSolver *slv;
 
-  slv = BZLA_PROP_SOLVER(bzla);
-  mm  = bzla->mm;
+  slv      = BZLA_PROP_SOLVER(bzla);
+  mm       = bzla->mm;
+  limit    = bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_DOMAINS_LIMIT);
+  nprops   = 0;
+  conflict = false;
+
+  cache  = bzla_hashint_table_new_dense(mm);
+  queued = bzla_hashint_table_new_dense(mm);
   BZLA_INIT_STACK(mm, visit);
-  BZLA_PUSH_STACK(visit, root);
+  BZLA_INIT_QUEUE(mm, queue);
 
-  do
+  /* all roots are true */
+  d_true = bzla_bvdomain_new_fixed_uint64(mm, 1, 1);
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
   {
-    cur      = BZLA_POP_STACK(visit);
-    real_cur = bzla_node_real_addr(cur);
-    id       = bzla_node_get_id(real_cur);
+    cur = bzla_iter_hashptr_next(&it);
+    (void) update_domain(bzla, domains, cur, d_true, &conflict);
+    if (conflict) goto DONE;
+    BZLA_PUSH_STACK(visit, bzla_node_real_addr(cur));
+  }
+
+  /* initially, all nodes below the roots are queued (top-down) */
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    real_cur = BZLA_POP_STACK(visit);
+    assert(bzla_node_is_regular(real_cur));
+    if (bzla_hashint_table_contains(cache, real_cur->id)) continue;
+    bzla_hashint_table_add(cache, real_cur->id);
+    if (!has_domain_propagator(real_cur)) continue;
+    queue_domain_propagation(&queue, queued, real_cur);
+    for (i = 0; i < real_cur->arity; i++)
+      BZLA_PUSH_STACK(visit, bzla_node_real_addr(real_cur->e[i]));
+  }
 
-    if (bzla_hashint_table_contains(cache, id))
+  while (!BZLA_EMPTY_QUEUE(queue))
+  {
+    if (limit && nprops >= limit)
     {
-      continue;
+      BZLA_MSG(bzla->msg, 1, "domain propagation limit of %zu reached", limit);
+      break;
     }
 
-    bzla_hashint_table_add(cache, id);
+    real_cur = BZLA_DEQUEUE(queue);
+    bzla_hashint_table_remove(queued, real_cur->id);
+    nprops += 1;
 
-    assert(bzla_hashint_map_contains(domains, id));
-    assert(bzla_hashint_map_contains(domains, -id));
-    d_cur = bzla_hashint_map_get(domains, id)->as_ptr;
-    assert(d_cur);
-
-    for (i = 0; i < real_cur->arity; ++i)
+    d = bzla_hashint_map_get(domains, real_cur->id);
+    assert(d);
+    d_cur = d->as_ptr;
+    for (i = 0; i < real_cur->arity; i++)
     {
-      child_id = bzla_node_get_id(real_cur->e[i]);
-      assert(bzla_hashint_map_contains(domains, child_id));
-      d_e[i]     = bzla_hashint_map_get(domains, child_id)->as_ptr;
+      d = bzla_hashint_map_get(domains, bzla_node_get_id(real_cur->e[i]));
+      assert(d);
+      d_e[i]     = d->as_ptr;
       d_res_e[i] = 0;
     }
     d_res_cur = 0;
 
-    if (bzla_node_is_bv_slice(real_cur))
-    {
-      bzla_bvprop_slice(mm,
-                        d_e[0],
-                        d_cur,
-                        bzla_node_bv_slice_get_upper(real_cur),
-                        bzla_node_bv_slice_get_lower(real_cur),
-                        &d_res_e[0],
-                        &d_res_cur);
-    }
-    else if (bzla_node_is_bv_and(real_cur))
-    {
-      bzla_bvprop_and(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_eq(real_cur))
-    {
-      bzla_bvprop_eq(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_add(real_cur))
-    {
-      bzla_bvprop_add(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_mul(real_cur))
-    {
-      bzla_bvprop_mul(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_ult(real_cur))
-    {
-      bzla_bvprop_ult(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_sll(real_cur))
-    {
-      bzla_bvprop_sll(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_srl(real_cur))
-    {
-      bzla_bvprop_srl(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_udiv(real_cur))
-    {
-      bzla_bvprop_udiv(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_urem(real_cur))
-    {
-      bzla_bvprop_urem(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_concat(real_cur))
-    {
-      bzla_bvprop_concat(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_cond(real_cur))
-    {
-      bzla_bvprop_cond(mm,
-                       d_e[1],
-                       d_e[2],
-                       d_cur,
-                       d_e[0],
-                       &d_res_e[1],
-                       &d_res_e[2],
-                       &d_res_cur,
-                       &d_res_e[0]);
-    }
-
-#ifndef NDEBUG
-    if (d_res_cur)
+    if (!propagate_domain(mm, real_cur, d_cur, d_e, &d_res_cur, d_res_e))
     {
-      assert(bzla_bvdomain_is_valid(mm, d_res_cur));
+      conflict = true;
     }
-    for (i = 0; i < real_cur->arity; ++i)
+    else
     {
-      if (d_res_e[i])
+      if (update_domain(bzla, domains, real_cur, d_res_cur, &conflict))
       {
-        assert(bzla_bvdomain_is_valid(mm, d_res_e[i]));
+        slv->stats.updated_domains += 1;
+        queue_domain_propagations(&queue, queued, cache, real_cur);
+      }
+      for (i = 0; i < real_cur->arity && !conflict; i++)
+      {
+        e = real_cur->e[i];
+        if (update_domain(bzla, domains, e, d_res_e[i], &conflict))
+        {
+          slv->stats.updated_domains_children += 1;
+          queue_domain_propagations(
+              &queue, queued, cache, bzla_node_real_addr(e));
+        }
       }
     }
-#endif
 
-    if (update_domain(bzla, domains, real_cur, d_cur, d_res_cur))
+    if (d_res_cur) bzla_bvdomain_free(mm, d_res_cur);
+    for (i = 0; i < real_cur->arity; i++)
     {
-      ++slv->stats.updated_domains;
+      if (d_res_e[i]) bzla_bvdomain_free(mm, d_res_e[i]);
     }
+    if (conflict) break;
+  }
 
-    if (d_res_cur)
-    {
-      bzla_bvdomain_free(mm, d_res_cur);
-    }
+DONE:
+  slv->stats.domain_props += nprops;
+  res = !conflict;
+  if (conflict)
+  {
+    BZLA_MSG(bzla->msg, 1, "domain propagation detected conflict");
+  }
 
-    for (i = 0; i < real_cur->arity; ++i)
-    {
-      if (update_domain(bzla, domains, real_cur->e[i], d_e[i], d_res_e[i]))
-      {
-        ++slv->stats.updated_domains_children;
-      }
-      if (d_res_e[i])
-      {
-        bzla_bvdomain_free(mm, d_res_e[i]);
-      }
+  bzla_bvdomain_free(mm, d_true);
+  BZLA_RELEASE_QUEUE(queue);
+  BZLA_RELEASE_STACK(visit);
+  bzla_hashint_table_delete(queued);
+  bzla_hashint_table_delete(cache);
+  return res;
+}
 
-      BZLA_PUSH_STACK(visit, real_cur->e[i]);
-    }
-  } while (!BZLA_EMPTY_STACK(visit));
+/* Set the assignment of all inputs that do not match the fixed bits of their
+ * domain to the nearest matching value, i.e., keep all unfixed bits. Returns
+ * the number of inputs that have been updated. Note that the model of all
+ * other nodes must be regenerated afterwards. */
+static uint32_t
+fix_inputs(Bzla *bzla, BzlaIntHashTable *domains)
+{
+  assert(bzla);
+  assert(bzla->bv_model);
+  assert(domains);
 
-  BZLA_RELEASE_STACK(visit);
+  size_t i;
+  uint32_t res;
+  BzlaNode *cur;
+  BzlaHashTableData *d;
+  BzlaBvDomain *domain;
+  BzlaBitVector *bv, *tmp;
+  BzlaMemMgr *mm;
+
+  mm  = bzla->mm;
+  res = 0;
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); i++)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || !bzla_lsutils_is_leaf_node(cur)) continue;
+    if (!(d = bzla_hashint_map_get(domains, cur->id))) continue;
+    domain = d->as_ptr;
+    if (!(d = bzla_hashint_map_get(bzla->bv_model, cur->id))) continue;
+    bv = d->as_ptr;
+    if (bzla_bvdomain_check_fixed_bits(mm, domain, bv)) continue;
+
+    /* (bv & hi) | lo */
+    tmp       = bzla_bv_and(mm, bv, domain->hi);
+    d->as_ptr = bzla_bv_or(mm, tmp, domain->lo);
+    bzla_bv_free(mm, tmp);
+    bzla_bv_free(mm, bv);
+    res += 1;
+  }
+  return res;
 }
 
 /* Note: We only want to synthesize the constraints but don't want to add them
@@ -687,7 +938,7 @@ bzla_prop_solver_sat(Bzla *bzla)
   BzlaPtrHashTableIterator it;
   BzlaIntHashTableIterator iit;
   BzlaPropSolver *slv;
-  BzlaIntHashTable *cache;
+  uint32_t nfixed;
 
   slv = BZLA_PROP_SOLVER(bzla);
   assert(slv);
@@ -720,6 +971,14 @@ bzla_prop_solver_sat(Bzla *bzla)
     if (bzla->found_constraint_false) goto UNSAT;
   }
 
+  /* Node ids may be reused across satisfiability checks, hence the value
+   * cache is only maintained for the current check. */
+  if (bzla_opt_get(bzla, BZLA_OPT_PROP_VALUE_CACHE))
+  {
+    assert(!slv->value_cache);
+    slv->value_cache = bzla_hashint_map_new(bzla->mm);
+  }
+
   bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
   bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
   while (bzla_iter_hashptr_has_next(&it))
@@ -753,16 +1012,13 @@ bzla_prop_solver_sat(Bzla *bzla)
 
   if (opt_prop_const_bits && bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_DOMAINS))
   {
-    cache = bzla_hashint_table_new(bzla->mm);
-    bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
-    bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
-    bzla_iter_hashptr_queue(&it, bzla->assumptions);
-    while (bzla_iter_hashptr_has_next(&it))
+    if (!propagate_domains(bzla, slv->domains)) goto UNSAT;
+    /* start from an assignment that respects the propagated fixed bits */
+    if ((nfixed = fix_inputs(bzla, slv->domains)))
     {
-      root = bzla_iter_hashptr_next(&it);
-      propagate_domains(bzla, root, slv->domains, cache);
+      slv->stats.domain_fixed_inputs += nfixed;
+      slv->api.generate_model((BzlaSolver *) slv, false, true);
     }
-    bzla_hashint_table_delete(cache);
   }
 
   for (;;)
@@ -789,7 +1045,7 @@ bzla_prop_solver_sat(Bzla *bzla)
     }
 
     if (!slv->score && bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT))
-      slv->score = bzla_hashint_map_new(bzla->mm);
+      slv->score = bzla_hashint_map_new_dense(bzla->mm);
 
     if (bzla_terminate(bzla))
     {
@@ -848,7 +1104,7 @@ bzla_prop_solver_sat(Bzla *bzla)
     if (bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT))
     {
       bzla_hashint_map_delete(slv->score);
-      slv->score = bzla_hashint_map_new(bzla->mm);
+      slv->score = bzla_hashint_map_new_dense(bzla->mm);
     }
     slv->stats.restarts += 1;
     bzla_proputils_reset_prop_info_stack(slv->bzla->mm, &slv->toprop);
@@ -885,6 +1141,11 @@ DONE:
     }
     bzla_hashint_map_clear(slv->domains);
   }
+  if (slv->value_cache)
+  {
+    bzla_proputils_value_cache_delete(slv->bzla->mm, slv->value_cache);
+    slv->value_cache = 0;
+  }
   bzla_proputils_reset_prop_info_stack(slv->bzla->mm, &slv->toprop);
   assert(BZLA_EMPTY_STACK(slv->prop_path));
 
@@ -893,6 +1154,202 @@ DONE:
   return sat_result;
 }
 
+/*------------------------------------------------------------------------*/
+
+#ifdef BZLA_HAVE_PTHREADS
+struct BzlaPropPortfolioInstance
+{
+  Bzla *bzla;   /* clone of the original instance */
+  Bzla *parent; /* the original instance */
+  uint32_t seed;
+  int32_t result;
+  pthread_t main; /* the thread of the original instance */
+  /* Set (atomically) if an instance determined a result or if the original
+   * instance was terminated, read by all instances. */
+  bool *found_result;
+  pthread_mutex_t *found_result_mutex;
+  uint32_t *running; /* number of running worker threads */
+};
+
+typedef struct BzlaPropPortfolioInstance BzlaPropPortfolioInstance;
+
+static void *
+portfolio_thread_work(void *state)
+{
+  int32_t res;
+  BzlaPropPortfolioInstance *inst;
+
+  inst = state;
+  res  = inst->bzla->slv->api.sat(inst->bzla->slv);
+
+  pthread_mutex_lock(inst->found_result_mutex);
+  if (res != BZLA_RESULT_UNKNOWN
+      && !__atomic_load_n(inst->found_result, __ATOMIC_ACQUIRE))
+  {
+    inst->result = res;
+    __atomic_store_n(inst->found_result, true, __ATOMIC_RELEASE);
+  }
+  pthread_mutex_unlock(inst->found_result_mutex);
+  return NULL;
+}
+
+static void *
+portfolio_thread_run(void *state)
+{
+  BzlaPropPortfolioInstance *inst;
+
+  inst = state;
+  portfolio_thread_work(inst);
+  __atomic_sub_fetch(inst->running, 1, __ATOMIC_RELEASE);
+  return NULL;
+}
+
+/* Termination callback of the portfolio instances. The termination callback
+ * of the original instance is not thread-safe, it is only polled on the
+ * thread of the original instance, which notifies all other instances. */
+static int32_t
+portfolio_thread_terminate(void *state)
+{
+  BzlaPropPortfolioInstance *inst;
+
+  inst = state;
+  if (pthread_equal(pthread_self(), inst->main) && bzla_terminate(inst->parent))
+    __atomic_store_n(inst->found_result, true, __ATOMIC_RELEASE);
+  return __atomic_load_n(inst->found_result, __ATOMIC_ACQUIRE);
+}
+
+/* Run 'num_instances' prop engine instances in parallel, each on a clone of
+ * the expression layer with a different seed. Every other instance uses the
+ * alternative path selection mode. The first instance that determines a
+ * result terminates all other instances. If the result is sat, the model of
+ * the winning instance is installed in the original instance (node ids are
+ * preserved when cloning). */
+static int32_t
+sat_prop_solver_portfolio(BzlaPropSolver *slv, uint32_t num_instances)
+{
+  assert(slv);
+  assert(num_instances > 1);
+
+  bool found_result;
+  pthread_mutex_t found_result_mutex = PTHREAD_MUTEX_INITIALIZER;
+  double start;
+  uint32_t i, seed, path_sel, running;
+  struct timespec poll_interval = {0, 1000000};
+  int32_t sat_result;
+  size_t j;
+  Bzla *bzla, *clone, *winner;
+  BzlaMemMgr *mm;
+  BzlaNode *cur;
+  BzlaHashTableData *d;
+  BzlaPropPortfolioInstance *instances;
+  pthread_t *threads;
+  bool *started;
+
+  start    = bzla_util_time_stamp();
+  bzla     = slv->bzla;
+  mm       = bzla->mm;
+  seed     = bzla_opt_get(bzla, BZLA_OPT_SEED);
+  path_sel = bzla_opt_get(bzla, BZLA_OPT_PROP_PATH_SEL);
+
+  found_result = false;
+  running      = 0;
+  BZLA_CNEWN(mm, instances, num_instances);
+  BZLA_CNEWN(mm, threads, num_instances);
+  BZLA_CNEWN(mm, started, num_instances);
+
+  for (i = 0; i < num_instances; i++)
+  {
+    clone = bzla_clone_exp_layer(bzla, 0, true);
+    bzla_opt_set(clone, BZLA_OPT_PROP_PORTFOLIO, 1);
+    bzla_opt_set(clone, BZLA_OPT_VERBOSITY, 0);
+    bzla_opt_set(clone, BZLA_OPT_SEED, seed + i);
+    if (i % 2)
+      bzla_opt_set(clone,
+                   BZLA_OPT_PROP_PATH_SEL,
+                   path_sel == BZLA_PROP_PATH_SEL_ESSENTIAL
+                       ? BZLA_PROP_PATH_SEL_RANDOM
+                       : BZLA_PROP_PATH_SEL_ESSENTIAL);
+
+    instances[i].bzla               = clone;
+    instances[i].parent             = bzla;
+    instances[i].seed               = seed + i;
+    instances[i].result             = BZLA_RESULT_UNKNOWN;
+    instances[i].main               = pthread_self();
+    instances[i].found_result       = &found_result;
+    instances[i].found_result_mutex = &found_result_mutex;
+    instances[i].running            = &running;
+    bzla_set_term(clone, portfolio_thread_terminate, &instances[i]);
+  }
+
+  for (i = 1; i < num_instances; i++)
+  {
+    __atomic_add_fetch(&running, 1, __ATOMIC_RELEASE);
+    started[i] = pthread_create(
+                     &threads[i], 0, portfolio_thread_run, &instances[i])
+                 == 0;
+    if (!started[i]) __atomic_sub_fetch(&running, 1, __ATOMIC_RELEASE);
+  }
+  portfolio_thread_work(&instances[0]);
+  /* keep polling the termination callback of the original instance until
+   * all worker threads are done */
+  while (__atomic_load_n(&running, __ATOMIC_ACQUIRE) > 0)
+  {
+    if (!__atomic_load_n(&found_result, __ATOMIC_ACQUIRE)
+        && bzla_terminate(bzla))
+      __atomic_store_n(&found_result, true, __ATOMIC_RELEASE);
+    nanosleep(&poll_interval, 0);
+  }
+  for (i = 1; i < num_instances; i++)
+  {
+    if (started[i])
+      pthread_join(threads[i], 0);
+    else if (!__atomic_load_n(&found_result, __ATOMIC_ACQUIRE))
+      portfolio_thread_work(&instances[i]);
+  }
+
+  sat_result = BZLA_RESULT_UNKNOWN;
+  winner     = 0;
+  for (i = 0; i < num_instances; i++)
+  {
+    if (instances[i].result == BZLA_RESULT_UNKNOWN) continue;
+    assert(!winner);
+    winner     = instances[i].bzla;
+    sat_result = instances[i].result;
+    BZLA_MSG(bzla->msg,
+             1,
+             "portfolio instance %u (seed %u) determined result",
+             i,
+             instances[i].seed);
+    /* instances start with a copy of the statistics of the original */
+    slv->stats = BZLA_PROP_SOLVER(winner)->stats;
+  }
+
+  /* install model of winning instance (leaf values only, all other values
+   * are recomputed by model generation) */
+  bzla_model_delete_bv(bzla, &bzla->bv_model);
+  bzla_model_init_bv(bzla, &bzla->bv_model);
+  if (sat_result == BZLA_RESULT_SAT)
+  {
+    for (j = 1; j < BZLA_COUNT_STACK(bzla->nodes_id_table); j++)
+    {
+      cur = BZLA_PEEK_STACK(bzla->nodes_id_table, j);
+      if (!cur || !bzla_lsutils_is_leaf_node(cur)) continue;
+      d = bzla_hashint_map_get(winner->bv_model, cur->id);
+      if (d) bzla_model_add_to_bv(bzla, bzla->bv_model, cur, d->as_ptr);
+    }
+  }
+  slv->api.generate_model((BzlaSolver *) slv, false, true);
+
+  for (i = 0; i < num_instances; i++) bzla_delete(instances[i].bzla);
+  BZLA_DELETEN(mm, started, num_instances);
+  BZLA_DELETEN(mm, threads, num_instances);
+  BZLA_DELETEN(mm, instances, num_instances);
+
+  slv->time.check_sat += bzla_util_time_stamp() - start;
+  return sat_result;
+}
+#endif
+
 /* Note: failed assumptions handling not necessary, prop only works for SAT */
 static int32_t
 sat_prop_solver(BzlaPropSolver *slv)
@@ -903,9 +1360,11 @@ sat_prop_solver(BzlaPropSolver *slv)
   assert(slv->bzla->slv == (BzlaSolver *) slv);
 
   int32_t sat_result;
+  uint32_t num_instances;
   Bzla *bzla;
 
-  bzla = slv->bzla;
+  bzla          = slv->bzla;
+  num_instances = bzla_opt_get(bzla, BZLA_OPT_PROP_PORTFOLIO);
   assert(!bzla->inconsistent);
 
   if (bzla_terminate(bzla))
@@ -914,6 +1373,16 @@ sat_prop_solver(BzlaPropSolver *slv)
     goto DONE;
   }
 
+#ifdef BZLA_HAVE_PTHREADS
+  if (num_instances > 1)
+  {
+    sat_result = sat_prop_solver_portfolio(slv, num_instances);
+    goto DONE;
+  }
+#else
+  (void) num_instances;
+#endif
+
   /* Generate intial model, all bv vars are initialized with zero. We do
    * not have to consider model_for_all_nodes, but let this be handled by
    * the model generation (if enabled) after SAT has been determined. */
@@ -921,6 +1390,11 @@ sat_prop_solver(BzlaPropSolver *slv)
   sat_result = bzla_prop_solver_sat(bzla);
 DONE:
   assert(BZLA_EMPTY_STACK(slv->toprop));
+  if (bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL)
+      && bzla_opt_get(bzla, BZLA_OPT_LS_WARM_START))
+  {
+    bzla_lsutils_save_bv_model(bzla, &slv->warm_model);
+  }
   return sat_result;
 }
 
@@ -937,7 +1411,7 @@ generate_model_prop_solver(BzlaPropSolver *slv,
   Bzla *bzla = slv->bzla;
 
   if (!reset && bzla->bv_model) return;
-  bzla_lsutils_initialize_bv_model((BzlaSolver *) slv);
+  bzla_lsutils_initialize_bv_model((BzlaSolver *) slv, slv->warm_model);
   bzla_model_init_fun(bzla, &bzla->fun_model);
   bzla_model_generate(
       bzla, bzla->bv_model, bzla->fun_model, model_for_all_nodes);
@@ -977,6 +1451,18 @@ print_stats_prop_solver(BzlaPropSolver *slv)
            slv->stats.props_cons);
   BZLA_MSG(
       bzla->msg, 1, "    inverse value propagations: %u", slv->stats.props_inv);
+  if (bzla_opt_get(bzla, BZLA_OPT_PROP_VALUE_CACHE))
+  {
+    BZLA_MSG(bzla->msg,
+             1,
+             "    value cache hits: %zu of %zu (%.1f%%)",
+             slv->stats.value_cache_hits,
+             slv->stats.value_cache_lookups,
+             slv->stats.value_cache_lookups
+                 ? 100.0 * slv->stats.value_cache_hits
+                       / slv->stats.value_cache_lookups
+                 : 0.0);
+  }
   BZLA_MSG(bzla->msg,
            1,
            "propagation (steps) per second: %.1f",
@@ -1067,6 +1553,15 @@ print_stats_prop_solver(BzlaPropSolver *slv)
              1,
              "updated domains (children): %zu",
              slv->stats.updated_domains_children);
+    BZLA_MSG(bzla->msg, 1, "domain propagations: %zu", slv->stats.domain_props);
+    BZLA_MSG(bzla->msg,
+             1,
+             "    fixed bits: %zu",
+             slv->stats.domain_fixed_bits);
+    BZLA_MSG(bzla->msg,
+             1,
+             "    inputs set to fixed bits (moves saved): %zu",
+             slv->stats.domain_fixed_inputs);
   }
 }
 
@@ -1118,7 +1613,7 @@ bzla_new_prop_solver(Bzla *bzla)
 
   slv->bzla    = bzla;
   slv->kind    = BZLA_PROP_SOLVER_KIND;
-  slv->domains = bzla_hashint_map_new(bzla->mm);
+  slv->domains = bzla_hashint_map_new_dense(bzla->mm);
 
   slv->api.clone = (BzlaSolverClone) clone_prop_solver;
   slv->api.delet = (BzlaSolverDelete) delete_prop_solver;
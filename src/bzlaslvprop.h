@@ -36,6 +36,16 @@ struct BzlaPropSolver
    * Maps node id to its bit-vector domain (BzlaBvDomain*). */
   BzlaIntHashTable *domains;
 
+  /* Map, maintains the assignment of inputs determined by the previous
+   * satisfiability check, used as initial assignment in incremental mode if
+   * BZLA_OPT_LS_WARM_START is enabled. Maps node id to its assignment. */
+  BzlaIntHashTable *warm_model;
+
+  /* Map, maintains inverse and consistent values computed during the
+   * current satisfiability check if BZLA_OPT_PROP_VALUE_CACHE is enabled.
+   * Maps node id to its value cache (see bzlaproputils.c). */
+  BzlaIntHashTable *value_cache;
+
   /* Work stack, maintains entailed propagations that need to be processed
    * with higher priority if BZLA_OPT_PROP_ENTAILED.
    *
@@ -87,6 +97,11 @@ struct BzlaPropSolver
     uint64_t props_inv;
     /* Number of entailed propagations. */
     uint64_t props_entailed;
+    /* Number of value computations looked up in the value cache, and
+     * number of those answered from the cache (if
+     * BZLA_OPT_PROP_VALUE_CACHE). */
+    uint64_t value_cache_lookups;
+    uint64_t value_cache_hits;
     /* Number of updates performed when updating the cone of influence in the
      * current assignment as a consequence of a move. */
     uint64_t updates;
@@ -130,6 +145,13 @@ struct BzlaPropSolver
     uint64_t total_bits;
     uint64_t updated_domains;
     uint64_t updated_domains_children;
+    /* Number of domain propagator applications. */
+    uint64_t domain_props;
+    /* Number of bits fixed by domain propagation. */
+    uint64_t domain_fixed_bits;
+    /* Number of inputs whose initial assignment was set to match the fixed
+     * bits of their domain (each saves at least one move). */
+    uint64_t domain_fixed_inputs;
   } stats;
 
   struct
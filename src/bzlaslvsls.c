@@ -11,6 +11,9 @@
 #include "bzlaslvsls.h"
 
 #include <math.h>
+#ifdef BZLA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
 #include "bzlabv.h"
 #include "bzlaclone.h"
@@ -48,6 +51,10 @@
 /* start segments from MSB rather than LSB (prob=0.5) */
 #define BZLA_SLS_PROB_SEG_MSB_VS_LSB 500
 
+/* maximum number of moves recorded for a move worker before it is fully
+ * synchronized instead */
+#define BZLA_SLS_MAX_WORKER_MOVES 64
+
 /*------------------------------------------------------------------------*/
 
 static double
@@ -258,6 +265,7 @@ update_assertion_weights(Bzla *bzla)
 {
   assert(bzla);
 
+  uint32_t i;
   int32_t id;
   BzlaSLSConstrData *d;
   BzlaIntHashTableIterator it;
@@ -265,6 +273,8 @@ update_assertion_weights(Bzla *bzla)
 
   slv = BZLA_SLS_SOLVER(bzla);
 
+  for (i = 0; i < slv->nworkers; i++) slv->workers[i].weights = true;
+
   if (bzla_rng_pick_with_prob(bzla->rng, BZLA_SLS_PROB_SCORE_F))
   {
     /* decrease the weight of all satisfied assertions */
@@ -360,6 +370,428 @@ try_move(Bzla *bzla,
   return compute_sls_score_formula(bzla, score, done);
 }
 
+/*------------------------------------------------------------------------*/
+
+/* Delete the moves recorded for the given move worker. */
+static void
+delete_move_worker_moves(BzlaSLSMoveWorker *w)
+{
+  assert(w);
+
+  BzlaIntHashTable *cans;
+  BzlaIntHashTableIterator it;
+
+  while (!BZLA_EMPTY_STACK(w->moves))
+  {
+    cans = BZLA_POP_STACK(w->moves);
+    bzla_iter_hashint_init(&it, cans);
+    while (bzla_iter_hashint_has_next(&it))
+      bzla_bv_free(w->clone->mm, bzla_iter_hashint_next_data(&it)->as_ptr);
+    bzla_hashint_map_delete(cans);
+  }
+}
+
+/* Record move 'cans' performed on 'bzla' such that it can be replayed on the
+ * clones of the move workers. */
+static void
+record_move_workers(Bzla *bzla, BzlaIntHashTable *cans)
+{
+  assert(bzla);
+  assert(cans);
+
+  uint32_t i;
+  int32_t id;
+  BzlaBitVector *bv;
+  BzlaIntHashTable *wcans;
+  BzlaIntHashTableIterator it;
+  BzlaSLSMoveWorker *w;
+  BzlaSLSSolver *slv;
+
+  slv = BZLA_SLS_SOLVER(bzla);
+
+  for (i = 0; i < slv->nworkers; i++)
+  {
+    w = &slv->workers[i];
+    if (w->reset) continue;
+    /* workers that did not get any moves to evaluate for a while are
+     * synchronized from scratch */
+    if (BZLA_COUNT_STACK(w->moves) >= BZLA_SLS_MAX_WORKER_MOVES)
+    {
+      delete_move_worker_moves(w);
+      w->reset = true;
+      continue;
+    }
+    wcans = bzla_hashint_map_new(w->clone->mm);
+    bzla_iter_hashint_init(&it, cans);
+    while (bzla_iter_hashint_has_next(&it))
+    {
+      bv = cans->data[it.cur_pos].as_ptr;
+      id = bzla_iter_hashint_next(&it);
+      bzla_hashint_map_add(wcans, id)->as_ptr = bzla_bv_copy(w->clone->mm, bv);
+    }
+    BZLA_PUSH_STACK(w->moves, wcans);
+  }
+}
+
+/* Force a full synchronization of all move workers (on restart). */
+static void
+reset_move_workers(Bzla *bzla)
+{
+  assert(bzla);
+
+  uint32_t i;
+  BzlaSLSSolver *slv;
+
+  slv = BZLA_SLS_SOLVER(bzla);
+
+  for (i = 0; i < slv->nworkers; i++)
+  {
+    delete_move_worker_moves(&slv->workers[i]);
+    slv->workers[i].reset = true;
+  }
+}
+
+/* Synchronize model, scores, unsatisfied roots and assertion weights of the
+ * clone of the given move worker with the original instance. Recorded moves
+ * are replayed, i.e., only their cones are updated. A full copy is only
+ * required after a restart. */
+static void
+sync_move_worker(BzlaSLSMoveWorker *w)
+{
+  assert(w);
+
+  size_t i;
+  int32_t id;
+  uint64_t updates;
+  double time_cone, time_reset, time_model_gen, time_compute_score;
+  Bzla *bzla, *clone;
+  BzlaNode *exp;
+  BzlaBitVector *bv;
+  BzlaSLSSolver *slv, *wslv;
+  BzlaSLSConstrData *d;
+  BzlaIntHashTableIterator it;
+
+  bzla  = w->bzla;
+  clone = w->clone;
+  slv   = BZLA_SLS_SOLVER(bzla);
+  wslv  = BZLA_SLS_SOLVER(clone);
+
+  if (w->reset)
+  {
+    assert(BZLA_EMPTY_STACK(w->moves));
+    bzla_model_delete_bv(clone, &clone->bv_model);
+    clone->bv_model = bzla_hashint_map_new_dense(clone->mm);
+    bzla_iter_hashint_init(&it, bzla->bv_model);
+    while (bzla_iter_hashint_has_next(&it))
+    {
+      bv  = bzla->bv_model->data[it.cur_pos].as_ptr;
+      id  = bzla_iter_hashint_next(&it);
+      exp = bzla_node_get_by_id(clone, id);
+      assert(exp);
+      bzla_node_copy(clone, exp);
+      bzla_hashint_map_add(clone->bv_model, id)->as_ptr =
+          bzla_bv_copy(clone->mm, bv);
+    }
+
+    if (wslv->roots) bzla_hashint_map_delete(wslv->roots);
+    wslv->roots = bzla_hashint_map_clone(clone->mm, slv->roots, 0, 0);
+    if (wslv->score) bzla_hashint_map_delete(wslv->score);
+    wslv->score = bzla_hashint_map_clone(
+        clone->mm, slv->score, bzla_clone_data_as_dbl, 0);
+    w->weights = true;
+  }
+  else
+  {
+    /* replaying is not accounted for in the statistics of the workers */
+    updates   = 0;
+    time_cone = time_reset = time_model_gen = time_compute_score = 0;
+    for (i = 0; i < BZLA_COUNT_STACK(w->moves); i++)
+    {
+      bzla_lsutils_update_cone(clone,
+                               clone->bv_model,
+                               wslv->roots,
+                               wslv->score,
+                               BZLA_PEEK_STACK(w->moves, i),
+                               true,
+                               &updates,
+                               &time_cone,
+                               &time_reset,
+                               &time_model_gen,
+                               &time_compute_score);
+    }
+    delete_move_worker_moves(w);
+  }
+
+  if (w->weights)
+  {
+    bzla_iter_hashint_init(&it, wslv->weights);
+    while (bzla_iter_hashint_has_next(&it))
+    {
+      d  = wslv->weights->data[it.cur_pos].as_ptr;
+      id = bzla_iter_hashint_next(&it);
+      assert(bzla_hashint_map_contains(slv->weights, id));
+      d->weight = ((BzlaSLSConstrData *) bzla_hashint_map_get(slv->weights, id)
+                       ->as_ptr)
+                      ->weight;
+    }
+  }
+
+  w->reset   = false;
+  w->weights = false;
+}
+
+/* Evaluate the candidate moves assigned to the given move worker on a
+ * private copy of the model and scores of its clone. */
+static void *
+move_worker_thread(void *state)
+{
+  size_t i;
+  Bzla *clone;
+  BzlaIntHashTable *bv_model, *score;
+  BzlaSLSMoveWorker *w;
+
+  w = state;
+  if (w->from == w->to) return 0;
+  sync_move_worker(w);
+
+  clone    = w->clone;
+  bv_model = bzla_model_clone_bv(clone, clone->bv_model, true);
+  score    = bzla_hashint_map_clone(
+      clone->mm, BZLA_SLS_SOLVER(clone)->score, bzla_clone_data_as_dbl, 0);
+
+  /* all moves of a batch assign the same set of candidates, hence it is not
+   * necessary to reset the model in between moves */
+  for (i = w->from; i < w->to; i++)
+    w->sc[i] = try_move(clone, bv_model, score, w->cans[i], &w->done[i]);
+
+  bzla_model_delete_bv(clone, &bv_model);
+  bzla_hashint_map_delete(score);
+  return 0;
+}
+
+#ifdef BZLA_HAVE_PTHREADS
+/* The first move worker runs on the main thread, all other workers run on
+ * their own thread (if it could be started) and wait for the next batch. */
+struct BzlaSLSMovePool
+{
+  pthread_mutex_t mutex;
+  pthread_cond_t batch_cond; /* signalled if a new batch is available */
+  pthread_cond_t done_cond;  /* signalled if all threads finished a batch */
+  uint64_t batch;            /* the number of the current batch */
+  uint32_t running;          /* threads still working on the current batch */
+  bool shutdown;             /* true if threads must exit */
+  pthread_t *threads;
+  bool *started;
+  uint32_t nstarted;
+  uint32_t nthreads;
+};
+
+/* Pool thread of a move worker, evaluates its part of each batch. */
+static void *
+move_worker_pool_thread(void *state)
+{
+  uint64_t batch;
+  BzlaSLSMoveWorker *w;
+  BzlaSLSMovePool *pool;
+
+  w     = state;
+  pool  = BZLA_SLS_SOLVER(w->bzla)->pool;
+  batch = 0;
+
+  pthread_mutex_lock(&pool->mutex);
+  for (;;)
+  {
+    while (!pool->shutdown && pool->batch == batch)
+      pthread_cond_wait(&pool->batch_cond, &pool->mutex);
+    if (pool->shutdown) break;
+    batch = pool->batch;
+    pthread_mutex_unlock(&pool->mutex);
+
+    move_worker_thread(w);
+
+    pthread_mutex_lock(&pool->mutex);
+    assert(pool->running);
+    pool->running -= 1;
+    if (!pool->running) pthread_cond_signal(&pool->done_cond);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  return 0;
+}
+#endif
+
+/* Evaluate the 'n' candidate moves in 'cans' with the move workers without
+ * modifying the model of 'bzla'. The score of the i-th move is stored in
+ * sc[i], done[i] is true if it satisfies all roots. */
+static void
+try_moves_parallel(
+    Bzla *bzla, BzlaIntHashTable **cans, size_t n, double *sc, bool *done)
+{
+  assert(bzla);
+  assert(cans);
+  assert(n);
+  assert(sc);
+  assert(done);
+
+  uint32_t i, nworkers;
+  size_t chunk;
+  BzlaSLSSolver *slv, *wslv;
+  BzlaSLSMoveWorker *w;
+#ifdef BZLA_HAVE_PTHREADS
+  BzlaSLSMovePool *pool;
+#endif
+
+  slv = BZLA_SLS_SOLVER(bzla);
+  assert(slv->nworkers > 1);
+
+  /* workers without moves (from = to) are idle */
+  nworkers = BZLA_MIN_UTIL(slv->nworkers, n);
+  chunk    = (n + nworkers - 1) / nworkers;
+  for (i = 0; i < slv->nworkers; i++)
+  {
+    w       = &slv->workers[i];
+    w->cans = cans;
+    w->sc   = sc;
+    w->done = done;
+    w->from = BZLA_MIN_UTIL(i * chunk, n);
+    w->to   = BZLA_MIN_UTIL((i + 1) * chunk, n);
+  }
+
+#ifdef BZLA_HAVE_PTHREADS
+  pool = slv->pool;
+  assert(pool);
+  pthread_mutex_lock(&pool->mutex);
+  pool->batch += 1;
+  pool->running = pool->nstarted;
+  pthread_cond_broadcast(&pool->batch_cond);
+  pthread_mutex_unlock(&pool->mutex);
+
+  move_worker_thread(&slv->workers[0]);
+  for (i = 1; i < slv->nworkers; i++)
+  {
+    if (!pool->started[i - 1]) move_worker_thread(&slv->workers[i]);
+  }
+
+  pthread_mutex_lock(&pool->mutex);
+  while (pool->running) pthread_cond_wait(&pool->done_cond, &pool->mutex);
+  pthread_mutex_unlock(&pool->mutex);
+#else
+  for (i = 0; i < nworkers; i++) move_worker_thread(&slv->workers[i]);
+#endif
+
+  /* collect statistics of workers */
+  for (i = 0; i < nworkers; i++)
+  {
+    wslv = BZLA_SLS_SOLVER(slv->workers[i].clone);
+    slv->stats.flips += wslv->stats.flips;
+    slv->stats.updates += wslv->stats.updates;
+    slv->time.update_cone += wslv->time.update_cone;
+    slv->time.update_cone_reset += wslv->time.update_cone_reset;
+    slv->time.update_cone_model_gen += wslv->time.update_cone_model_gen;
+    slv->time.update_cone_compute_score +=
+        wslv->time.update_cone_compute_score;
+    memset(&wslv->stats, 0, sizeof(wslv->stats));
+    memset(&wslv->time, 0, sizeof(wslv->time));
+  }
+}
+
+static void
+init_move_workers(Bzla *bzla, uint32_t nworkers)
+{
+  assert(bzla);
+  assert(nworkers > 1);
+
+  uint32_t i;
+  Bzla *clone;
+  BzlaSLSSolver *slv;
+#ifdef BZLA_HAVE_PTHREADS
+  BzlaSLSMovePool *pool;
+#endif
+
+  slv = BZLA_SLS_SOLVER(bzla);
+  assert(!slv->workers);
+  assert(!slv->pool);
+
+  BZLA_CNEWN(bzla->mm, slv->workers, nworkers);
+  for (i = 0; i < nworkers; i++)
+  {
+    clone = bzla_clone_exp_layer(bzla, 0, true);
+    bzla_opt_set(clone, BZLA_OPT_SLS_THREADS, 1);
+    bzla_opt_set(clone, BZLA_OPT_VERBOSITY, 0);
+    memset(&BZLA_SLS_SOLVER(clone)->stats, 0, sizeof(slv->stats));
+    memset(&BZLA_SLS_SOLVER(clone)->time, 0, sizeof(slv->time));
+    slv->workers[i].bzla  = bzla;
+    slv->workers[i].clone = clone;
+    slv->workers[i].reset = true;
+    BZLA_INIT_STACK(clone->mm, slv->workers[i].moves);
+  }
+  slv->nworkers = nworkers;
+
+#ifdef BZLA_HAVE_PTHREADS
+  BZLA_CNEW(bzla->mm, pool);
+  pthread_mutex_init(&pool->mutex, 0);
+  pthread_cond_init(&pool->batch_cond, 0);
+  pthread_cond_init(&pool->done_cond, 0);
+  pool->nthreads = nworkers - 1;
+  BZLA_CNEWN(bzla->mm, pool->threads, pool->nthreads);
+  BZLA_CNEWN(bzla->mm, pool->started, pool->nthreads);
+  slv->pool = pool;
+  for (i = 0; i < pool->nthreads; i++)
+  {
+    pool->started[i] = pthread_create(&pool->threads[i],
+                                      0,
+                                      move_worker_pool_thread,
+                                      &slv->workers[i + 1])
+                       == 0;
+    if (pool->started[i]) pool->nstarted += 1;
+  }
+#endif
+}
+
+static void
+delete_move_workers(Bzla *bzla)
+{
+  assert(bzla);
+
+  uint32_t i;
+  BzlaSLSSolver *slv;
+#ifdef BZLA_HAVE_PTHREADS
+  BzlaSLSMovePool *pool;
+#endif
+
+  slv = BZLA_SLS_SOLVER(bzla);
+  if (!slv->workers) return;
+
+#ifdef BZLA_HAVE_PTHREADS
+  pool = slv->pool;
+  assert(pool);
+  pthread_mutex_lock(&pool->mutex);
+  pool->shutdown = true;
+  pthread_cond_broadcast(&pool->batch_cond);
+  pthread_mutex_unlock(&pool->mutex);
+  for (i = 0; i < pool->nthreads; i++)
+  {
+    if (pool->started[i]) pthread_join(pool->threads[i], 0);
+  }
+  pthread_cond_destroy(&pool->done_cond);
+  pthread_cond_destroy(&pool->batch_cond);
+  pthread_mutex_destroy(&pool->mutex);
+  BZLA_DELETEN(bzla->mm, pool->started, pool->nthreads);
+  BZLA_DELETEN(bzla->mm, pool->threads, pool->nthreads);
+  BZLA_DELETE(bzla->mm, pool);
+  slv->pool = 0;
+#endif
+
+  for (i = 0; i < slv->nworkers; i++)
+  {
+    delete_move_worker_moves(&slv->workers[i]);
+    BZLA_RELEASE_STACK(slv->workers[i].moves);
+    bzla_delete(slv->workers[i].clone);
+  }
+  BZLA_DELETEN(bzla->mm, slv->workers, slv->nworkers);
+  slv->workers  = 0;
+  slv->nworkers = 0;
+}
+
 static int32_t
 cmp_sls_moves_qsort(const void *move1, const void *move2)
 {
@@ -423,22 +855,24 @@ cmp_sls_moves_qsort(const void *move1, const void *move2)
     }                                                                        \
   } while (0)
 
-static inline bool
-select_inc_dec_not_move(Bzla *bzla,
-                        BzlaBitVector *(*fun)(BzlaMemMgr *,
-                                              const BzlaBitVector *),
-                        BzlaNodePtrStack *candidates,
-                        int32_t gw)
+/* Evaluate the candidate moves in 'batch' in parallel and select the best
+ * move in batch order, i.e., the selected move is the same as if the moves
+ * were tried one after another. */
+static bool
+select_move_batch(Bzla *bzla,
+                  BzlaIntHashTablePtrStack *batch,
+                  BzlaSLSMoveKind mk,
+                  int32_t gw)
 {
-  size_t i;
+  assert(bzla);
+  assert(batch);
+
+  size_t i, n;
   uint32_t sls_strat;
-  bool done;
-  double sc;
+  bool done, *dones;
+  double sc, *scores;
   BzlaSLSMove *m;
-  BzlaSLSMoveKind mk;
-  BzlaBitVector *ass, *max_neigh;
-  BzlaNode *can;
-  BzlaIntHashTable *cans, *bv_model, *score;
+  BzlaIntHashTable *cans;
   BzlaIntHashTableIterator iit;
   BzlaSLSSolver *slv;
 
@@ -446,20 +880,49 @@ select_inc_dec_not_move(Bzla *bzla,
   slv       = BZLA_SLS_SOLVER(bzla);
   sls_strat = bzla_opt_get(bzla, BZLA_OPT_SLS_STRATEGY);
 
-  if (fun == bzla_bv_inc)
-    mk = BZLA_SLS_MOVE_INC;
-  else if (fun == bzla_bv_dec)
-    mk = BZLA_SLS_MOVE_DEC;
-  else
+  n = BZLA_COUNT_STACK(*batch);
+  if (!n) return done;
+
+  BZLA_CNEWN(bzla->mm, scores, n);
+  BZLA_CNEWN(bzla->mm, dones, n);
+  try_moves_parallel(bzla, batch->start, n, scores, dones);
+
+  for (i = 0; i < n; i++)
   {
-    assert(fun == bzla_bv_not);
-    mk = BZLA_SLS_MOVE_NOT;
+    cans = BZLA_PEEK_STACK(*batch, i);
+    BZLA_POKE_STACK(*batch, i, 0);
+    done = dones[i];
+    sc   = scores[i];
+    BZLA_SLS_SELECT_MOVE_CHECK_SCORE(sc);
   }
 
-  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
-  score =
-      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
+DONE:
+  for (; i < n; i++)
+  {
+    cans = BZLA_PEEK_STACK(*batch, i);
+    if (cans) BZLA_SLS_DELETE_CANS(cans);
+  }
+  BZLA_RESET_STACK(*batch);
+  BZLA_DELETEN(bzla->mm, dones, n);
+  BZLA_DELETEN(bzla->mm, scores, n);
+  return done;
+}
 
+/* Create the candidate move that applies 'fun' (inc, dec or not) to the
+ * assignments of all candidates. */
+static BzlaIntHashTable *
+new_inc_dec_not_cans(Bzla *bzla,
+                     BzlaBitVector *(*fun)(BzlaMemMgr *,
+                                           const BzlaBitVector *),
+                     BzlaNodePtrStack *candidates)
+{
+  size_t i;
+  BzlaBitVector *ass, *max_neigh;
+  BzlaNode *can;
+  BzlaIntHashTable *cans;
+  BzlaSLSSolver *slv;
+
+  slv  = BZLA_SLS_SOLVER(bzla);
   cans = bzla_hashint_map_new(bzla->mm);
 
   for (i = 0; i < BZLA_COUNT_STACK(*candidates); i++)
@@ -481,13 +944,73 @@ select_inc_dec_not_move(Bzla *bzla,
             : fun(bzla->mm, ass);
   }
 
+  return cans;
+}
+
+/* Select candidate move 'cans' of kind 'mk' with score 'sc' if it is better
+ * than the currently selected move. */
+static inline bool
+select_move_check_score(Bzla *bzla,
+                        BzlaIntHashTable *cans,
+                        BzlaSLSMoveKind mk,
+                        int32_t gw,
+                        double sc,
+                        bool done)
+{
+  uint32_t sls_strat;
+  BzlaSLSMove *m;
+  BzlaIntHashTableIterator iit;
+  BzlaSLSSolver *slv;
+
+  slv       = BZLA_SLS_SOLVER(bzla);
+  sls_strat = bzla_opt_get(bzla, BZLA_OPT_SLS_STRATEGY);
+
+  BZLA_SLS_SELECT_MOVE_CHECK_SCORE(sc);
+
+DONE:
+  return done;
+}
+
+static inline bool
+select_inc_dec_not_move(Bzla *bzla,
+                        BzlaBitVector *(*fun)(BzlaMemMgr *,
+                                              const BzlaBitVector *),
+                        BzlaNodePtrStack *candidates,
+                        int32_t gw)
+{
+  bool done;
+  double sc;
+  BzlaSLSMoveKind mk;
+  BzlaIntHashTable *cans, *bv_model, *score;
+  BzlaIntHashTableIterator iit;
+  BzlaSLSSolver *slv;
+
+  done = false;
+  slv  = BZLA_SLS_SOLVER(bzla);
+
+  if (fun == bzla_bv_inc)
+    mk = BZLA_SLS_MOVE_INC;
+  else if (fun == bzla_bv_dec)
+    mk = BZLA_SLS_MOVE_DEC;
+  else
+  {
+    assert(fun == bzla_bv_not);
+    mk = BZLA_SLS_MOVE_NOT;
+  }
+
+  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
+  score =
+      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
+
+  cans = new_inc_dec_not_cans(bzla, fun, candidates);
+
   sc = try_move(bzla, bv_model, score, cans, &done);
   if (slv->terminate)
   {
     BZLA_SLS_DELETE_CANS(cans);
     goto DONE;
   }
-  BZLA_SLS_SELECT_MOVE_CHECK_SCORE(sc);
+  done = select_move_check_score(bzla, cans, mk, gw, sc, done);
 
 DONE:
   bzla_model_delete_bv(bzla, &bv_model);
@@ -495,6 +1018,39 @@ DONE:
   return done;
 }
 
+/* Evaluate the inc, dec and not moves in parallel with the move workers.
+ * The moves are selected in the same order as if they were tried one after
+ * another, but dec and not moves are evaluated even if the inc move already
+ * satisfies all roots. */
+static bool
+select_inc_dec_not_moves_parallel(Bzla *bzla,
+                                  BzlaNodePtrStack *candidates,
+                                  int32_t gw)
+{
+  assert(!bzla_opt_get(bzla, BZLA_OPT_SLS_MOVE_INC_MOVE_TEST));
+
+  size_t i;
+  bool done, dones[3];
+  double scores[3];
+  BzlaIntHashTable *cans[3];
+  BzlaIntHashTableIterator iit;
+
+  cans[0] = new_inc_dec_not_cans(bzla, bzla_bv_inc, candidates);
+  cans[1] = new_inc_dec_not_cans(bzla, bzla_bv_dec, candidates);
+  cans[2] = new_inc_dec_not_cans(bzla, bzla_bv_not, candidates);
+
+  try_moves_parallel(bzla, cans, 3, scores, dones);
+
+  done = false;
+  for (i = 0; i < 3 && !done; i++)
+  {
+    done = select_move_check_score(
+        bzla, cans[i], BZLA_SLS_MOVE_INC + i, gw, scores[i], dones[i]);
+  }
+  for (; i < 3; i++) BZLA_SLS_DELETE_CANS(cans[i]);
+  return done;
+}
+
 static inline bool
 select_flip_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
 {
@@ -508,6 +1064,7 @@ select_flip_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   BzlaNode *can;
   BzlaIntHashTable *cans, *bv_model, *score;
   BzlaIntHashTableIterator iit;
+  BzlaIntHashTablePtrStack batch;
   BzlaSLSSolver *slv;
 
   slv       = BZLA_SLS_SOLVER(bzla);
@@ -515,9 +1072,15 @@ select_flip_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
 
   mk = BZLA_SLS_MOVE_FLIP;
 
-  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
-  score =
-      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
+  /* candidate moves are collected and evaluated in parallel */
+  BZLA_INIT_STACK(bzla->mm, batch);
+  bv_model = score = 0;
+  if (!slv->nworkers)
+  {
+    bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
+    score    = bzla_hashint_map_clone(
+        bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
+  }
 
   for (pos = 0, n_endpos = 0; n_endpos < BZLA_COUNT_STACK(*candidates); pos++)
   {
@@ -545,6 +1108,12 @@ select_flip_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
               : bzla_bv_flipped_bit(bzla->mm, ass, cpos);
     }
 
+    if (slv->nworkers)
+    {
+      BZLA_PUSH_STACK(batch, cans);
+      continue;
+    }
+
     sc = try_move(bzla, bv_model, score, cans, &done);
     if (slv->terminate)
     {
@@ -554,9 +1123,15 @@ select_flip_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
     BZLA_SLS_SELECT_MOVE_CHECK_SCORE(sc);
   }
 
+  if (slv->nworkers) done = select_move_batch(bzla, &batch, mk, gw);
+
 DONE:
-  bzla_model_delete_bv(bzla, &bv_model);
-  bzla_hashint_map_delete(score);
+  BZLA_RELEASE_STACK(batch);
+  if (bv_model)
+  {
+    bzla_model_delete_bv(bzla, &bv_model);
+    bzla_hashint_map_delete(score);
+  }
   return done;
 }
 
@@ -573,6 +1148,7 @@ select_flip_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   BzlaNode *can;
   BzlaIntHashTable *cans, *bv_model, *score;
   BzlaIntHashTableIterator iit;
+  BzlaIntHashTablePtrStack batch;
   BzlaSLSSolver *slv;
 
   slv       = BZLA_SLS_SOLVER(bzla);
@@ -580,9 +1156,15 @@ select_flip_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
 
   mk = BZLA_SLS_MOVE_FLIP_RANGE;
 
-  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
-  score =
-      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
+  /* candidate moves are collected and evaluated in parallel */
+  BZLA_INIT_STACK(bzla->mm, batch);
+  bv_model = score = 0;
+  if (!slv->nworkers)
+  {
+    bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
+    score    = bzla_hashint_map_clone(
+        bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
+  }
 
   for (up = 1, n_endpos = 0; n_endpos < BZLA_COUNT_STACK(*candidates);
        up = 2 * up + 1)
@@ -625,6 +1207,12 @@ select_flip_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
               : bzla_bv_flipped_bit_range(bzla->mm, ass, cup, clo);
     }
 
+    if (slv->nworkers)
+    {
+      BZLA_PUSH_STACK(batch, cans);
+      continue;
+    }
+
     sc = try_move(bzla, bv_model, score, cans, &done);
     if (slv->terminate)
     {
@@ -634,9 +1222,15 @@ select_flip_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
     BZLA_SLS_SELECT_MOVE_CHECK_SCORE(sc);
   }
 
+  if (slv->nworkers) done = select_move_batch(bzla, &batch, mk, gw);
+
 DONE:
-  bzla_model_delete_bv(bzla, &bv_model);
-  bzla_hashint_map_delete(score);
+  BZLA_RELEASE_STACK(batch);
+  if (bv_model)
+  {
+    bzla_model_delete_bv(bzla, &bv_model);
+    bzla_hashint_map_delete(score);
+  }
   return done;
 }
 
@@ -654,6 +1248,7 @@ select_flip_segment_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   BzlaNode *can;
   BzlaIntHashTable *cans, *bv_model, *score;
   BzlaIntHashTableIterator iit;
+  BzlaIntHashTablePtrStack batch;
   BzlaSLSSolver *slv;
 
   slv       = BZLA_SLS_SOLVER(bzla);
@@ -661,9 +1256,15 @@ select_flip_segment_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
 
   mk = BZLA_SLS_MOVE_FLIP_SEGMENT;
 
-  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
-  score =
-      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
+  /* candidate moves are collected and evaluated in parallel */
+  BZLA_INIT_STACK(bzla->mm, batch);
+  bv_model = score = 0;
+  if (!slv->nworkers)
+  {
+    bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
+    score    = bzla_hashint_map_clone(
+        bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
+  }
 
   for (seg = 2; seg <= 8; seg <<= 1)
   {
@@ -712,6 +1313,12 @@ select_flip_segment_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
                 : bzla_bv_flipped_bit_range(bzla->mm, ass, cup, clo);
       }
 
+      if (slv->nworkers)
+      {
+        BZLA_PUSH_STACK(batch, cans);
+        continue;
+      }
+
       sc = try_move(bzla, bv_model, score, cans, &done);
       if (slv->terminate)
       {
@@ -722,9 +1329,15 @@ select_flip_segment_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
     }
   }
 
+  if (slv->nworkers) done = select_move_batch(bzla, &batch, mk, gw);
+
 DONE:
-  bzla_model_delete_bv(bzla, &bv_model);
-  bzla_hashint_map_delete(score);
+  BZLA_RELEASE_STACK(batch);
+  if (bv_model)
+  {
+    bzla_model_delete_bv(bzla, &bv_model);
+    bzla_hashint_map_delete(score);
+  }
   return done;
 }
 
@@ -831,6 +1444,18 @@ select_move_aux(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
     switch (mk)
     {
       case BZLA_SLS_MOVE_INC:
+        /* The neighbors of inc/dec/not moves with inc move test depend on
+         * the previously selected move, hence they can only be evaluated in
+         * parallel without. */
+        if (slv->nworkers
+            && !bzla_opt_get(bzla, BZLA_OPT_SLS_MOVE_INC_MOVE_TEST))
+        {
+          if ((done =
+                   select_inc_dec_not_moves_parallel(bzla, candidates, gw)))
+            return done;
+          mk = BZLA_SLS_MOVE_NOT; /* dec and not moves are done */
+          break;
+        }
         if ((done = select_inc_dec_not_move(bzla, bzla_bv_inc, candidates, gw)))
           return done;
         break;
@@ -1262,6 +1887,7 @@ move(Bzla *bzla, uint32_t nmoves)
                            &slv->time.update_cone_reset,
                            &slv->time.update_cone_model_gen,
                            &slv->time.update_cone_compute_score);
+  record_move_workers(bzla, slv->max_cans);
 
   slv->stats.moves += 1;
 
@@ -1341,6 +1967,40 @@ DONE:
 
 /*------------------------------------------------------------------------*/
 
+static void
+clone_data_as_constr_data(BzlaMemMgr *mm,
+                          const void *map,
+                          BzlaHashTableData *data,
+                          BzlaHashTableData *cloned_data)
+{
+  assert(mm);
+  assert(data);
+  assert(cloned_data);
+
+  BzlaSLSConstrData *d;
+
+  (void) map;
+
+  BZLA_NEW(mm, d);
+  *d                  = *((BzlaSLSConstrData *) data->as_ptr);
+  cloned_data->as_ptr = d;
+}
+
+static void
+clone_data_as_bvdomain(BzlaMemMgr *mm,
+                       const void *map,
+                       BzlaHashTableData *data,
+                       BzlaHashTableData *cloned_data)
+{
+  assert(mm);
+  assert(data);
+  assert(cloned_data);
+
+  (void) map;
+
+  cloned_data->as_ptr = bzla_bvdomain_copy(mm, data->as_ptr);
+}
+
 static BzlaSLSSolver *
 clone_sls_solver(Bzla *clone, BzlaSLSSolver *slv, BzlaNodeMap *exp_map)
 {
@@ -1357,10 +2017,19 @@ clone_sls_solver(Bzla *clone, BzlaSLSSolver *slv, BzlaNodeMap *exp_map)
   BZLA_NEW(clone->mm, res);
   memcpy(res, slv, sizeof(BzlaSLSSolver));
 
-  res->bzla  = clone;
-  res->roots = bzla_hashint_map_clone(clone->mm, slv->roots, 0, 0);
+  res->bzla    = clone;
+  res->roots   = bzla_hashint_map_clone(clone->mm, slv->roots, 0, 0);
+  res->weights = bzla_hashint_map_clone(
+      clone->mm, slv->weights, clone_data_as_constr_data, 0);
   res->score =
       bzla_hashint_map_clone(clone->mm, slv->score, bzla_clone_data_as_dbl, 0);
+  res->domains = bzla_hashint_map_clone(
+      clone->mm, slv->domains, clone_data_as_bvdomain, 0);
+  if (slv->warm_model)
+    res->warm_model = bzla_model_clone_bv(clone, slv->warm_model, false);
+  res->workers  = 0;
+  res->nworkers = 0;
+  res->pool     = 0;
 
   BZLA_INIT_STACK(clone->mm, res->moves);
   assert(BZLA_SIZE_STACK(slv->moves) || !BZLA_COUNT_STACK(slv->moves));
@@ -1378,7 +2047,7 @@ clone_sls_solver(Bzla *clone, BzlaSLSSolver *slv, BzlaNodeMap *exp_map)
       cm->cans = bzla_hashint_map_clone(
           clone->mm, m->cans, bzla_clone_data_as_bv_ptr, 0);
       cm->sc = m->sc;
-      BZLA_PUSH_STACK(res->moves, m);
+      BZLA_PUSH_STACK(res->moves, cm);
     }
   }
   assert(BZLA_COUNT_STACK(slv->moves) == BZLA_COUNT_STACK(res->moves));
@@ -1412,6 +2081,7 @@ delete_sls_solver(BzlaSLSSolver *slv)
     bzla_bvdomain_free(slv->bzla->mm, bzla_iter_hashint_next_data(&it)->as_ptr);
   }
   bzla_hashint_map_delete(slv->domains);
+  bzla_model_delete_bv(bzla, &slv->warm_model);
   if (slv->weights)
   {
     bzla_iter_hashint_init(&it, slv->weights);
@@ -1453,8 +2123,9 @@ sat_sls_solver(BzlaSLSSolver *slv)
   assert(slv->kind == BZLA_SLS_SOLVER_KIND);
   assert(slv->bzla);
 
+  double start;
   int32_t j, max_steps, id, nmoves;
-  uint32_t nprops;
+  uint32_t nprops, nthreads;
   BzlaSolverResult sat_result;
   BzlaNode *root;
   BzlaSLSConstrData *d;
@@ -1462,10 +2133,12 @@ sat_sls_solver(BzlaSLSSolver *slv)
   BzlaIntHashTableIterator iit;
   Bzla *bzla;
 
-  bzla = slv->bzla;
+  start = bzla_util_time_stamp();
+  bzla  = slv->bzla;
   assert(!bzla->inconsistent);
   nmoves      = 0;
   nprops      = bzla_opt_get(bzla, BZLA_OPT_PROP_NPROPS);
+  nthreads    = bzla_opt_get(bzla, BZLA_OPT_SLS_THREADS);
   slv->nflips = bzla_opt_get(bzla, BZLA_OPT_SLS_NFLIPS);
 
   if (bzla_terminate(bzla))
@@ -1516,7 +2189,15 @@ sat_sls_solver(BzlaSLSSolver *slv)
     }
   }
 
-  if (!slv->score) slv->score = bzla_hashint_map_new(bzla->mm);
+  if (!slv->score) slv->score = bzla_hashint_map_new_dense(bzla->mm);
+
+#ifdef BZLA_HAVE_PTHREADS
+  /* the limit on the number of bit flips is checked move by move, hence
+   * candidate moves are only evaluated in parallel if no limit is set */
+  if (nthreads > 1 && !slv->nflips) init_move_workers(bzla, nthreads);
+#else
+  (void) nthreads;
+#endif
 
   for (;;)
   {
@@ -1578,10 +2259,11 @@ sat_sls_solver(BzlaSLSSolver *slv)
 
     /* restart */
     slv->api.generate_model((BzlaSolver *) slv, false, true);
+    reset_move_workers(bzla);
     bzla_hashint_map_delete(slv->score);
     bzla_hashint_map_delete(slv->roots);
     slv->roots = 0;
-    slv->score = bzla_hashint_map_new(bzla->mm);
+    slv->score = bzla_hashint_map_new_dense(bzla->mm);
     slv->stats.restarts += 1;
   }
 
@@ -1593,6 +2275,12 @@ UNSAT:
   sat_result = BZLA_RESULT_UNSAT;
 
 DONE:
+  delete_move_workers(bzla);
+  if (bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL)
+      && bzla_opt_get(bzla, BZLA_OPT_LS_WARM_START))
+  {
+    bzla_lsutils_save_bv_model(bzla, &slv->warm_model);
+  }
   if (slv->roots)
   {
     bzla_hashint_map_delete(slv->roots);
@@ -1613,6 +2301,7 @@ DONE:
     bzla_hashint_map_delete(slv->score);
     slv->score = 0;
   }
+  slv->time.check_sat += bzla_util_time_stamp() - start;
   return sat_result;
 }
 
@@ -1630,7 +2319,7 @@ generate_model_sls_solver(BzlaSLSSolver *slv,
   bzla = slv->bzla;
 
   if (!reset && bzla->bv_model) return;
-  bzla_lsutils_initialize_bv_model((BzlaSolver *) slv);
+  bzla_lsutils_initialize_bv_model((BzlaSolver *) slv, slv->warm_model);
   bzla_model_init_fun(bzla, &bzla->fun_model);
   bzla_model_generate(
       bzla, bzla->bv_model, bzla->fun_model, model_for_all_nodes);
@@ -1705,6 +2394,14 @@ print_time_stats_sls_solver(BzlaSLSSolver *slv)
   Bzla *bzla = slv->bzla;
 
   BZLA_MSG(bzla->msg, 1, "");
+  BZLA_MSG(bzla->msg,
+           1,
+           "%.2f seconds for sat check (total)",
+           slv->time.check_sat);
+  BZLA_MSG(bzla->msg,
+           1,
+           "moves per second: %.1f",
+           (double) slv->stats.moves / slv->time.check_sat);
   BZLA_MSG(bzla->msg,
            1,
            "%.2f seconds for updating cone (total)",
@@ -1741,7 +2438,7 @@ bzla_new_sls_solver(Bzla *bzla)
 
   slv->bzla    = bzla;
   slv->kind    = BZLA_SLS_SOLVER_KIND;
-  slv->domains = bzla_hashint_map_new(bzla->mm);
+  slv->domains = bzla_hashint_map_new_dense(bzla->mm);
 
   BZLA_INIT_STACK(bzla->mm, slv->moves);
 
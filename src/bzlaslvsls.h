@@ -51,6 +51,34 @@ typedef struct BzlaSLSConstrData BzlaSLSConstrData;
 
 BZLA_DECLARE_STACK(BzlaSLSMovePtr, BzlaSLSMove *);
 
+BZLA_DECLARE_STACK(BzlaIntHashTablePtr, BzlaIntHashTable *);
+
+/* Evaluates candidate moves on a clone of the expression layer (node ids are
+ * preserved) such that the model of the original instance is not modified.
+ * Moves performed on the original instance are replayed on the clone, i.e.,
+ * only the cones of the moved candidates are updated. Model, scores and
+ * unsatisfied roots of the clone are only copied (once) after a restart. */
+struct BzlaSLSMoveWorker
+{
+  Bzla *bzla;   /* the original instance */
+  Bzla *clone;  /* the clone the worker operates on */
+  bool reset;   /* true if the clone must be fully synchronized */
+  bool weights; /* true if assertion weights changed since last sync */
+  BzlaIntHashTablePtrStack moves; /* moves performed on 'bzla' since last
+                                     sync, allocated with the clone's mm */
+
+  /* batch of candidate moves, the worker evaluates moves 'from' to 'to' */
+  BzlaIntHashTable **cans;
+  double *sc;
+  bool *done;
+  size_t from;
+  size_t to;
+};
+typedef struct BzlaSLSMoveWorker BzlaSLSMoveWorker;
+
+/* Threads of the move workers, kept alive across batches of moves. */
+typedef struct BzlaSLSMovePool BzlaSLSMovePool;
+
 /*------------------------------------------------------------------------*/
 
 #define BZLA_SLS_SOLVER(bzla) ((BzlaSLSSolver *) (bzla)->slv)
@@ -69,6 +97,11 @@ struct BzlaSLSSolver
    * the propagation-based strategy if BZLA_OPT_PROP_CONST_BITS is enabled. */
   BzlaIntHashTable *domains;
 
+  /* Map, maintains the assignment of inputs determined by the previous
+   * satisfiability check, used as initial assignment in incremental mode if
+   * BZLA_OPT_LS_WARM_START is enabled. Maps node id to its assignment. */
+  BzlaIntHashTable *warm_model;
+
   uint32_t nflips; /* limit, disabled if 0 */
   bool terminate;
 
@@ -90,6 +123,12 @@ struct BzlaSLSSolver
   BzlaSLSMoveKind max_move; /* move kind (for stats) */
   int32_t max_gw;           /* is groupwise move? (for stats) */
 
+  /* workers for evaluating candidate moves in parallel
+   * (only initialized if BZLA_OPT_SLS_THREADS > 1) */
+  BzlaSLSMoveWorker *workers;
+  uint32_t nworkers;
+  BzlaSLSMovePool *pool;
+
   /* statistics */
   struct
   {
@@ -121,6 +160,7 @@ struct BzlaSLSSolver
 
   struct
   {
+    double check_sat;
     double update_cone;
     double update_cone_reset;
     double update_cone_model_gen;
@@ -0,0 +1,475 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "bzlastoreidx.h"
+
+#include "bzlacore.h"
+
+bool
+bzla_store_index_is_write_exp(BzlaNode *exp,
+                              BzlaNode **array,
+                              BzlaNode **index,
+                              BzlaNode **value)
+{
+  assert(exp);
+  assert(bzla_node_is_regular(exp));
+
+  BzlaNode *param, *body, *eq, *app;
+
+  if (!bzla_node_is_lambda(exp) || bzla_node_fun_get_arity(exp->bzla, exp) > 1)
+    return false;
+
+  param = exp->e[0];
+  body  = bzla_node_binder_get_body(exp);
+
+  if (bzla_node_is_inverted(body) || !bzla_node_is_bv_cond(body)) return false;
+
+  /* check condition */
+  eq = body->e[0];
+  if (bzla_node_is_inverted(eq) || !bzla_node_is_bv_eq(eq) || !eq->parameterized
+      || (eq->e[0] != param && eq->e[1] != param))
+    return false;
+
+  /* check value */
+  if (bzla_node_real_addr(body->e[1])->parameterized) return false;
+
+  /* check apply on unmodified array */
+  app = body->e[2];
+  if (bzla_node_is_inverted(app) || !bzla_node_is_apply(app)
+      || bzla_node_args_get_arity(app->bzla, app->e[1]) > 1
+      || app->e[1]->e[0] != param)
+    return false;
+
+  if (array) *array = app->e[0];
+  if (index) *index = eq->e[1] == param ? eq->e[0] : eq->e[1];
+  if (value) *value = body->e[1];
+  return true;
+}
+
+bool
+bzla_store_index_is_const_store(BzlaNode *fun,
+                                BzlaNode **array,
+                                BzlaNode **index,
+                                BzlaNode **value)
+{
+  assert(fun);
+  assert(bzla_node_is_regular(fun));
+
+  BzlaNode *a, *i, *v;
+
+  if (fun->parameterized) return false;
+
+  if (bzla_node_is_update(fun))
+  {
+    if (bzla_node_args_get_arity(fun->bzla, fun->e[1]) > 1) return false;
+    a = fun->e[0];
+    i = fun->e[1]->e[0];
+    v = fun->e[2];
+  }
+  else if (!bzla_store_index_is_write_exp(fun, &a, &i, &v))
+    return false;
+
+  if (!bzla_node_is_bv_const(i) || bzla_node_real_addr(a)->parameterized)
+    return false;
+
+  if (array) *array = a;
+  if (index) *index = i;
+  if (value) *value = v;
+  return true;
+}
+
+/* Positions of the stores with the same index. */
+struct BzlaStoreIndexPositions
+{
+  BzlaIntStack up;   /* ascending positions >= 0 */
+  BzlaIntStack down; /* descending positions < 0 */
+};
+
+typedef struct BzlaStoreIndexPositions BzlaStoreIndexPositions;
+
+static void
+add_position(BzlaMemMgr *mm, BzlaStoreIndex *sidx, BzlaNode *index, int32_t pos)
+{
+  BzlaPtrHashBucket *b;
+  BzlaStoreIndexPositions *positions;
+  BzlaIntStack *stack;
+
+  b = bzla_hashptr_table_get(sidx->index, index);
+  if (!b)
+  {
+    BZLA_NEW(mm, positions);
+    BZLA_INIT_STACK(mm, positions->up);
+    BZLA_INIT_STACK(mm, positions->down);
+    b              = bzla_hashptr_table_add(sidx->index, index);
+    b->data.as_ptr = positions;
+  }
+  positions = b->data.as_ptr;
+  stack     = pos >= 0 ? &positions->up : &positions->down;
+  /* static_rho indices of a lambda may be assigned to the same value */
+  if (BZLA_EMPTY_STACK(*stack) || BZLA_TOP_STACK(*stack) != pos)
+    BZLA_PUSH_STACK(*stack, pos);
+}
+
+static void
+add_store(Bzla *bzla, BzlaStoreIndex *sidx, BzlaNode *fun, int32_t pos)
+{
+  assert(bzla_store_index_get_next(bzla, sidx->kind, fun));
+  assert(!bzla_hashint_map_contains(sidx->pos, fun->id));
+
+  BzlaMemMgr *mm;
+  BzlaNode *index;
+  BzlaPtrHashTableIterator it;
+
+  mm = bzla->mm;
+  if (pos >= 0)
+  {
+    assert(pos == (int32_t) BZLA_COUNT_STACK(sidx->up));
+    BZLA_PUSH_STACK(sidx->up, fun);
+  }
+  else
+  {
+    assert(pos == -(int32_t) BZLA_COUNT_STACK(sidx->down) - 1);
+    BZLA_PUSH_STACK(sidx->down, fun);
+  }
+  bzla_hashint_map_add(sidx->pos, fun->id)->as_int = pos;
+
+  if (sidx->kind == BZLA_STORE_INDEX_CONST)
+  {
+    bzla_store_index_is_const_store(fun, 0, &index, 0);
+    add_position(mm, sidx, index, pos);
+  }
+  else if (bzla_node_is_update(fun))
+    add_position(mm, sidx, fun->e[1], pos);
+  else
+  {
+    bzla_iter_hashptr_init(&it, bzla_node_lambda_get_static_rho(fun));
+    while (bzla_iter_hashptr_has_next(&it))
+    {
+      index = bzla_node_get_simplified(bzla, bzla_iter_hashptr_next(&it));
+      add_position(mm, sidx, index, pos);
+    }
+  }
+}
+
+BzlaNode *
+bzla_store_index_get_next(Bzla *bzla, BzlaStoreIndexKind kind, BzlaNode *fun)
+{
+  assert(bzla);
+  assert(fun);
+  assert(bzla_node_is_regular(fun));
+
+  BzlaNode *array, *body, *app;
+
+  if (kind == BZLA_STORE_INDEX_CONST)
+  {
+    if (!bzla_store_index_is_const_store(fun, &array, 0, 0)) return 0;
+    return bzla_node_get_simplified(bzla, array);
+  }
+
+  if (bzla_node_is_update(fun))
+    return bzla_node_get_simplified(bzla, fun->e[0]);
+
+  if (!bzla_node_is_lambda(fun) || fun->parameterized
+      || !bzla_node_lambda_get_static_rho(fun))
+    return 0;
+
+  /* pattern: cond ? value : a[j] */
+  body = bzla_node_binder_get_body(fun);
+  if (bzla_node_is_inverted(body) || !bzla_node_is_bv_cond(body)) return 0;
+  app = body->e[2];
+  if (bzla_node_is_inverted(app) || !bzla_node_is_apply(app)
+      || app->e[0]->parameterized
+      || bzla_node_args_get_arity(bzla, app->e[1]) > 1
+      || app->e[1]->e[0] != fun->e[0])
+    return 0;
+  return bzla_node_get_simplified(bzla, app->e[0]);
+}
+
+BzlaStoreIndex *
+bzla_store_index_new(Bzla *bzla,
+                     BzlaStoreIndexKind kind,
+                     BzlaNode *fun,
+                     BzlaHashPtr hash,
+                     BzlaCmpPtr cmp)
+{
+  assert(bzla);
+  assert(fun);
+  assert(bzla_node_is_regular(fun));
+  assert(bzla_store_index_get_next(bzla, kind, fun));
+
+  BzlaMemMgr *mm;
+  BzlaStoreIndex *res;
+
+  mm = bzla->mm;
+  BZLA_CNEW(mm, res);
+  res->kind = kind;
+  BZLA_INIT_STACK(mm, res->up);
+  BZLA_INIT_STACK(mm, res->down);
+  res->pos   = bzla_hashint_map_new(mm);
+  res->index = bzla_hashptr_table_new(mm, hash, cmp);
+  add_store(bzla, res, fun, 0);
+  return res;
+}
+
+void
+bzla_store_index_delete(Bzla *bzla, BzlaStoreIndex *sidx)
+{
+  assert(bzla);
+  assert(sidx);
+
+  BzlaStoreIndexPositions *positions;
+  BzlaPtrHashTableIterator it;
+
+  bzla_iter_hashptr_init(&it, sidx->index);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    positions = bzla_iter_hashptr_next_data(&it)->as_ptr;
+    BZLA_RELEASE_STACK(positions->up);
+    BZLA_RELEASE_STACK(positions->down);
+    BZLA_DELETE(bzla->mm, positions);
+  }
+  bzla_hashptr_table_delete(sidx->index);
+  bzla_hashint_map_delete(sidx->pos);
+  BZLA_RELEASE_STACK(sidx->up);
+  BZLA_RELEASE_STACK(sidx->down);
+  BZLA_DELETE(bzla->mm, sidx);
+}
+
+BzlaNode *
+bzla_store_index_get_store(BzlaStoreIndex *sidx, int32_t pos)
+{
+  assert(sidx);
+
+  if (pos >= 0) return BZLA_PEEK_STACK(sidx->up, pos);
+  return BZLA_PEEK_STACK(sidx->down, -pos - 1);
+}
+
+int32_t
+bzla_store_index_get_pos(BzlaStoreIndex *sidx, BzlaNode *fun)
+{
+  assert(sidx);
+  assert(fun);
+  assert(bzla_hashint_map_contains(sidx->pos, fun->id));
+
+  return bzla_hashint_map_get(sidx->pos, fun->id)->as_int;
+}
+
+int32_t
+bzla_store_index_get_bottom(BzlaStoreIndex *sidx)
+{
+  assert(sidx);
+
+  if (BZLA_EMPTY_STACK(sidx->down)) return 0;
+  return -(int32_t) BZLA_COUNT_STACK(sidx->down);
+}
+
+BzlaNode *
+bzla_store_index_extend(Bzla *bzla,
+                        BzlaStoreIndex *sidx,
+                        BzlaIntHashTable *stop)
+{
+  assert(bzla);
+  assert(sidx);
+  assert(!sidx->base);
+
+  int32_t bottom;
+  BzlaNode *next;
+
+  bottom = bzla_store_index_get_bottom(sidx);
+  next   = bzla_store_index_get_next(
+      bzla, sidx->kind, bzla_store_index_get_store(sidx, bottom));
+  assert(next);
+  assert(bzla_node_is_regular(next));
+  if (!bzla_store_index_get_next(bzla, sidx->kind, next)
+      || (stop && bzla_hashint_map_contains(stop, next->id)))
+  {
+    sidx->base = next;
+    return 0;
+  }
+  add_store(bzla, sidx, next, bottom - 1);
+  return next;
+}
+
+bool
+bzla_store_index_find(BzlaStoreIndex *sidx,
+                      BzlaNode *index,
+                      int32_t below,
+                      int32_t *pos)
+{
+  assert(sidx);
+  assert(index);
+  assert(pos);
+
+  uint32_t lo, hi, mid;
+  BzlaPtrHashBucket *b;
+  BzlaStoreIndexPositions *positions;
+
+  b = bzla_hashptr_table_get(sidx->index, index);
+  if (!b) return false;
+  positions = b->data.as_ptr;
+
+  /* last position less than 'below' in ascending 'up' */
+  lo = 0;
+  hi = BZLA_COUNT_STACK(positions->up);
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (BZLA_PEEK_STACK(positions->up, mid) < below)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo > 0)
+  {
+    *pos = BZLA_PEEK_STACK(positions->up, lo - 1);
+    return true;
+  }
+
+  /* first position less than 'below' in descending 'down' */
+  lo = 0;
+  hi = BZLA_COUNT_STACK(positions->down);
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (BZLA_PEEK_STACK(positions->down, mid) >= below)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo < BZLA_COUNT_STACK(positions->down))
+  {
+    *pos = BZLA_PEEK_STACK(positions->down, lo);
+    return true;
+  }
+  return false;
+}
+
+BzlaStoreIndex *
+bzla_store_index_get(Bzla *bzla, BzlaNode *fun)
+{
+  assert(bzla);
+  assert(fun);
+  assert(bzla_node_is_regular(fun));
+
+  BzlaMemMgr *mm;
+  BzlaNode *cur, *array;
+  BzlaNodePtrStack visit;
+  BzlaHashTableData *d;
+  BzlaStoreIndex *res;
+
+  /* constants are only normalized if rewriting is enabled, i.e., different
+   * constant nodes may represent the same value otherwise */
+  if (bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL) == 0) return 0;
+
+  mm = bzla->mm;
+  if (!bzla->store_indices) bzla->store_indices = bzla_hashint_map_new(mm);
+
+  if ((d = bzla_hashint_map_get(bzla->store_indices, fun->id)))
+    return d->as_ptr;
+
+  if (!bzla_store_index_is_const_store(fun, 0, 0, 0)) return 0;
+
+  res = 0;
+  BZLA_INIT_STACK(mm, visit);
+  cur = fun;
+  while (bzla_store_index_is_const_store(cur, &array, 0, 0))
+  {
+    /* take over the index of the chain below */
+    if ((d = bzla_hashint_map_get(bzla->store_indices, cur->id)))
+    {
+      res = d->as_ptr;
+      bzla_hashint_map_remove(bzla->store_indices, cur->id, 0);
+      break;
+    }
+    BZLA_PUSH_STACK(visit, cur);
+    cur = bzla_node_get_simplified(bzla, array);
+    assert(bzla_node_is_regular(cur));
+  }
+
+  if (res)
+  {
+    while (!BZLA_EMPTY_STACK(visit))
+    {
+      cur = BZLA_POP_STACK(visit);
+      add_store(bzla, res, cur, BZLA_COUNT_STACK(res->up));
+    }
+  }
+  else
+  {
+    /* the stores below 'fun' are indexed on demand */
+    res = bzla_store_index_new(bzla,
+                               BZLA_STORE_INDEX_CONST,
+                               fun,
+                               (BzlaHashPtr) bzla_node_hash_by_id,
+                               (BzlaCmpPtr) bzla_node_compare_by_id);
+    bzla->stats.store_indices_built++;
+  }
+  BZLA_RELEASE_STACK(visit);
+
+  assert(BZLA_TOP_STACK(res->up) == fun);
+  bzla_hashint_map_add(bzla->store_indices, fun->id)->as_ptr = res;
+  return res;
+}
+
+BzlaNode *
+bzla_store_index_lookup(Bzla *bzla, BzlaStoreIndex *sidx, BzlaNode *index)
+{
+  assert(bzla);
+  assert(sidx);
+  assert(sidx->kind == BZLA_STORE_INDEX_CONST);
+  assert(index);
+  assert(bzla_node_is_bv_const(index));
+
+  int32_t pos;
+  BzlaNode *cur, *cur_index;
+
+  if (bzla_store_index_find(sidx, index, BZLA_COUNT_STACK(sidx->up), &pos))
+    return bzla_store_index_get_store(sidx, pos);
+
+  while (!sidx->base && (cur = bzla_store_index_extend(bzla, sidx, 0)))
+  {
+    bzla_store_index_is_const_store(cur, 0, &cur_index, 0);
+    if (cur_index == index) return cur;
+  }
+  assert(sidx->base);
+  return sidx->base;
+}
+
+void
+bzla_store_index_remove(Bzla *bzla, BzlaNode *fun)
+{
+  assert(bzla);
+  assert(fun);
+
+  BzlaHashTableData d;
+
+  if (!bzla->store_indices
+      || !bzla_hashint_map_contains(bzla->store_indices, fun->id))
+    return;
+
+  bzla_hashint_map_remove(bzla->store_indices, fun->id, &d);
+  bzla_store_index_delete(bzla, d.as_ptr);
+}
+
+void
+bzla_store_index_delete_all(Bzla *bzla)
+{
+  assert(bzla);
+
+  BzlaIntHashTableIterator it;
+
+  if (!bzla->store_indices) return;
+
+  bzla_iter_hashint_init(&it, bzla->store_indices);
+  while (bzla_iter_hashint_has_next(&it))
+    bzla_store_index_delete(bzla, bzla_iter_hashint_next_data(&it)->as_ptr);
+  bzla_hashint_map_delete(bzla->store_indices);
+  bzla->store_indices = 0;
+}
@@ -0,0 +1,142 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLASTOREIDX_H_INCLUDED
+#define BZLASTOREIDX_H_INCLUDED
+
+#include "bzlanode.h"
+#include "utils/bzlahashint.h"
+#include "utils/bzlahashptr.h"
+
+/* Index of a chain of stores s_0, ..., s_m, where s_i+1 is the array below
+ * s_i, that maps the indices of the stores to their positions on the chain.
+ * Reads can then be propagated to the first store that may hold the read
+ * index without visiting every store in between.
+ *
+ * The kind of an index determines which functions are stores and how their
+ * indices are compared:
+ *
+ *  - BZLA_STORE_INDEX_CONST: Updates and array write lambdas with a constant
+ *    index. Indices are compared by node, which requires rewriting to be
+ *    enabled (constants are only normalized then).
+ *
+ *  - BZLA_STORE_INDEX_ASSIGNMENT: Updates and array lambdas extracted from
+ *    memset/memcpy/iterative initialization patterns (with static_rho).
+ *    Indices are compared by their current assignment (via the given hash and
+ *    compare functions). The condition of an extracted lambda can only be
+ *    true for indices assigned to the same value as one of its static_rho
+ *    indices.
+ *
+ * An index is built lazily, i.e., it only covers the stores down to the
+ * first store with a matching index of all lookups so far, and can be
+ * extended on both ends. Positions of stores pushed on top of the chain are
+ * greater and positions of stores below the chain are less than those of all
+ * other stores on the chain.
+ */
+enum BzlaStoreIndexKind
+{
+  BZLA_STORE_INDEX_CONST,
+  BZLA_STORE_INDEX_ASSIGNMENT,
+};
+typedef enum BzlaStoreIndexKind BzlaStoreIndexKind;
+
+struct BzlaStoreIndex
+{
+  BzlaStoreIndexKind kind;
+  BzlaNodePtrStack up;     /* stores at positions 0, 1, ... */
+  BzlaNodePtrStack down;   /* stores at positions -1, -2, ... */
+  BzlaIntHashTable *pos;   /* maps store id to position */
+  BzlaPtrHashTable *index; /* maps store index to positions */
+  BzlaNode *base;          /* function below the chain, 0 if not reached */
+};
+
+typedef struct BzlaStoreIndex BzlaStoreIndex;
+
+/* Returns true if 'exp' is a lambda representing an array write. If so,
+ * 'array', 'index' and 'value' are set accordingly (if given). */
+bool bzla_store_index_is_write_exp(BzlaNode *exp,
+                                   BzlaNode **array,
+                                   BzlaNode **index,
+                                   BzlaNode **value);
+
+/* Returns true if 'fun' is an update or array write lambda with a constant
+ * index. If so, 'array', 'index' and 'value' are set accordingly (if
+ * given). */
+bool bzla_store_index_is_const_store(BzlaNode *fun,
+                                     BzlaNode **array,
+                                     BzlaNode **index,
+                                     BzlaNode **value);
+
+/* Returns the (simplified) array below 'fun' if 'fun' is a store of given
+ * kind, and 0 otherwise. */
+BzlaNode *bzla_store_index_get_next(Bzla *bzla,
+                                    BzlaStoreIndexKind kind,
+                                    BzlaNode *fun);
+
+/* Create a new index of given kind for the chain starting at store 'fun'.
+ * Indices are hashed and compared with 'hash' and 'cmp'. */
+BzlaStoreIndex *bzla_store_index_new(Bzla *bzla,
+                                     BzlaStoreIndexKind kind,
+                                     BzlaNode *fun,
+                                     BzlaHashPtr hash,
+                                     BzlaCmpPtr cmp);
+
+/* Delete index 'sidx'. */
+void bzla_store_index_delete(Bzla *bzla, BzlaStoreIndex *sidx);
+
+/* Get the store at position 'pos' of 'sidx'. */
+BzlaNode *bzla_store_index_get_store(BzlaStoreIndex *sidx, int32_t pos);
+
+/* Get the position of store 'fun' in 'sidx'. */
+int32_t bzla_store_index_get_pos(BzlaStoreIndex *sidx, BzlaNode *fun);
+
+/* Get the position of the bottommost store of 'sidx'. */
+int32_t bzla_store_index_get_bottom(BzlaStoreIndex *sidx);
+
+/* Extend 'sidx' by the store below its bottommost store. Returns the new
+ * store, or 0 if the function below is not a store or contained in 'stop'
+ * (if given), in which case it becomes the base of 'sidx'. */
+BzlaNode *bzla_store_index_extend(Bzla *bzla,
+                                  BzlaStoreIndex *sidx,
+                                  BzlaIntHashTable *stop);
+
+/* Find the greatest position less than 'below' of a store with given
+ * 'index' in the part of the chain indexed so far. Returns false if there is
+ * no such store. */
+bool bzla_store_index_find(BzlaStoreIndex *sidx,
+                           BzlaNode *index,
+                           int32_t below,
+                           int32_t *pos);
+
+/* Get the index of kind BZLA_STORE_INDEX_CONST of the chain starting at
+ * 'fun' (created on demand). Returns 0 if 'fun' is not a store with a
+ * constant index or if rewriting is disabled.
+ *
+ * These indices are maintained per chain, keyed by the topmost store. When a
+ * store is added on top of an indexed chain, the index of the chain is
+ * handed over to (and extended by) the new topmost store, hence chains that
+ * are built incrementally do not require to be re-indexed. Note that this
+ * mutates the index, which is then no longer associated with the store
+ * below, i.e., the result must not be used after subsequent calls. */
+BzlaStoreIndex *bzla_store_index_get(Bzla *bzla, BzlaNode *fun);
+
+/* Get the first store from the top of 'sidx' (of kind BZLA_STORE_INDEX_CONST)
+ * with constant 'index', or the base of the chain if there is none. */
+BzlaNode *bzla_store_index_lookup(Bzla *bzla,
+                                  BzlaStoreIndex *sidx,
+                                  BzlaNode *index);
+
+/* Remove the index of the store chain starting at 'fun' (if any). */
+void bzla_store_index_remove(Bzla *bzla, BzlaNode *fun);
+
+/* Delete all store indices. */
+void bzla_store_index_delete_all(Bzla *bzla);
+
+#endif
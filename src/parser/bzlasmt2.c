@@ -5589,6 +5589,15 @@ set_option_smt2(BzlaSMT2Parser *parser)
       assert(parser->error);
       return 0;
     }
+    if (tag == BZLA_STRING_CONSTANT_TAG_SMT2)
+    {
+      /* strip quotes */
+      size_t len = strlen(parser->token.start);
+      assert(len >= 2);
+      parser->token.start[len - 1] = 0;
+      bitwuzla_set_option_str(bitwuzla, o, parser->token.start + 1);
+      return skip_sexprs(parser, 1);
+    }
     val = bitwuzla_get_option(bitwuzla, o);
     if (tag == BZLA_FALSE_TAG_SMT2)
       val = 0;
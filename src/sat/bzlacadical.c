@@ -24,11 +24,6 @@ init(BzlaSATMgr *smgr)
 {
   (void) smgr;
   CCaDiCaL *slv = ccadical_init();
-  if (smgr->inc_required
-      && bzla_opt_get(smgr->bzla, BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE))
-  {
-    ccadical_set_option(slv, "checkfrozen", 1);
-  }
   ccadical_set_option(slv, "shrink", 0);
   return slv;
 }
@@ -95,15 +90,14 @@ setterm(BzlaSATMgr *smgr)
 /* incremental API                                                        */
 /*------------------------------------------------------------------------*/
 
-static int32_t
-inc_max_var(BzlaSATMgr *smgr)
+/* Only variables that may be referenced by future clauses or assumptions are
+ * frozen explicitly (see bzla_aig_mgr_update_frozen), all other variables may
+ * be eliminated by inprocessing.  If an eliminated variable is used again,
+ * CaDiCaL restores the clauses it was eliminated with. */
+static void
+freeze(BzlaSATMgr *smgr, int32_t lit)
 {
-  int32_t var = smgr->maxvar + 1;
-  if (smgr->inc_required)
-  {
-    ccadical_freeze(smgr->solver, var);
-  }
-  return var;
+  if (smgr->inc_required) ccadical_freeze(smgr->solver, lit);
 }
 
 static void
@@ -112,6 +106,21 @@ melt(BzlaSATMgr *smgr, int32_t lit)
   if (smgr->inc_required) ccadical_melt(smgr->solver, lit);
 }
 
+static void
+setlearn(BzlaSATMgr *smgr)
+{
+  ccadical_set_learn(smgr->solver,
+                     smgr->learn.state,
+                     smgr->learn.max_size,
+                     (void (*)(void *, int *)) smgr->learn.fun);
+}
+
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  ccadical_phase(smgr->solver, lit);
+}
+
 /*------------------------------------------------------------------------*/
 
 bool
@@ -131,9 +140,11 @@ bzla_sat_enable_cadical(BzlaSATMgr *smgr)
   smgr->api.enable_verbosity = enable_verbosity;
   smgr->api.failed           = failed;
   smgr->api.fixed            = 0;
+  smgr->api.freeze           = 0;
   smgr->api.inc_max_var      = 0;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
@@ -141,11 +152,12 @@ bzla_sat_enable_cadical(BzlaSATMgr *smgr)
   smgr->api.set_prefix       = 0;
   smgr->api.stats            = 0;
   smgr->api.setterm          = setterm;
+  smgr->api.setlearn         = setlearn;
 
   if (bzla_opt_get(smgr->bzla, BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE))
   {
-    smgr->api.inc_max_var = inc_max_var;
-    smgr->api.melt        = melt;
+    smgr->api.freeze = freeze;
+    smgr->api.melt   = melt;
   }
   else
   {
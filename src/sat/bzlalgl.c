@@ -249,6 +249,13 @@ melt(BzlaSATMgr *smgr, int32_t lit)
   if (smgr->inc_required) lglmelt(blgl->lgl, lit);
 }
 
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaLGL *blgl = smgr->solver;
+  lglsetphase(blgl->lgl, lit);
+}
+
 static int32_t
 failed(BzlaSATMgr *smgr, int32_t lit)
 {
@@ -263,6 +270,18 @@ fixed(BzlaSATMgr *smgr, int32_t lit)
   return lglfixed(blgl->lgl, lit);
 }
 
+static void
+counters(BzlaSATMgr *smgr,
+         int64_t *conflicts,
+         int64_t *decisions,
+         int64_t *propagations)
+{
+  BzlaLGL *blgl = smgr->solver;
+  *conflicts    = lglgetconfs(blgl->lgl);
+  *decisions    = lglgetdecs(blgl->lgl);
+  *propagations = lglgetprops(blgl->lgl);
+}
+
 static void *
 clone(Bzla *bzla, BzlaSATMgr *smgr)
 {
@@ -321,6 +340,7 @@ bzla_sat_enable_lingeling(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
   smgr->api.melt             = melt;
+  smgr->api.phase            = phase;
   smgr->api.repr             = repr;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
@@ -329,6 +349,7 @@ bzla_sat_enable_lingeling(BzlaSATMgr *smgr)
   smgr->api.stats            = stats;
   smgr->api.clone            = clone;
   smgr->api.setterm          = setterm;
+  smgr->api.counters         = counters;
   return true;
 }
 
@@ -125,6 +125,12 @@ class BzlaMiniSAT : public SimpSolver
     return res;
   }
 
+  void phase(int32_t lit)
+  {
+    Lit l            = import(lit);
+    polarity[var(l)] = sign(l);
+  }
+
   int32_t deref(int32_t lit)
   {
     if (nomodel) return fixed(lit);
@@ -203,6 +209,13 @@ failed(BzlaSATMgr* smgr, int32_t lit)
   return solver->failed(lit);
 }
 
+static void
+phase(BzlaSATMgr* smgr, int32_t lit)
+{
+  BzlaMiniSAT* solver = (BzlaMiniSAT*) smgr->solver;
+  solver->phase(lit);
+}
+
 static void
 enable_verbosity(BzlaSATMgr* smgr, int32_t level)
 {
@@ -228,6 +241,18 @@ stats(BzlaSATMgr* smgr)
   fflush(stdout);
 }
 
+static void
+counters(BzlaSATMgr* smgr,
+         int64_t* conflicts,
+         int64_t* decisions,
+         int64_t* propagations)
+{
+  BzlaMiniSAT* solver = (BzlaMiniSAT*) smgr->solver;
+  *conflicts          = solver->conflicts;
+  *decisions          = solver->decisions;
+  *propagations       = solver->propagations;
+}
+
 /*------------------------------------------------------------------------*/
 
 bool
@@ -249,12 +274,14 @@ bzla_sat_enable_minisat(BzlaSATMgr* smgr)
   smgr->api.fixed            = fixed;
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
   smgr->api.set_output       = 0;
   smgr->api.set_prefix       = 0;
   smgr->api.stats            = stats;
+  smgr->api.counters         = counters;
   return true;
 }
 };
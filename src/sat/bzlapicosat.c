@@ -16,6 +16,8 @@
 #ifdef BZLA_USE_PICOSAT
 /*------------------------------------------------------------------------*/
 
+#include <stdlib.h>
+
 #include "bzlacore.h"
 #include "picosat.h"
 
@@ -91,6 +93,18 @@ stats(BzlaSATMgr *smgr)
   picosat_stats(smgr->solver);
 }
 
+static void
+counters(BzlaSATMgr *smgr,
+         int64_t *conflicts,
+         int64_t *decisions,
+         int64_t *propagations)
+{
+  /* PicoSAT does not provide the number of conflicts */
+  *conflicts    = -1;
+  *decisions    = picosat_decisions(smgr->solver);
+  *propagations = picosat_propagations(smgr->solver);
+}
+
 static int32_t
 fixed(BzlaSATMgr *smgr, int32_t lit)
 {
@@ -111,6 +125,12 @@ failed(BzlaSATMgr *smgr, int32_t lit)
   return picosat_failed_assumption(smgr->solver, lit);
 }
 
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  picosat_set_default_phase_lit(smgr->solver, abs(lit), lit > 0 ? 1 : -1);
+}
+
 /*------------------------------------------------------------------------*/
 
 bool
@@ -133,12 +153,14 @@ bzla_sat_enable_picosat(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
   smgr->api.set_output       = set_output;
   smgr->api.set_prefix       = set_prefix;
   smgr->api.stats            = stats;
+  smgr->api.counters         = counters;
   return true;
 }
 /*------------------------------------------------------------------------*/
@@ -17,6 +17,12 @@
 #define HOP_RANGE 32
 #define ADD_RANGE 8 * HOP_RANGE
 
+/* Dense tables fall back to hashing if they would grow beyond
+ * DENSE_MIN_SIZE positions with less than one key per DENSE_FACTOR
+ * positions. */
+#define DENSE_MIN_SIZE 1024
+#define DENSE_FACTOR 16
+
 /*----------------------------------------------------------------------------*/
 
 static inline uint32_t
@@ -221,6 +227,82 @@ resize(BzlaIntHashTable *t)
   assert(old_count == t->count);
 }
 
+/*----------------------------------------------------------------------------*/
+/* dense mode                                                                 */
+/*----------------------------------------------------------------------------*/
+
+/* Positive keys are stored at even, negative keys at odd positions. */
+static inline size_t
+dense_pos(int32_t key)
+{
+  assert(key);
+  return key > 0 ? (size_t) key << 1 : ((size_t) (-(int64_t) key) << 1) | 1;
+}
+
+/* Convert dense table 't' into a regular hash table. */
+static void
+dense_to_hash(BzlaIntHashTable *t)
+{
+  assert(t->dense);
+  assert(!t->hop_info);
+
+  size_t i, pos, old_size;
+  int32_t *old_keys;
+  BzlaHashTableData *old_data;
+
+  old_size = t->size;
+  old_keys = t->keys;
+  old_data = t->data;
+
+  t->dense = false;
+  t->size  = initsize(HOP_RANGE);
+  while (t->size < 2 * t->count) t->size <<= 1;
+  t->count = 0;
+  BZLA_CNEWN(t->mm, t->keys, t->size);
+  BZLA_CNEWN(t->mm, t->hop_info, t->size);
+  if (old_data) BZLA_CNEWN(t->mm, t->data, t->size);
+
+  for (i = 0; i < old_size; i++)
+  {
+    if (!old_keys[i]) continue;
+    pos = bzla_hashint_table_add(t, old_keys[i]);
+    if (old_data) t->data[pos] = old_data[i];
+  }
+
+  BZLA_DELETEN(t->mm, old_keys, old_size);
+  if (old_data) BZLA_DELETEN(t->mm, old_data, old_size);
+}
+
+/* Grow dense table 't' to include position 'pos'. Returns false (and converts
+ * 't' into a regular hash table) if 't' would become too sparse. */
+static bool
+dense_resize(BzlaIntHashTable *t, size_t pos)
+{
+  assert(t->dense);
+  assert(pos >= t->size);
+
+  size_t new_size;
+
+  new_size = t->size;
+  while (new_size <= pos) new_size <<= 1;
+
+  if (new_size > DENSE_MIN_SIZE && new_size > DENSE_FACTOR * (t->count + 1))
+  {
+    dense_to_hash(t);
+    return false;
+  }
+
+  BZLA_REALLOC(t->mm, t->keys, t->size, new_size);
+  BZLA_CLRN(t->keys + t->size, new_size - t->size);
+  if (t->data)
+  {
+    BZLA_REALLOC(t->mm, t->data, t->size, new_size);
+    BZLA_CLRN(t->data + t->size, new_size - t->size);
+  }
+  t->size = new_size;
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /* hash table                                                                 */
 /*----------------------------------------------------------------------------*/
@@ -238,20 +320,34 @@ bzla_hashint_table_new(BzlaMemMgr *mm)
   return res;
 }
 
+BzlaIntHashTable *
+bzla_hashint_table_new_dense(BzlaMemMgr *mm)
+{
+  BzlaIntHashTable *res;
+
+  /* no displacement information required in dense mode */
+  BZLA_CNEW(mm, res);
+  res->mm    = mm;
+  res->size  = initsize(HOP_RANGE);
+  res->dense = true;
+  BZLA_CNEWN(mm, res->keys, res->size);
+  return res;
+}
+
 void
 bzla_hashint_table_delete(BzlaIntHashTable *t)
 {
   assert(!t->data);
   BZLA_DELETEN(t->mm, t->keys, t->size);
-  BZLA_DELETEN(t->mm, t->hop_info, t->size);
+  if (t->hop_info) BZLA_DELETEN(t->mm, t->hop_info, t->size);
   BZLA_DELETE(t->mm, t);
 }
 
 size_t
 bzla_hashint_table_size(BzlaIntHashTable *t)
 {
-  return sizeof(BzlaIntHashTable)
-         + t->size * (sizeof(*t->keys) + sizeof(*t->hop_info));
+  return sizeof(BzlaIntHashTable) + t->size * sizeof(*t->keys)
+         + (t->hop_info ? t->size * sizeof(*t->hop_info) : 0);
 }
 
 size_t
@@ -261,6 +357,22 @@ bzla_hashint_table_add(BzlaIntHashTable *t, int32_t key)
 
   size_t pos;
 
+  if (t->dense)
+  {
+    pos = dense_pos(key);
+    if (pos < t->size || dense_resize(t, pos))
+    {
+      if (!t->keys[pos])
+      {
+        t->keys[pos] = key;
+        t->count += 1;
+      }
+      assert(t->keys[pos] == key);
+      return pos;
+    }
+    assert(!t->dense);
+  }
+
   //  print_density (t, key);
   pos = add(t, key);
   /* 'add(...)' returns 't->size' if 'key' could not be added to 't'. hence,
@@ -285,7 +397,7 @@ bzla_hashint_table_clear(BzlaIntHashTable *t)
   assert(t);
   t->count = 0;
   memset(t->keys, 0, sizeof(*t->keys) * t->size);
-  memset(t->hop_info, 0, sizeof(*t->hop_info) * t->size);
+  if (t->hop_info) memset(t->hop_info, 0, sizeof(*t->hop_info) * t->size);
 }
 
 size_t
@@ -298,8 +410,8 @@ bzla_hashint_table_remove(BzlaIntHashTable *t, int32_t key)
   if (pos == t->size) return pos;
 
   assert(t->keys[pos] == key);
-  t->keys[pos]     = 0;
-  t->hop_info[pos] = 0;
+  t->keys[pos] = 0;
+  if (t->hop_info) t->hop_info[pos] = 0;
   t->count -= 1;
   return pos;
 }
@@ -313,6 +425,13 @@ bzla_hashint_table_get_pos(BzlaIntHashTable *t, int32_t key)
 
   keys = t->keys;
   size = t->size;
+
+  if (t->dense)
+  {
+    i = dense_pos(key);
+    return i < size && keys[i] == key ? i : size;
+  }
+
   h    = hash(key);
   i    = h & (pow2size(size) - 1);
   end  = i + HOP_RANGE;
@@ -335,12 +454,19 @@ bzla_hashint_table_clone(BzlaMemMgr *mm, BzlaIntHashTable *table)
 
   if (!table) return NULL;
 
-  res = bzla_hashint_table_new(mm);
-  while (res->size < table->size) resize(res);
-  assert(res->size == table->size);
+  BZLA_CNEW(mm, res);
+  res->mm    = mm;
+  res->size  = table->size;
+  res->dense = table->dense;
+  BZLA_CNEWN(mm, res->keys, res->size);
   memcpy(res->keys, table->keys, table->size * sizeof(*table->keys));
-  memcpy(
-      res->hop_info, table->hop_info, table->size * sizeof(*table->hop_info));
+  if (table->hop_info)
+  {
+    BZLA_CNEWN(mm, res->hop_info, res->size);
+    memcpy(res->hop_info,
+           table->hop_info,
+           table->size * sizeof(*table->hop_info));
+  }
   res->count = table->count;
   return res;
 }
@@ -359,6 +485,16 @@ bzla_hashint_map_new(BzlaMemMgr *mm)
   return res;
 }
 
+BzlaIntHashTable *
+bzla_hashint_map_new_dense(BzlaMemMgr *mm)
+{
+  BzlaIntHashTable *res;
+
+  res = bzla_hashint_table_new_dense(mm);
+  BZLA_CNEWN(mm, res->data, res->size);
+  return res;
+}
+
 bool
 bzla_hashint_map_contains(BzlaIntHashTable *t, int32_t key)
 {
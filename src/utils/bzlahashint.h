@@ -25,8 +25,9 @@ struct BzlaIntHashTable
   size_t count;
   size_t size;
   int32_t *keys;
-  uint8_t *hop_info; /** displacement information */
+  uint8_t *hop_info; /** displacement information (0 in dense mode) */
   BzlaHashTableData *data;
+  bool dense; /** keys are stored at a fixed position derived from the key */
 };
 
 typedef struct BzlaIntHashTable BzlaIntHashTable;
@@ -38,6 +39,17 @@ typedef struct BzlaIntHashTable BzlaIntHashTable;
 /** Create new int hash table. */
 BzlaIntHashTable *bzla_hashint_table_new(BzlaMemMgr *mm);
 
+/**
+ * Create new dense int hash table.
+ *
+ * A dense table stores 'key' at a fixed position derived from its absolute
+ * value (and sign), i.e., lookups do not require probing. This is intended
+ * for tables indexed by node ids that cover most of the id range (e.g., the
+ * model during local search). If the table becomes too sparse when growing,
+ * it falls back to a regular hash table.
+ */
+BzlaIntHashTable *bzla_hashint_table_new_dense(BzlaMemMgr *mm);
+
 /** Free int hash table. */
 void bzla_hashint_table_delete(BzlaIntHashTable *t);
 
@@ -84,6 +96,9 @@ BzlaIntHashTable *bzla_hashint_table_clone(BzlaMemMgr *mm,
 /** Create new int32_t hash map. */
 BzlaIntHashTable *bzla_hashint_map_new(BzlaMemMgr *t);
 
+/** Create new dense int32_t hash map (see bzla_hashint_table_new_dense). */
+BzlaIntHashTable *bzla_hashint_map_new_dense(BzlaMemMgr *mm);
+
 /** Free int32_t hash map. */
 void bzla_hashint_map_delete(BzlaIntHashTable *t);
 
@@ -171,6 +171,8 @@ BZLA_DECLARE_STACK(BzlaInt, int32_t);
 
 BZLA_DECLARE_STACK(BzlaUInt, uint32_t);
 
+BZLA_DECLARE_STACK(BzlaUInt64, uint64_t);
+
 BZLA_DECLARE_STACK(BzlaChar, char);
 
 BZLA_DECLARE_STACK(BzlaCharPtr, char *);
@@ -11,6 +11,7 @@
 #ifndef BZLAUTIL_H_INCLUDED
 #define BZLAUTIL_H_INCLUDED
 
+#include <assert.h>
 #include <ctype.h>
 #include <stdbool.h>
 #include <stdint.h>
@@ -46,6 +47,75 @@ int32_t bzla_util_pow_2(int32_t x);
 
 int32_t bzla_util_next_power_of_2(int32_t x);
 
+/*------------------------------------------------------------------------*/
+/* Operations on bit-vectors of width bw <= 64 represented as uint64_t     */
+/* (all bits above bw are zero).                                           */
+/*------------------------------------------------------------------------*/
+
+static inline uint64_t
+bzla_util_uint64_mask(uint32_t bw)
+{
+  assert(bw > 0 && bw <= 64);
+  return bw == 64 ? UINT64_MAX : (((uint64_t) 1) << bw) - 1;
+}
+
+/* Number of trailing zeros of 'v', bw if 'v' is zero. */
+static inline uint32_t
+bzla_util_uint64_ctz(uint64_t v, uint32_t bw)
+{
+  assert(bw > 0 && bw <= 64);
+  return v ? (uint32_t) __builtin_ctzll(v) : bw;
+}
+
+/* Number of leading zeros of 'v' (of width bw), bw if 'v' is zero. */
+static inline uint32_t
+bzla_util_uint64_clz(uint64_t v, uint32_t bw)
+{
+  assert(bw > 0 && bw <= 64);
+  return v ? (uint32_t) __builtin_clzll(v) - (64 - bw) : bw;
+}
+
+/* Modular inverse of odd 'v' modulo 2^bw via Newton iteration. Every
+ * iteration doubles the number of correct bits, starting with 3 correct
+ * bits since v * v = 1 mod 8 for any odd v. */
+static inline uint64_t
+bzla_util_uint64_mod_inverse(uint64_t v, uint32_t bw)
+{
+  assert(v & 1);
+
+  uint64_t res;
+
+  res = v;
+  res *= 2 - v * res; /*  6 bits */
+  res *= 2 - v * res; /* 12 bits */
+  res *= 2 - v * res; /* 24 bits */
+  res *= 2 - v * res; /* 48 bits */
+  res *= 2 - v * res; /* 96 bits */
+  return res & bzla_util_uint64_mask(bw);
+}
+
+/* Scatter the low bits of 'v' into the positions of the set bits of 'mask'
+ * (from LSB to MSB), i.e., a portable version of the BMI2 pdep instruction. */
+static inline uint64_t
+bzla_util_uint64_pdep(uint64_t v, uint64_t mask)
+{
+  uint64_t res, bit;
+
+  for (res = 0, bit = 1; mask; mask &= mask - 1, bit <<= 1)
+  {
+    if (v & bit) res |= mask & -mask;
+  }
+  return res;
+}
+
+/* Next value of a counter scattered into the set bits of 'mask', i.e.,
+ * pdep(pext(v, mask) + 1, mask) for 'v' with no bits outside of 'mask'. */
+static inline uint64_t
+bzla_util_uint64_pdep_inc(uint64_t v, uint64_t mask)
+{
+  return ((v | ~mask) + 1) & mask;
+}
+
 /*------------------------------------------------------------------------*/
 
 uint32_t bzla_util_num_digits(uint32_t x);
@@ -0,0 +1,19 @@
+(set-logic QF_ABV)
+(set-option :incremental true)
+(declare-fun a () (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-fun i () (_ BitVec 8))
+(declare-fun j () (_ BitVec 8))
+(assert (= (select a i) (bvadd (select a j) #x01)))
+(check-sat)
+(assert (= (select (store a j #x05) i) #x07))
+(check-sat)
+(check-sat-assuming ((= (select a j) #x06)))
+(check-sat-assuming ((= (select a j) #x00)))
+(push 1)
+(assert (= (select a i) (select a j)))
+(check-sat)
+(pop 1)
+(check-sat)
+(assert (= i j))
+(check-sat)
+(exit)
@@ -0,0 +1,14 @@
+(set-logic QF_ABV)
+(set-info :status sat)
+(declare-fun a () (Array (_ BitVec 4) (_ BitVec 4)))
+(declare-fun b () (Array (_ BitVec 4) (_ BitVec 4)))
+(declare-fun c () (Array (_ BitVec 4) (_ BitVec 4)))
+(declare-fun i () (_ BitVec 4))
+(declare-fun v () (_ BitVec 4))
+(assert (not (= a b)))
+(assert (= (select a i) (select b i)))
+(assert (= c (store a i v)))
+(assert (not (= c a)))
+(assert (= (select c #x1) (select b #x1)))
+(check-sat)
+(exit)
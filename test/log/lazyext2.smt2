@@ -0,0 +1,11 @@
+(set-logic QF_ABV)
+(set-info :status unsat)
+(declare-fun a () (Array (_ BitVec 4) (_ BitVec 4)))
+(declare-fun b () (Array (_ BitVec 4) (_ BitVec 4)))
+(declare-fun c () (Array (_ BitVec 4) (_ BitVec 4)))
+(declare-fun i () (_ BitVec 4))
+(assert (not (= a b)))
+(assert (not (= b c)))
+(assert (= b (store a i (select a i))))
+(check-sat)
+(exit)
@@ -0,0 +1,26 @@
+(set-logic QF_BV)
+(set-option :incremental true)
+(declare-fun s () (_ BitVec 8))
+(declare-fun x0 () (_ BitVec 8))
+(declare-fun x1 () (_ BitVec 8))
+(declare-fun x2 () (_ BitVec 8))
+(declare-fun x3 () (_ BitVec 8))
+(assert (= ((_ extract 3 0) x0) #x2))
+(check-sat)
+(assert (bvugt s #x03))
+(assert (= x1 (bvadd x0 s)))
+(check-sat)
+(assert (= x2 (bvadd x1 s)))
+(assert (bvult x2 #x80))
+(check-sat)
+(assert (= x3 (bvmul x2 #x03)))
+(check-sat)
+(push 1)
+(assert (= ((_ extract 3 0) x3) #x6))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (bvugt x3 x2))
+(check-sat)
+(pop 1)
+(check-sat)
@@ -0,0 +1,17 @@
+(set-logic QF_ABV)
+(set-info :status sat)
+(declare-const a (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-const c (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-const d (_ BitVec 8))
+(declare-const j (_ BitVec 8))
+(declare-const x (_ BitVec 8))
+(define-fun s () (Array (_ BitVec 8) (_ BitVec 8)) (store c #x80 x))
+(define-fun b () (Array (_ BitVec 8) (_ BitVec 8)) (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store a (bvadd d #x01) (select s (bvadd d #x01))) (bvadd d #x02) (select s (bvadd d #x02))) (bvadd d #x03) (select s (bvadd d #x03))) (bvadd d #x04) (select s (bvadd d #x04))) (bvadd d #x05) (select s (bvadd d #x05))) (bvadd d #x06) (select s (bvadd d #x06))) (bvadd d #x07) (select s (bvadd d #x07))) (bvadd d #x08) (select s (bvadd d #x08))) (bvadd d #x09) (select s (bvadd d #x09))) (bvadd d #x0a) (select s (bvadd d #x0a))) (bvadd d #x0b) (select s (bvadd d #x0b))) (bvadd d #x0c) (select s (bvadd d #x0c))) (bvadd d #x0d) (select s (bvadd d #x0d))) (bvadd d #x0e) (select s (bvadd d #x0e))) (bvadd d #x0f) (select s (bvadd d #x0f))) (bvadd d #x10) (select s (bvadd d #x10))))
+(assert (bvult d #x78))
+(assert (bvult d j))
+(assert (bvule j (bvadd d #x10)))
+(assert (= j #x80))
+(assert (= (select b j) x))
+(assert (distinct (select a j) x))
+(check-sat)
+(exit)
@@ -0,0 +1,14 @@
+(set-logic QF_ABV)
+(set-info :status sat)
+(declare-const a (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-const x (_ BitVec 8))
+(declare-const y (_ BitVec 8))
+(declare-const z (_ BitVec 8))
+(declare-const j (_ BitVec 8))
+(define-fun b () (Array (_ BitVec 8) (_ BitVec 8)) (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store (store a #x00 x) #x01 x) #x02 x) #x03 x) #x04 x) #x05 x) #x06 x) #x07 x) #x08 x) #x09 x) #x0a x) #x0b x) #x0c x) #x0d x) #x0e x) #x0f x) #x20 y) #x21 y) #x22 y) #x23 y) #x24 y) #x25 y) #x26 y) #x27 y) #x28 y) #x29 y) #x2a y) #x2b y) #x2c y) #x2d y) #x2e y) #x2f y) #x40 z) #x41 z) #x42 z) #x43 z) #x44 z) #x45 z) #x46 z) #x47 z) #x48 z) #x49 z) #x4a z) #x4b z) #x4c z) #x4d z) #x4e z) #x4f z))
+(assert (distinct x y z))
+(assert (bvule #x64 j))
+(assert (= (select b j) x))
+(assert (= (select b (bvsub j #x50)) (select b (bvsub j #x20))))
+(check-sat)
+(exit)
@@ -0,0 +1,13 @@
+(set-logic QF_BV)
+(set-info :status sat)
+(declare-const x (_ BitVec 8))
+(declare-const y (_ BitVec 8))
+(declare-const z (_ BitVec 8))
+(assert (= ((_ extract 3 0) x) #b1010))
+(assert (= (bvand y #x0f) #x05))
+(assert (bvslt x y))
+(assert (bvslt y #x00))
+(assert (= (bvadd x z) (bvshl y #x01)))
+(assert (bvult z #x80))
+(check-sat)
+(exit)
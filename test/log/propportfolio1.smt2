@@ -0,0 +1,12 @@
+(set-logic QF_BV)
+(set-info :status sat)
+(declare-const x (_ BitVec 16))
+(declare-const y (_ BitVec 16))
+(declare-const z (_ BitVec 16))
+(assert (= (bvmul x y) #x1d4c))
+(assert (bvugt x #x0001))
+(assert (bvugt y #x0001))
+(assert (= (bvadd x z) (bvshl y #x0003)))
+(assert (bvult (bvand z #x00ff) #x0080))
+(check-sat)
+(exit)
@@ -0,0 +1,11 @@
+(set-logic QF_BV)
+(set-info :status sat)
+(declare-const x (_ BitVec 8))
+(declare-const y (_ BitVec 8))
+(declare-const z (_ BitVec 8))
+(assert (= (bvadd x y) #x5a))
+(assert (= (bvxor y z) #x3c))
+(assert (bvugt z #x10))
+(assert (= ((_ extract 0 0) x) #b1))
+(check-sat)
+(exit)
@@ -0,0 +1,134 @@
+(set-logic QF_ABV)
+(set-info :status unsat)
+(declare-const a (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-const i0 (_ BitVec 8))
+(declare-const v0 (_ BitVec 8))
+(declare-const i1 (_ BitVec 8))
+(declare-const v1 (_ BitVec 8))
+(declare-const i2 (_ BitVec 8))
+(declare-const v2 (_ BitVec 8))
+(declare-const i3 (_ BitVec 8))
+(declare-const v3 (_ BitVec 8))
+(declare-const i4 (_ BitVec 8))
+(declare-const v4 (_ BitVec 8))
+(declare-const i5 (_ BitVec 8))
+(declare-const v5 (_ BitVec 8))
+(declare-const i6 (_ BitVec 8))
+(declare-const v6 (_ BitVec 8))
+(declare-const i7 (_ BitVec 8))
+(declare-const v7 (_ BitVec 8))
+(declare-const i8 (_ BitVec 8))
+(declare-const v8 (_ BitVec 8))
+(declare-const i9 (_ BitVec 8))
+(declare-const v9 (_ BitVec 8))
+(declare-const i10 (_ BitVec 8))
+(declare-const v10 (_ BitVec 8))
+(declare-const i11 (_ BitVec 8))
+(declare-const v11 (_ BitVec 8))
+(declare-const i12 (_ BitVec 8))
+(declare-const v12 (_ BitVec 8))
+(declare-const i13 (_ BitVec 8))
+(declare-const v13 (_ BitVec 8))
+(declare-const i14 (_ BitVec 8))
+(declare-const v14 (_ BitVec 8))
+(declare-const i15 (_ BitVec 8))
+(declare-const v15 (_ BitVec 8))
+(declare-const i16 (_ BitVec 8))
+(declare-const v16 (_ BitVec 8))
+(declare-const i17 (_ BitVec 8))
+(declare-const v17 (_ BitVec 8))
+(declare-const i18 (_ BitVec 8))
+(declare-const v18 (_ BitVec 8))
+(declare-const i19 (_ BitVec 8))
+(declare-const v19 (_ BitVec 8))
+(declare-const i20 (_ BitVec 8))
+(declare-const v20 (_ BitVec 8))
+(declare-const i21 (_ BitVec 8))
+(declare-const v21 (_ BitVec 8))
+(declare-const i22 (_ BitVec 8))
+(declare-const v22 (_ BitVec 8))
+(declare-const i23 (_ BitVec 8))
+(declare-const v23 (_ BitVec 8))
+(declare-const i24 (_ BitVec 8))
+(declare-const v24 (_ BitVec 8))
+(declare-const i25 (_ BitVec 8))
+(declare-const v25 (_ BitVec 8))
+(declare-const i26 (_ BitVec 8))
+(declare-const v26 (_ BitVec 8))
+(declare-const i27 (_ BitVec 8))
+(declare-const v27 (_ BitVec 8))
+(declare-const i28 (_ BitVec 8))
+(declare-const v28 (_ BitVec 8))
+(declare-const i29 (_ BitVec 8))
+(declare-const v29 (_ BitVec 8))
+(assert (bvult i0 i1))
+(assert (bvult i1 i2))
+(assert (bvult i2 i3))
+(assert (bvult i3 i4))
+(assert (bvult i4 i5))
+(assert (bvult i5 i6))
+(assert (bvult i6 i7))
+(assert (bvult i7 i8))
+(assert (bvult i8 i9))
+(assert (bvult i9 i10))
+(assert (bvult i10 i11))
+(assert (bvult i11 i12))
+(assert (bvult i12 i13))
+(assert (bvult i13 i14))
+(assert (bvult i14 i15))
+(assert (bvult i15 i16))
+(assert (bvult i16 i17))
+(assert (bvult i17 i18))
+(assert (bvult i18 i19))
+(assert (bvult i19 i20))
+(assert (bvult i20 i21))
+(assert (bvult i21 i22))
+(assert (bvult i22 i23))
+(assert (bvult i23 i24))
+(assert (bvult i24 i25))
+(assert (bvult i25 i26))
+(assert (bvult i26 i27))
+(assert (bvult i27 i28))
+(assert (bvult i28 i29))
+(define-fun s0 () (Array (_ BitVec 8) (_ BitVec 8)) a)
+(define-fun s1 () (Array (_ BitVec 8) (_ BitVec 8)) (store s0 i0 v0))
+(define-fun s2 () (Array (_ BitVec 8) (_ BitVec 8)) (store s1 i1 v1))
+(define-fun s3 () (Array (_ BitVec 8) (_ BitVec 8)) (store s2 i2 v2))
+(define-fun s4 () (Array (_ BitVec 8) (_ BitVec 8)) (store s3 i3 v3))
+(define-fun s5 () (Array (_ BitVec 8) (_ BitVec 8)) (store s4 i4 v4))
+(define-fun s6 () (Array (_ BitVec 8) (_ BitVec 8)) (store s5 i5 v5))
+(define-fun s7 () (Array (_ BitVec 8) (_ BitVec 8)) (store s6 i6 v6))
+(define-fun s8 () (Array (_ BitVec 8) (_ BitVec 8)) (store s7 i7 v7))
+(define-fun s9 () (Array (_ BitVec 8) (_ BitVec 8)) (store s8 i8 v8))
+(define-fun s10 () (Array (_ BitVec 8) (_ BitVec 8)) (store s9 i9 v9))
+(define-fun s11 () (Array (_ BitVec 8) (_ BitVec 8)) (store s10 i10 v10))
+(define-fun s12 () (Array (_ BitVec 8) (_ BitVec 8)) (store s11 i11 v11))
+(define-fun s13 () (Array (_ BitVec 8) (_ BitVec 8)) (store s12 i12 v12))
+(define-fun s14 () (Array (_ BitVec 8) (_ BitVec 8)) (store s13 i13 v13))
+(define-fun s15 () (Array (_ BitVec 8) (_ BitVec 8)) (store s14 i14 v14))
+(define-fun s16 () (Array (_ BitVec 8) (_ BitVec 8)) (store s15 i15 v15))
+(define-fun s17 () (Array (_ BitVec 8) (_ BitVec 8)) (store s16 i16 v16))
+(define-fun s18 () (Array (_ BitVec 8) (_ BitVec 8)) (store s17 i17 v17))
+(define-fun s19 () (Array (_ BitVec 8) (_ BitVec 8)) (store s18 i18 v18))
+(define-fun s20 () (Array (_ BitVec 8) (_ BitVec 8)) (store s19 i19 v19))
+(define-fun s21 () (Array (_ BitVec 8) (_ BitVec 8)) (store s20 i20 v20))
+(define-fun s22 () (Array (_ BitVec 8) (_ BitVec 8)) (store s21 i21 v21))
+(define-fun s23 () (Array (_ BitVec 8) (_ BitVec 8)) (store s22 i22 v22))
+(define-fun s24 () (Array (_ BitVec 8) (_ BitVec 8)) (store s23 i23 v23))
+(define-fun s25 () (Array (_ BitVec 8) (_ BitVec 8)) (store s24 i24 v24))
+(define-fun s26 () (Array (_ BitVec 8) (_ BitVec 8)) (store s25 i25 v25))
+(define-fun s27 () (Array (_ BitVec 8) (_ BitVec 8)) (store s26 i26 v26))
+(define-fun s28 () (Array (_ BitVec 8) (_ BitVec 8)) (store s27 i27 v27))
+(define-fun s29 () (Array (_ BitVec 8) (_ BitVec 8)) (store s28 i28 v28))
+(define-fun s30 () (Array (_ BitVec 8) (_ BitVec 8)) (store s29 i29 v29))
+(declare-const j0 (_ BitVec 8))
+(assert (= (select s30 j0) (bvadd (select a j0) #b00000001)))
+(declare-const j1 (_ BitVec 8))
+(assert (= (select s30 j1) (bvadd (select a j1) #b00000001)))
+(declare-const j2 (_ BitVec 8))
+(assert (= (select s30 j2) (bvadd (select a j2) #b00000001)))
+(declare-const j3 (_ BitVec 8))
+(assert (= (select s30 j3) (bvadd (select a j3) #b00000001)))
+(assert (distinct (select s30 i0) v0))
+(check-sat)
+(exit)
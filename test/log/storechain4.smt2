@@ -0,0 +1,93 @@
+(set-logic QF_ABV)
+(set-info :status sat)
+(declare-const a (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-const v0 (_ BitVec 8))
+(declare-const v1 (_ BitVec 8))
+(declare-const v2 (_ BitVec 8))
+(declare-const v3 (_ BitVec 8))
+(declare-const v4 (_ BitVec 8))
+(declare-const v5 (_ BitVec 8))
+(declare-const v6 (_ BitVec 8))
+(declare-const v7 (_ BitVec 8))
+(declare-const v8 (_ BitVec 8))
+(declare-const v9 (_ BitVec 8))
+(declare-const v10 (_ BitVec 8))
+(declare-const v11 (_ BitVec 8))
+(declare-const v12 (_ BitVec 8))
+(declare-const v13 (_ BitVec 8))
+(declare-const v14 (_ BitVec 8))
+(declare-const v15 (_ BitVec 8))
+(declare-const v16 (_ BitVec 8))
+(declare-const v17 (_ BitVec 8))
+(declare-const v18 (_ BitVec 8))
+(declare-const v19 (_ BitVec 8))
+(declare-const v20 (_ BitVec 8))
+(declare-const v21 (_ BitVec 8))
+(declare-const v22 (_ BitVec 8))
+(declare-const v23 (_ BitVec 8))
+(declare-const v24 (_ BitVec 8))
+(declare-const v25 (_ BitVec 8))
+(declare-const v26 (_ BitVec 8))
+(declare-const v27 (_ BitVec 8))
+(declare-const v28 (_ BitVec 8))
+(declare-const v29 (_ BitVec 8))
+(declare-const v30 (_ BitVec 8))
+(declare-const v31 (_ BitVec 8))
+(declare-const v32 (_ BitVec 8))
+(declare-const v33 (_ BitVec 8))
+(declare-const v34 (_ BitVec 8))
+(declare-const v35 (_ BitVec 8))
+(declare-const v36 (_ BitVec 8))
+(declare-const v37 (_ BitVec 8))
+(declare-const v38 (_ BitVec 8))
+(declare-const v39 (_ BitVec 8))
+(declare-const j (_ BitVec 8))
+(define-fun s0 () (Array (_ BitVec 8) (_ BitVec 8)) a)
+(define-fun s1 () (Array (_ BitVec 8) (_ BitVec 8)) (store s0 #x0b v0))
+(define-fun s2 () (Array (_ BitVec 8) (_ BitVec 8)) (store s1 #x30 v1))
+(define-fun s3 () (Array (_ BitVec 8) (_ BitVec 8)) (store s2 #x55 v2))
+(define-fun s4 () (Array (_ BitVec 8) (_ BitVec 8)) (store s3 #x7a v3))
+(define-fun s5 () (Array (_ BitVec 8) (_ BitVec 8)) (store s4 #x9f v4))
+(define-fun s6 () (Array (_ BitVec 8) (_ BitVec 8)) (store s5 #xc4 v5))
+(define-fun s7 () (Array (_ BitVec 8) (_ BitVec 8)) (store s6 #xe9 v6))
+(define-fun s8 () (Array (_ BitVec 8) (_ BitVec 8)) (store s7 #x0e v7))
+(define-fun s9 () (Array (_ BitVec 8) (_ BitVec 8)) (store s8 #x33 v8))
+(define-fun s10 () (Array (_ BitVec 8) (_ BitVec 8)) (store s9 #x58 v9))
+(define-fun s11 () (Array (_ BitVec 8) (_ BitVec 8)) (store s10 #x7d v10))
+(define-fun s12 () (Array (_ BitVec 8) (_ BitVec 8)) (store s11 #xa2 v11))
+(define-fun s13 () (Array (_ BitVec 8) (_ BitVec 8)) (store s12 #xc7 v12))
+(define-fun s14 () (Array (_ BitVec 8) (_ BitVec 8)) (store s13 #xec v13))
+(define-fun s15 () (Array (_ BitVec 8) (_ BitVec 8)) (store s14 #x11 v14))
+(define-fun s16 () (Array (_ BitVec 8) (_ BitVec 8)) (store s15 #x36 v15))
+(define-fun s17 () (Array (_ BitVec 8) (_ BitVec 8)) (store s16 #x5b v16))
+(define-fun s18 () (Array (_ BitVec 8) (_ BitVec 8)) (store s17 #x80 v17))
+(define-fun s19 () (Array (_ BitVec 8) (_ BitVec 8)) (store s18 #xa5 v18))
+(define-fun s20 () (Array (_ BitVec 8) (_ BitVec 8)) (store s19 #xca v19))
+(define-fun s21 () (Array (_ BitVec 8) (_ BitVec 8)) (store s20 #xef v20))
+(define-fun s22 () (Array (_ BitVec 8) (_ BitVec 8)) (store s21 #x14 v21))
+(define-fun s23 () (Array (_ BitVec 8) (_ BitVec 8)) (store s22 #x39 v22))
+(define-fun s24 () (Array (_ BitVec 8) (_ BitVec 8)) (store s23 #x5e v23))
+(define-fun s25 () (Array (_ BitVec 8) (_ BitVec 8)) (store s24 #x83 v24))
+(define-fun s26 () (Array (_ BitVec 8) (_ BitVec 8)) (store s25 #xa8 v25))
+(define-fun s27 () (Array (_ BitVec 8) (_ BitVec 8)) (store s26 #xcd v26))
+(define-fun s28 () (Array (_ BitVec 8) (_ BitVec 8)) (store s27 #xf2 v27))
+(define-fun s29 () (Array (_ BitVec 8) (_ BitVec 8)) (store s28 #x17 v28))
+(define-fun s30 () (Array (_ BitVec 8) (_ BitVec 8)) (store s29 #x3c v29))
+(define-fun s31 () (Array (_ BitVec 8) (_ BitVec 8)) (store s30 #x61 v30))
+(define-fun s32 () (Array (_ BitVec 8) (_ BitVec 8)) (store s31 #x86 v31))
+(define-fun s33 () (Array (_ BitVec 8) (_ BitVec 8)) (store s32 #xab v32))
+(define-fun s34 () (Array (_ BitVec 8) (_ BitVec 8)) (store s33 #xd0 v33))
+(define-fun s35 () (Array (_ BitVec 8) (_ BitVec 8)) (store s34 #xf5 v34))
+(define-fun s36 () (Array (_ BitVec 8) (_ BitVec 8)) (store s35 #x1a v35))
+(define-fun s37 () (Array (_ BitVec 8) (_ BitVec 8)) (store s36 #x3f v36))
+(define-fun s38 () (Array (_ BitVec 8) (_ BitVec 8)) (store s37 #x64 v37))
+(define-fun s39 () (Array (_ BitVec 8) (_ BitVec 8)) (store s38 #x89 v38))
+(define-fun s40 () (Array (_ BitVec 8) (_ BitVec 8)) (store s39 #xae v39))
+(define-fun t () (Array (_ BitVec 8) (_ BitVec 8)) (store (store s40 #x0e v3) #x58 v5))
+(assert (= j #x0e))
+(assert (distinct v3 v7))
+(assert (= (select t #xef) (bvadd (select t #x61) #x01)))
+(assert (= (select t #x03) (select a #x03)))
+(assert (= (select t j) v3))
+(check-sat)
+(exit)
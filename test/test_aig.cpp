@@ -9,8 +9,13 @@
  */
 #include "test.h"
 
+#include <cstdio>
+
 extern "C" {
 #include "bzlaaig.h"
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "bzlasat.h"
 #include "dumper/bzladumpaig.h"
 }
 
@@ -145,3 +150,127 @@ TEST_F(TestAig, aig_to_sat)
   bzla_aig_release(amgr, and3);
   bzla_aig_mgr_delete(amgr);
 }
+
+TEST_F(TestAig, export_import_clauses)
+{
+  const char *path = "export_import_clauses.out";
+  Bzla *bzla[2];
+  int32_t res[2];
+
+  for (uint32_t i = 0; i < 2; i++)
+  {
+    bzla[i] = bzla_new();
+    bzla_opt_set_str(bzla[i],
+                     i == 0 ? BZLA_OPT_SAT_ENGINE_EXPORT_CLAUSES
+                            : BZLA_OPT_SAT_ENGINE_IMPORT_CLAUSES,
+                     path);
+
+    BzlaSortId sort = bzla_sort_bv(bzla[i], 16);
+    /* bit-blast an unrelated constant first on import to change the
+     * creation order of the AIG variables of x and y */
+    BzlaNode *z = i == 1 ? bzla_exp_var(bzla[i], sort, "z") : 0;
+    BzlaNode *x = bzla_exp_var(bzla[i], sort, "x");
+    BzlaNode *y = bzla_exp_var(bzla[i], sort, "y");
+    BzlaNode *one  = bzla_exp_bv_one(bzla[i], sort);
+    BzlaNode *max  = bzla_exp_bv_unsigned(bzla[i], 256, sort);
+    BzlaNode *prod = bzla_exp_bv_unsigned(bzla[i], 251 * 241, sort);
+    BzlaNode *mul  = bzla_exp_bv_mul(bzla[i], x, y);
+    BzlaNode *eq   = bzla_exp_eq(bzla[i], mul, prod);
+    BzlaNode *gtx  = bzla_exp_bv_ugt(bzla[i], x, one);
+    BzlaNode *gty  = bzla_exp_bv_ugt(bzla[i], y, one);
+    BzlaNode *ltx  = bzla_exp_bv_ult(bzla[i], x, max);
+    BzlaNode *lty  = bzla_exp_bv_ult(bzla[i], y, max);
+    BzlaNode *gtz  = z ? bzla_exp_bv_ugt(bzla[i], z, one) : 0;
+
+    if (gtz) bzla_assert_exp(bzla[i], gtz);
+    bzla_assert_exp(bzla[i], eq);
+    bzla_assert_exp(bzla[i], gtx);
+    bzla_assert_exp(bzla[i], gty);
+    bzla_assert_exp(bzla[i], ltx);
+    bzla_assert_exp(bzla[i], lty);
+    res[i] = bzla_check_sat(bzla[i], -1, -1);
+
+    if (gtz) bzla_node_release(bzla[i], gtz);
+    bzla_node_release(bzla[i], lty);
+    bzla_node_release(bzla[i], ltx);
+    bzla_node_release(bzla[i], gty);
+    bzla_node_release(bzla[i], gtx);
+    bzla_node_release(bzla[i], eq);
+    bzla_node_release(bzla[i], mul);
+    bzla_node_release(bzla[i], prod);
+    bzla_node_release(bzla[i], max);
+    bzla_node_release(bzla[i], one);
+    bzla_node_release(bzla[i], y);
+    bzla_node_release(bzla[i], x);
+    if (z) bzla_node_release(bzla[i], z);
+    bzla_sort_release(bzla[i], sort);
+
+    if (!bzla_sat_mgr_has_learn_support(bzla_get_sat_mgr(bzla[i]))) break;
+  }
+
+  if (bzla_sat_mgr_has_learn_support(bzla_get_sat_mgr(bzla[0])))
+  {
+    ASSERT_EQ(res[0], BZLA_RESULT_SAT);
+    ASSERT_EQ(res[1], res[0]);
+    ASSERT_GT(bzla_get_aig_mgr(bzla[0])->num_exported_clauses, 0u);
+    ASSERT_GT(bzla_get_aig_mgr(bzla[1])->num_imported_clauses, 0u);
+    bzla_delete(bzla[1]);
+  }
+  bzla_delete(bzla[0]);
+  std::remove(path);
+}
+
+TEST_F(TestAig, update_frozen)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE, 1);
+  BzlaAIGMgr *amgr = bzla_aig_mgr_new(d_bzla);
+  bzla_sat_enable_solver(amgr->smgr);
+  if (bzla_sat_mgr_has_freeze_support(amgr->smgr))
+  {
+    bzla_sat_init(amgr->smgr);
+
+    bzla_aig_mgr_enable_freeze(amgr);
+
+    BzlaAIG *var1 = bzla_aig_var(amgr);
+    BzlaAIG *var2 = bzla_aig_var(amgr);
+    BzlaAIG *_and = bzla_aig_and(amgr, var1, var2);
+    BzlaAIG *inv  = BZLA_INVERT_AIG(_and);
+
+    /* referenced twice before it is encoded */
+    bzla_aig_mgr_ref_frozen(amgr, &inv, 1);
+    bzla_aig_mgr_ref_frozen(amgr, &_and, 1);
+    bzla_aig_to_sat(amgr, _and);
+    bzla_aig_mgr_update_frozen(amgr);
+    ASSERT_TRUE(_and->frozen);
+    ASSERT_FALSE(var1->frozen);
+    ASSERT_EQ(amgr->num_frozen_cnf_vars, 1u);
+    ASSERT_TRUE(BZLA_EMPTY_STACK(amgr->freeze.pending));
+
+    /* still referenced once */
+    bzla_aig_mgr_unref_frozen(amgr, &_and, 1);
+    bzla_aig_mgr_update_frozen(amgr);
+    ASSERT_TRUE(_and->frozen);
+    ASSERT_EQ(amgr->num_melted_cnf_vars, 0u);
+
+    /* only var1 may be referenced in the future, _and is melted */
+    bzla_aig_mgr_ref_frozen(amgr, &var1, 1);
+    bzla_aig_mgr_unref_frozen(amgr, &inv, 1);
+    bzla_aig_mgr_update_frozen(amgr);
+    ASSERT_FALSE(_and->frozen);
+    ASSERT_TRUE(var1->frozen);
+    ASSERT_EQ(amgr->num_frozen_cnf_vars, 2u);
+    ASSERT_EQ(amgr->num_melted_cnf_vars, 1u);
+    ASSERT_EQ(amgr->freeze.refs->count, 1u);
+
+    /* nothing changed since the last update */
+    bzla_aig_mgr_update_frozen(amgr);
+    ASSERT_EQ(amgr->num_frozen_cnf_vars, 2u);
+    ASSERT_EQ(amgr->num_melted_cnf_vars, 1u);
+
+    bzla_aig_mgr_unref_frozen(amgr, &var1, 1);
+    bzla_aig_release(amgr, var1);
+    bzla_aig_release(amgr, var2);
+    bzla_aig_release(amgr, _and);
+  }
+  bzla_aig_mgr_delete(amgr);
+}
@@ -0,0 +1,162 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+#include <vector>
+
+#include "test.h"
+
+extern "C" {
+#include "aigprop.h"
+#include "bzlaaig.h"
+#include "bzlacore.h"
+}
+
+class TestAigProp : public TestBzla
+{
+ protected:
+  void SetUp() override
+  {
+    TestBzla::SetUp();
+    d_amgr = bzla_aig_mgr_new(d_bzla);
+    d_a    = bzla_aig_var(d_amgr);
+    d_b    = bzla_aig_var(d_amgr);
+    d_c    = bzla_aig_var(d_amgr);
+    d_and  = bzla_aig_and(d_amgr, d_a, d_b);
+  }
+
+  void TearDown() override
+  {
+    if (d_aprop) bzla_aigprop_delete_aigprop(d_aprop);
+    bzla_aig_release(d_amgr, d_and);
+    bzla_aig_release(d_amgr, d_c);
+    bzla_aig_release(d_amgr, d_b);
+    bzla_aig_release(d_amgr, d_a);
+    bzla_aig_mgr_delete(d_amgr);
+    TestBzla::TearDown();
+  }
+
+  void new_aigprop(bool use_sim)
+  {
+    d_aprop = bzla_aigprop_new_aigprop(d_amgr, 0, 0, 0, 0, use_sim, 1, 0);
+  }
+
+  int32_t sat(std::vector<BzlaAIG *> roots)
+  {
+    int32_t res;
+    BzlaIntHashTable *r = bzla_hashint_table_new(d_bzla->mm);
+    for (BzlaAIG *root : roots)
+    {
+      if (!bzla_hashint_table_contains(r, bzla_aig_get_id(root)))
+      {
+        bzla_hashint_table_add(r, bzla_aig_get_id(root));
+      }
+    }
+    res = bzla_aigprop_sat(d_aprop, r);
+    bzla_hashint_table_delete(r);
+    return res;
+  }
+
+  BzlaAIGMgr *d_amgr   = nullptr;
+  BzlaAIGProp *d_aprop = nullptr;
+  BzlaAIG *d_a         = nullptr;
+  BzlaAIG *d_b         = nullptr;
+  BzlaAIG *d_c         = nullptr;
+  BzlaAIG *d_and       = nullptr;
+};
+
+TEST_F(TestAigProp, model)
+{
+  BzlaAIG *d;
+
+  new_aigprop(false);
+
+  bzla_aigprop_init_model(d_aprop);
+  ASSERT_FALSE(bzla_aigprop_has_assignment_aig(d_aprop, d_a));
+  ASSERT_FALSE(bzla_aigprop_has_assignment_aig(d_aprop, d_and));
+  ASSERT_FALSE(
+      bzla_aigprop_has_assignment_aig(d_aprop, BZLA_INVERT_AIG(d_and)));
+  ASSERT_TRUE(bzla_aigprop_has_assignment_aig(d_aprop, BZLA_AIG_TRUE));
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, BZLA_AIG_TRUE), 1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, BZLA_AIG_FALSE), -1);
+
+  /* AIGs created after the model was initialized are not covered */
+  d = bzla_aig_var(d_amgr);
+  ASSERT_FALSE(bzla_aigprop_has_assignment_aig(d_aprop, d));
+  bzla_aig_release(d_amgr, d);
+
+  bzla_aigprop_delete_model(d_aprop);
+  ASSERT_EQ(d_aprop->model, nullptr);
+  ASSERT_EQ(d_aprop->assigned, nullptr);
+  ASSERT_EQ(d_aprop->size, 0u);
+  ASSERT_FALSE(bzla_aigprop_has_assignment_aig(d_aprop, d_a));
+
+  ASSERT_EQ(sat({d_and}), BZLA_AIGPROP_SAT);
+  ASSERT_TRUE(bzla_aigprop_has_assignment_aig(d_aprop, d_a));
+  ASSERT_TRUE(bzla_aigprop_has_assignment_aig(d_aprop, d_b));
+  ASSERT_TRUE(bzla_aigprop_has_assignment_aig(d_aprop, d_and));
+  /* not in the cone of the roots */
+  ASSERT_FALSE(bzla_aigprop_has_assignment_aig(d_aprop, d_c));
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_a), 1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, BZLA_INVERT_AIG(d_a)),
+            -1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_b), 1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_and), 1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, BZLA_INVERT_AIG(d_and)),
+            -1);
+}
+
+TEST_F(TestAigProp, generate_model_all_false)
+{
+  new_aigprop(false);
+
+  /* the initial all-false assignment satisfies all roots */
+  ASSERT_EQ(sat({BZLA_INVERT_AIG(d_and), BZLA_INVERT_AIG(d_c)}),
+            BZLA_AIGPROP_SAT);
+  ASSERT_EQ(d_aprop->stats.moves, 0u);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_a), -1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_b), -1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_c), -1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_and), -1);
+  bzla_aigprop_delete_model(d_aprop);
+
+  /* without simulation, inputs start at false and need to be moved */
+  ASSERT_EQ(sat({d_a, d_b}), BZLA_AIGPROP_SAT);
+  ASSERT_GT(d_aprop->stats.moves, 0u);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_a), 1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_b), 1);
+}
+
+TEST_F(TestAigProp, generate_model_sim)
+{
+  new_aigprop(true);
+
+  /* lane 0 (all-false) is preferred on ties */
+  ASSERT_EQ(sat({BZLA_INVERT_AIG(d_and), BZLA_INVERT_AIG(d_c)}),
+            BZLA_AIGPROP_SAT);
+  ASSERT_EQ(d_aprop->stats.moves, 0u);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_a), -1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_b), -1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_c), -1);
+  bzla_aigprop_delete_model(d_aprop);
+
+  /* one of the 63 random lanes satisfies both roots (with probability
+   * 1 - (3/4)^63), no moves are required */
+  ASSERT_EQ(sat({d_a, d_b}), BZLA_AIGPROP_SAT);
+  ASSERT_EQ(d_aprop->stats.moves, 0u);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_a), 1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_b), 1);
+  bzla_aigprop_delete_model(d_aprop);
+
+  /* simulated values of AND gates are consistent with their inputs */
+  ASSERT_EQ(sat({d_and, BZLA_INVERT_AIG(d_c)}), BZLA_AIGPROP_SAT);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_a), 1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_b), 1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_and), 1);
+  ASSERT_EQ(bzla_aigprop_get_assignment_aig(d_aprop, d_c), -1);
+}
@@ -2825,6 +2825,37 @@ TEST_F(TestApi, get_bv_value)
   ASSERT_TRUE(!strcmp("1", bitwuzla_get_bv_value(d_bzla, d_bv_one1)));
 }
 
+TEST_F(TestApi, get_bv_value_compact)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_SAT_ENGINE_COMPACT, 1);
+  const BitwuzlaTerm *x   = bitwuzla_mk_const(d_bzla, d_bv_sort8, "x");
+  const BitwuzlaTerm *y   = bitwuzla_mk_const(d_bzla, d_bv_sort8, "y");
+  const BitwuzlaTerm *one = bitwuzla_mk_bv_one(d_bzla, d_bv_sort8);
+  const BitwuzlaTerm *mul =
+      bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_MUL, x, y);
+  const BitwuzlaTerm *add =
+      bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_ADD, x, y);
+  const BitwuzlaTerm *val =
+      bitwuzla_mk_bv_value(d_bzla, d_bv_sort8, "35", BITWUZLA_BV_BASE_DEC);
+  bitwuzla_assert(d_bzla,
+                  bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_EQUAL, mul, val));
+  bitwuzla_assert(d_bzla,
+                  bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_UGT, x, one));
+  bitwuzla_assert(d_bzla,
+                  bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_UGT, y, one));
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+
+  uint32_t vx = std::stoul(bitwuzla_get_bv_value(d_bzla, x), nullptr, 2);
+  uint32_t vy = std::stoul(bitwuzla_get_bv_value(d_bzla, y), nullptr, 2);
+  ASSERT_GT(vx, 1u);
+  ASSERT_GT(vy, 1u);
+  ASSERT_EQ((vx * vy) % 256, 35u);
+  ASSERT_EQ(std::string(bitwuzla_get_bv_value(d_bzla, mul)), "00100011");
+  ASSERT_EQ(std::stoul(bitwuzla_get_bv_value(d_bzla, add), nullptr, 2),
+            (vx + vy) % 256);
+}
+
 TEST_F(TestApi, get_rm_value)
 {
   ASSERT_DEATH(bitwuzla_get_rm_value(d_bzla, d_bv_one1),
@@ -494,3 +494,49 @@ TEST_F(TestBvDomainGen, has_next_rand_signed)
 }
 
 TEST_F(TestBvDomainGen, next_rand_signed) { test_next_signed(true); }
+
+TEST_F(TestBvDomainGen, next_wide)
+{
+  for (uint32_t bw : {63, 64, 65, 72})
+  {
+    BzlaBvDomainGenerator gen;
+    std::vector<std::string> expected;
+    std::string str_d(bw, '0');
+    /* unconstrained MSB and LSB, bit 2 fixed to 1 */
+    str_d[0]      = 'x';
+    str_d[bw - 1] = 'x';
+    str_d[bw - 3] = '1';
+    for (const char *msb : {"0", "1"})
+    {
+      for (const char *lsb : {"0", "1"})
+      {
+        std::string v = msb + std::string(bw - 4, '0') + "10" + lsb;
+        expected.push_back(v);
+      }
+    }
+
+    BzlaBvDomain *d = bzla_bvdomain_new_from_char(d_mm, str_d.c_str());
+    bzla_bvdomain_gen_init(d_mm, 0, &gen, d);
+    for (const std::string &v : expected)
+    {
+      ASSERT_TRUE(bzla_bvdomain_gen_has_next(&gen));
+      char *as_str = bzla_bv_to_char(d_mm, bzla_bvdomain_gen_next(&gen));
+      ASSERT_EQ(v, as_str);
+      bzla_mem_freestr(d_mm, as_str);
+    }
+    ASSERT_FALSE(bzla_bvdomain_gen_has_next(&gen));
+    bzla_bvdomain_gen_delete(&gen);
+
+    bzla_bvdomain_gen_init(d_mm, d_rng, &gen, d);
+    for (uint32_t i = 0; i < 16; i++)
+    {
+      ASSERT_TRUE(bzla_bvdomain_gen_has_next(&gen));
+      char *as_str = bzla_bv_to_char(d_mm, bzla_bvdomain_gen_random(&gen));
+      ASSERT_NE(std::find(expected.begin(), expected.end(), as_str),
+                expected.end());
+      bzla_mem_freestr(d_mm, as_str);
+    }
+    bzla_bvdomain_gen_delete(&gen);
+    bzla_bvdomain_free(d_mm, d);
+  }
+}
@@ -3255,6 +3255,65 @@ class TestBvProp : public TestBvDomainCommon
     free_consts(1, num_consts_z, consts_z);
   }
 
+  void test_slt(uint32_t bw)
+  {
+    bool res;
+    uint32_t num_consts, num_consts_z;
+    char **consts, **consts_z;
+    BzlaBitVector *tmp;
+    BzlaBvDomain *d_x, *d_y, *d_z;
+    BzlaBvDomain *res_x, *res_y, *res_z;
+
+    num_consts   = generate_consts(bw, &consts);
+    num_consts_z = generate_consts(1, &consts_z);
+
+    for (uint32_t i = 0; i < num_consts_z; i++)
+    {
+      d_z = bzla_bvdomain_new_from_char(d_mm, consts_z[i]);
+      for (uint32_t j = 0; j < num_consts; j++)
+      {
+        d_x = bzla_bvdomain_new_from_char(d_mm, consts[j]);
+        for (uint32_t k = 0; k < num_consts; k++)
+        {
+          d_y = bzla_bvdomain_new_from_char(d_mm, consts[k]);
+
+          res = bzla_bvprop_slt(d_mm, d_x, d_y, d_z, &res_x, &res_y, &res_z);
+          check_sat(d_x,
+                    d_y,
+                    d_z,
+                    0,
+                    res_x,
+                    res_y,
+                    res_z,
+                    0,
+                    2,
+                    false,
+                    BITWUZLA_KIND_BV_SLT,
+                    0,
+                    0,
+                    res);
+
+          if (bzla_bvdomain_is_fixed(d_mm, d_x)
+              && bzla_bvdomain_is_fixed(d_mm, d_y)
+              && is_xxx_domain(d_mm, d_z))
+          {
+            ASSERT_TRUE(res);
+            ASSERT_TRUE(bzla_bvdomain_is_fixed(d_mm, res_z));
+            tmp = bzla_bv_slt(d_mm, d_x->lo, d_y->lo);
+            ASSERT_FALSE(bzla_bv_compare(tmp, res_z->lo));
+            bzla_bv_free(d_mm, tmp);
+          }
+          bzla_bvdomain_free(d_mm, d_y);
+          TEST_BVPROP_RELEASE_RES_XYZ;
+        }
+        bzla_bvdomain_free(d_mm, d_x);
+      }
+      bzla_bvdomain_free(d_mm, d_z);
+    }
+    free_consts(bw, num_consts, consts);
+    free_consts(1, num_consts_z, consts_z);
+  }
+
   Bzla *d_bzla           = nullptr;
   BzlaAIGVecMgr *d_avmgr = nullptr;
 
@@ -3423,6 +3482,13 @@ TEST_F(TestBvProp, ult)
   test_ult(3);
 }
 
+TEST_F(TestBvProp, slt)
+{
+  test_slt(1);
+  test_slt(2);
+  test_slt(3);
+}
+
 TEST_F(TestBvProp, udiv)
 {
   test_udiv(1);
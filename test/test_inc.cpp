@@ -13,7 +13,10 @@
 #include "test.h"
 
 extern "C" {
+#include "bzlacore.h"
+#include "bzlaexp.h"
 #include "bzlaopt.h"
+#include "bzlaslvfun.h"
 }
 
 class TestInc : public TestBitwuzla
@@ -228,3 +231,56 @@ TEST_F(TestInc, lemmas_on_demand1)
   sat_result = bitwuzla_check_sat(d_bzla);
   ASSERT_EQ(sat_result, BITWUZLA_SAT);
 }
+
+class TestIncLemmas : public TestBzla
+{
+};
+
+TEST_F(TestIncLemmas, lemmas_after_pop)
+{
+  uint32_t lod_refinements;
+  BzlaSortId s, as;
+  BzlaNode *array, *index1, *index2, *read1, *read2, *eq, *ne;
+  BzlaFunSolver *slv;
+
+  bzla_opt_set(d_bzla, BZLA_OPT_INCREMENTAL, 1);
+  bzla_opt_set(d_bzla, BZLA_OPT_RW_LEVEL, 0);
+  s      = bzla_sort_bool(d_bzla);
+  as     = bzla_sort_array(d_bzla, s, s);
+  array  = bzla_exp_array(d_bzla, as, "array1");
+  index1 = bzla_exp_var(d_bzla, s, "index1");
+  index2 = bzla_exp_var(d_bzla, s, "index2");
+  read1  = bzla_exp_read(d_bzla, array, index1);
+  read2  = bzla_exp_read(d_bzla, array, index2);
+  eq     = bzla_exp_eq(d_bzla, index1, index2);
+  ne     = bzla_exp_ne(d_bzla, read1, read2);
+
+  /* assertions at context level > 0 are assumptions */
+  bzla_assume_exp(d_bzla, eq);
+  bzla_assume_exp(d_bzla, ne);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNSAT);
+  slv             = BZLA_FUN_SOLVER(d_bzla);
+  lod_refinements = slv->stats.lod_refinements;
+  ASSERT_GT(lod_refinements, 0u);
+
+  /* pop */
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+
+  /* the lemma is still active, it is neither re-derived nor re-assumed */
+  bzla_assume_exp(d_bzla, eq);
+  bzla_assume_exp(d_bzla, ne);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNSAT);
+  ASSERT_EQ(BZLA_FUN_SOLVER(d_bzla), slv);
+  ASSERT_EQ(slv->stats.lod_refinements, lod_refinements);
+  ASSERT_EQ(slv->stats.lemmas_reactivated, 0u);
+
+  bzla_node_release(d_bzla, ne);
+  bzla_node_release(d_bzla, eq);
+  bzla_node_release(d_bzla, read2);
+  bzla_node_release(d_bzla, read1);
+  bzla_node_release(d_bzla, index2);
+  bzla_node_release(d_bzla, index1);
+  bzla_node_release(d_bzla, array);
+  bzla_sort_release(d_bzla, as);
+  bzla_sort_release(d_bzla, s);
+}
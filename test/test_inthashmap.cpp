@@ -96,3 +96,74 @@ TEST_F(TestIntHashMap, add)
     ASSERT_FALSE(bzla_hashint_map_contains(d_htable, items[i]));
   }
 }
+
+TEST_F(TestIntHashMap, add_dense)
+{
+  int32_t i;
+  BzlaHashTableData d;
+  BzlaIntHashTable *ht, *clone;
+
+  ht = bzla_hashint_map_new_dense(d_mm);
+  ASSERT_TRUE(ht->dense);
+  ASSERT_EQ(ht->hop_info, nullptr);
+
+  for (i = 1; i <= 1000; i++)
+  {
+    bzla_hashint_map_add(ht, i)->as_int = 2 * i;
+    if (i % 3 == 0) bzla_hashint_map_add(ht, -i)->as_int = -2 * i;
+  }
+  ASSERT_TRUE(ht->dense);
+  ASSERT_EQ(ht->count, 1333u);
+
+  ASSERT_EQ(ht->hop_info, nullptr);
+
+  clone = bzla_hashint_map_clone(d_mm, ht, 0, 0);
+  ASSERT_TRUE(clone->dense);
+  ASSERT_EQ(clone->hop_info, nullptr);
+  ASSERT_EQ(clone->count, ht->count);
+
+  for (i = 1; i <= 1000; i++)
+  {
+    ASSERT_EQ(bzla_hashint_map_get(ht, i)->as_int, 2 * i);
+    ASSERT_EQ(bzla_hashint_map_get(clone, i)->as_int, 2 * i);
+    if (i % 3 == 0)
+      ASSERT_EQ(bzla_hashint_map_get(ht, -i)->as_int, -2 * i);
+    else
+      ASSERT_FALSE(bzla_hashint_map_contains(ht, -i));
+  }
+  ASSERT_FALSE(bzla_hashint_map_contains(ht, 1001));
+  ASSERT_FALSE(bzla_hashint_map_contains(ht, -1001));
+
+  for (i = 1; i <= 1000; i += 2)
+  {
+    bzla_hashint_map_remove(ht, i, &d);
+    ASSERT_EQ(d.as_int, 2 * i);
+    ASSERT_FALSE(bzla_hashint_map_contains(ht, i));
+    ASSERT_TRUE(bzla_hashint_map_contains(clone, i));
+  }
+  ASSERT_EQ(ht->count, 833u);
+
+  bzla_hashint_map_delete(clone);
+  bzla_hashint_map_delete(ht);
+}
+
+TEST_F(TestIntHashMap, dense_fallback)
+{
+  int32_t i;
+  BzlaIntHashTable *ht;
+  int32_t items[] = {123,   -1,     17,      5,      32,      64,
+                     -1023, 101231, 12840918, -189203, 19824192, 0};
+
+  ht = bzla_hashint_map_new_dense(d_mm);
+  for (i = 0; items[i] != 0; i++)
+    bzla_hashint_map_add(ht, items[i])->as_int = items[i];
+
+  /* too sparse for a dense table */
+  ASSERT_FALSE(ht->dense);
+  ASSERT_NE(ht->hop_info, nullptr);
+  ASSERT_EQ(ht->count, 11u);
+  for (i = 0; items[i] != 0; i++)
+    ASSERT_EQ(bzla_hashint_map_get(ht, items[i])->as_int, items[i]);
+
+  bzla_hashint_map_delete(ht);
+}
@@ -186,3 +186,23 @@ TEST_F(TestModelGenSMT2, modelgensmt227)
 {
   run_modelgen_smt2_test("modelgensmt227", ".smt2", 3);
 }
+
+/* reads skip functions on store chains via --fun-weak-eq-paths */
+
+TEST_F(TestModelGenSMT2, storechain1_weak_eq_paths)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_FUN_WEAK_EQ_PATHS, 1);
+  run_modelgen_smt2_test("storechain1", ".smt2", 3);
+}
+
+TEST_F(TestModelGenSMT2, memsetchain2_weak_eq_paths)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_FUN_WEAK_EQ_PATHS, 1);
+  run_modelgen_smt2_test("memsetchain2", ".smt2", 3);
+}
+
+TEST_F(TestModelGenSMT2, memcpychain2_weak_eq_paths)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_FUN_WEAK_EQ_PATHS, 1);
+  run_modelgen_smt2_test("memcpychain2", ".smt2", 3);
+}
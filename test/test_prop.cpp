@@ -15,6 +15,7 @@ extern "C" {
 #include "bzlacore.h"
 #include "bzlaexp.h"
 #include "bzlainvutils.h"
+#include "bzlalsutils.h"
 #include "bzlamodel.h"
 #include "bzlanode.h"
 #include "bzlaproputils.h"
@@ -1295,6 +1296,136 @@ TEST_F(TestPropConst, complete_slice_const)
   prop_complete_slice(bzla_proputils_inv_slice_const);
 }
 
+/* -------------------------------------------------------------------------- */
+/* Cone update                                                                */
+/* -------------------------------------------------------------------------- */
+
+TEST_F(TestProp, update_cone)
+{
+  uint32_t i, j, k;
+  uint64_t updates;
+  double t_cone, t_reset, t_model_gen, t_score;
+  BzlaSortId sort, sort1;
+  BzlaNode *vars[3], *c, *exps[8], *real;
+  BzlaBitVector *bv, *expected;
+  BzlaIntHashTable *roots, *moved, *model;
+  BzlaIntHashTableIterator it;
+
+  sort  = bzla_sort_bv(d_bzla, 8);
+  sort1 = bzla_sort_bv(d_bzla, 1);
+  for (i = 0; i < 3; i++) vars[i] = bzla_exp_var(d_bzla, sort, 0);
+  c = bzla_exp_var(d_bzla, sort1, 0);
+
+  exps[0] = bzla_exp_bv_add(d_bzla, vars[0], vars[1]);
+  exps[1] = bzla_exp_bv_mul(d_bzla, exps[0], vars[2]);
+  exps[2] = bzla_exp_bv_ult(d_bzla, vars[1], exps[1]);
+  exps[3] = bzla_exp_bv_and(d_bzla, exps[2], c);
+  exps[4] = bzla_exp_cond(d_bzla, exps[3], exps[1], exps[0]);
+  exps[5] = bzla_exp_bv_slice(d_bzla, exps[4], 5, 2);
+  exps[6] = bzla_exp_bv_concat(d_bzla, exps[5], bzla_node_invert(exps[0]));
+  exps[7] = bzla_exp_eq(d_bzla, exps[6], bzla_node_invert(exps[6]));
+
+  /* initial model */
+  bzla_model_init_bv(d_bzla, &d_bzla->bv_model);
+  bzla_model_init_fun(d_bzla, &d_bzla->fun_model);
+  for (i = 0; i < 3; i++)
+  {
+    bv = bzla_bv_new_random(d_mm, d_rng, 8);
+    bzla_model_add_to_bv(d_bzla, d_bzla->bv_model, vars[i], bv);
+    bzla_bv_free(d_mm, bv);
+  }
+  bv = bzla_bv_new_random(d_mm, d_rng, 1);
+  bzla_model_add_to_bv(d_bzla, d_bzla->bv_model, c, bv);
+  bzla_bv_free(d_mm, bv);
+  for (i = 0; i < 8; i++)
+  {
+    bzla_bv_free(d_mm,
+                 bzla_model_recursively_compute_assignment(
+                     d_bzla, d_bzla->bv_model, d_bzla->fun_model, exps[i]));
+  }
+
+  roots   = bzla_hashint_map_new(d_mm);
+  updates = 0;
+  t_cone = t_reset = t_model_gen = t_score = 0;
+
+  for (k = 0; k < 100; k++)
+  {
+    /* random move on a random subset of the inputs */
+    moved = bzla_hashint_map_new(d_mm);
+    for (i = 0; i < 3; i++)
+    {
+      if (!bzla_rng_pick_with_prob(d_rng, 500)) continue;
+      bzla_hashint_map_add(moved, vars[i]->id)->as_ptr =
+          bzla_bv_new_random(d_mm, d_rng, 8);
+    }
+    if (!moved->count || bzla_rng_pick_with_prob(d_rng, 500))
+    {
+      bzla_hashint_map_add(moved, c->id)->as_ptr =
+          bzla_bv_new_random(d_mm, d_rng, 1);
+    }
+
+    bzla_lsutils_update_cone(d_bzla,
+                             d_bzla->bv_model,
+                             roots,
+                             0,
+                             moved,
+                             true,
+                             &updates,
+                             &t_cone,
+                             &t_reset,
+                             &t_model_gen,
+                             &t_score);
+
+    bzla_iter_hashint_init(&it, moved);
+    while (bzla_iter_hashint_has_next(&it))
+      bzla_bv_free(d_mm,
+                   (BzlaBitVector *) bzla_iter_hashint_next_data(&it)->as_ptr);
+    bzla_hashint_map_delete(moved);
+
+    /* compare against the model recomputed from scratch */
+    model = nullptr;
+    bzla_model_init_bv(d_bzla, &model);
+    for (i = 0; i < 3; i++)
+    {
+      bzla_model_add_to_bv(
+          d_bzla,
+          model,
+          vars[i],
+          (BzlaBitVector *) bzla_hashint_map_get(d_bzla->bv_model, vars[i]->id)
+              ->as_ptr);
+    }
+    bzla_model_add_to_bv(
+        d_bzla,
+        model,
+        c,
+        (BzlaBitVector *) bzla_hashint_map_get(d_bzla->bv_model, c->id)
+            ->as_ptr);
+    for (j = 0; j < 8; j++)
+    {
+      real     = bzla_node_real_addr(exps[j]);
+      expected = bzla_model_recursively_compute_assignment(
+          d_bzla, model, d_bzla->fun_model, real);
+      ASSERT_TRUE(bzla_hashint_map_contains(d_bzla->bv_model, real->id));
+      ASSERT_EQ(
+          bzla_bv_compare(
+              expected,
+              (BzlaBitVector *) bzla_hashint_map_get(d_bzla->bv_model, real->id)
+                  ->as_ptr),
+          0);
+      bzla_bv_free(d_mm, expected);
+    }
+    bzla_model_delete_bv(d_bzla, &model);
+  }
+  ASSERT_GT(updates, 0u);
+
+  bzla_hashint_map_delete(roots);
+  for (i = 0; i < 8; i++) bzla_node_release(d_bzla, exps[i]);
+  for (i = 0; i < 3; i++) bzla_node_release(d_bzla, vars[i]);
+  bzla_node_release(d_bzla, c);
+  bzla_sort_release(d_bzla, sort1);
+  bzla_sort_release(d_bzla, sort);
+}
+
 /* -------------------------------------------------------------------------- */
 /* Inverse value computation with propagator domains, no const bits.          */
 /* -------------------------------------------------------------------------- */
@@ -14,6 +14,7 @@
 extern "C" {
 #include "bzlabv.h"
 #include "bzlaclone.h"
+#include "bzlaconsutils.h"
 #include "bzlacore.h"
 #include "bzlaexp.h"
 #include "bzlaproputils.h"
@@ -632,6 +633,88 @@ class TestPropCons : public TestPropCommon
     ss << "Number of tests (pos_x: " << pos_x << "): " << num_tests;
     log(ss.str());
   }
+
+  /**
+   * Cross-check the implementation on uint64_t for bit-widths <= 64 of the
+   * consistency check 'is_cons_fun' (with respect to const bits in x)
+   * against its generic version on random values.
+   */
+  void test_uint64(BzlaBitVector *(*bv_fun)(BzlaMemMgr *,
+                                            const BzlaBitVector *,
+                                            const BzlaBitVector *),
+                   BzlaPropIsInvFun is_cons_fun,
+                   BzlaPropIsInvFun is_cons_fun_generic,
+                   uint32_t pos_x)
+  {
+    bool is_cons;
+    Bzla *bzla;
+    BzlaBitVector *bv_s, *bv_t, *bv_x, *fixed, *lo, *hi, *tmp;
+    BzlaBvDomain *d_x, *res;
+    BzlaRNG *rng;
+    BzlaMemMgr *mm;
+
+    bzla = bzla_new();
+    mm   = bzla->mm;
+    rng  = bzla_rng_new(mm, 0);
+
+    for (uint32_t bw : {1, 2, 3, 7, 31, 32, 33, 63, 64})
+    {
+      for (uint32_t i = 0; i < 1000; ++i)
+      {
+        bv_x  = bzla_bv_new_random(mm, rng, bw);
+        bv_s  = bzla_bv_uint64_to_bv(
+            mm, bzla_rng_pick_rand(rng, 0, bw - 1), bw);
+        fixed = bzla_bv_new_random(mm, rng, bw);
+        lo    = bzla_bv_and(mm, bv_x, fixed);
+        tmp   = bzla_bv_not(mm, fixed);
+        hi    = bzla_bv_or(mm, bv_x, tmp);
+        d_x   = bzla_bvdomain_new(mm, lo, hi);
+        /* every other target value is consistent */
+        if (i % 2)
+        {
+          bv_t = bzla_bv_new_random(mm, rng, bw);
+        }
+        else
+        {
+          bv_t = pos_x ? bv_fun(mm, bv_s, bv_x) : bv_fun(mm, bv_x, bv_s);
+        }
+
+        BzlaPropInfo pi;
+        memset(&pi, 0, sizeof(BzlaPropInfo));
+        pi.pos_x         = pos_x;
+        pi.bv[pos_x]     = bv_x;
+        pi.bv[1 - pos_x] = bv_s;
+        pi.bvd[pos_x]    = d_x;
+        pi.target_value  = bv_t;
+
+        bzla_rng_init(bzla->rng, i);
+        is_cons  = is_cons_fun(bzla, &pi);
+        res      = pi.res_x;
+        pi.res_x = nullptr;
+        bzla_rng_init(bzla->rng, i);
+        ASSERT_EQ(is_cons, is_cons_fun_generic(bzla, &pi));
+        ASSERT_EQ(res == nullptr, pi.res_x == nullptr);
+        if (res)
+        {
+          ASSERT_TRUE(bzla_bvdomain_is_equal(res, pi.res_x));
+          bzla_bvdomain_free(mm, res);
+          bzla_bvdomain_free(mm, pi.res_x);
+        }
+
+        bzla_bvdomain_free(mm, d_x);
+        bzla_bv_free(mm, bv_x);
+        bzla_bv_free(mm, bv_s);
+        bzla_bv_free(mm, bv_t);
+        bzla_bv_free(mm, fixed);
+        bzla_bv_free(mm, lo);
+        bzla_bv_free(mm, hi);
+        bzla_bv_free(mm, tmp);
+      }
+    }
+
+    bzla_rng_delete(rng);
+    bzla_delete(bzla);
+  }
 };
 
 TEST_F(TestPropCons, cons_add)
@@ -764,6 +847,21 @@ TEST_F(TestPropCons, cons_srl_const)
   test_binary(bzla_exp_bv_srl, bzla_proputils_cons_srl_const, 1, true);
 }
 
+TEST_F(TestPropCons, cons_shift_const_uint64)
+{
+  for (uint32_t pos_x : {0, 1})
+  {
+    test_uint64(bzla_bv_sll,
+                bzla_is_cons_sll_const,
+                bzla_is_cons_sll_const_generic,
+                pos_x);
+    test_uint64(bzla_bv_srl,
+                bzla_is_cons_srl_const,
+                bzla_is_cons_srl_const_generic,
+                pos_x);
+  }
+}
+
 TEST_F(TestPropCons, cons_sra_const)
 {
   test_binary(bzla_exp_bv_sra, bzla_proputils_cons_sra_const, 0, true);
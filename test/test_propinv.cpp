@@ -294,6 +294,109 @@ class TestPropInv : public TestPropCommon
     log(ss.str());
   }
 
+  /**
+   * Cross-check the implementations on uint64_t for bit-widths <= 64 of
+   * the invertibility check 'is_inv_fun' and (optionally) the inverse value
+   * computation 'inv_fun' against their generic versions on random values.
+   */
+  void test_uint64(BzlaBinFun expr_fun,
+                   BzlaBitVector *(*bv_fun)(BzlaMemMgr *,
+                                            const BzlaBitVector *,
+                                            const BzlaBitVector *),
+                   BzlaPropIsInvFun is_inv_fun,
+                   BzlaPropIsInvFun is_inv_fun_generic,
+                   BzlaPropComputeValueFun inv_fun,
+                   BzlaPropComputeValueFun inv_fun_generic,
+                   uint32_t pos_x)
+  {
+    bool is_inv;
+    Bzla *bzla;
+    BzlaSortId sort;
+    BzlaBitVector *bv_s, *bv_t, *bv_x, *res, *res_generic;
+    BzlaRNG *rng;
+    BzlaSolver *slv_prop;
+    BzlaMemMgr *mm;
+    BzlaNode *x, *s, *expr;
+
+    bzla = bzla_new();
+    mm   = bzla->mm;
+    rng  = bzla_rng_new(mm, 0);
+
+    slv_prop       = bzla_new_prop_solver(bzla);
+    slv_prop->bzla = bzla;
+    bzla->slv      = slv_prop;
+
+    bzla_opt_set(bzla, BZLA_OPT_RW_LEVEL, 0);
+
+    for (uint32_t bw : {1, 2, 3, 7, 31, 32, 33, 63, 64})
+    {
+      sort = bzla_sort_bv(bzla, bw);
+      x    = bzla_exp_var(bzla, sort, "x");
+      s    = bzla_exp_var(bzla, sort, "s");
+      expr = pos_x ? expr_fun(bzla, s, x) : expr_fun(bzla, x, s);
+      bzla_sort_release(bzla, sort);
+
+      for (uint32_t i = 0; i < 1000; ++i)
+      {
+        bv_x = bzla_bv_new_random(mm, rng, bw);
+        /* pick values < bw (e.g., valid shift amounts) with prob 0.33 */
+        if (i % 3)
+        {
+          bv_s = bzla_bv_new_random(mm, rng, bw);
+        }
+        else
+        {
+          bv_s =
+              bzla_bv_uint64_to_bv(mm, bzla_rng_pick_rand(rng, 0, bw - 1), bw);
+        }
+        /* every other target value is invertible */
+        if (i % 2)
+        {
+          bv_t = bzla_bv_new_random(mm, rng, bw);
+        }
+        else
+        {
+          bv_t = pos_x ? bv_fun(mm, bv_s, bv_x) : bv_fun(mm, bv_x, bv_s);
+        }
+
+        BzlaPropInfo pi;
+        memset(&pi, 0, sizeof(BzlaPropInfo));
+        pi.pos_x         = pos_x;
+        pi.exp           = expr;
+        pi.bv[pos_x]     = bv_x;
+        pi.bv[1 - pos_x] = bv_s;
+        pi.target_value  = bv_t;
+
+        is_inv = is_inv_fun(bzla, &pi);
+        ASSERT_EQ(is_inv, is_inv_fun_generic(bzla, &pi));
+
+        if (is_inv && inv_fun)
+        {
+          bzla_rng_init(bzla->rng, i);
+          res = inv_fun(bzla, &pi);
+          bzla_rng_init(bzla->rng, i);
+          res_generic = inv_fun_generic(bzla, &pi);
+          ASSERT_EQ(bzla_bv_compare(res, res_generic), 0);
+          bzla_bv_free(mm, res);
+          bzla_bv_free(mm, res_generic);
+        }
+
+        bzla_bv_free(mm, bv_x);
+        bzla_bv_free(mm, bv_s);
+        bzla_bv_free(mm, bv_t);
+      }
+
+      bzla_node_release(bzla, x);
+      bzla_node_release(bzla, s);
+      bzla_node_release(bzla, expr);
+    }
+
+    slv_prop->api.delet(slv_prop);
+    bzla->slv = nullptr;
+    bzla_rng_delete(rng);
+    bzla_delete(bzla);
+  }
+
   void test_slice(BzlaPropIsInvFun is_inv_fun,
                   BzlaPropComputeValueFun inv_fun,
                   bool fixed_bits)
@@ -799,6 +902,52 @@ TEST_F(TestPropInv, inv_sra)
       bzla_exp_bv_sra, bzla_is_inv_sra, bzla_proputils_inv_sra, 1, false);
 }
 
+TEST_F(TestPropInv, inv_mul_uint64)
+{
+  test_uint64(bzla_exp_bv_mul,
+              bzla_bv_mul,
+              bzla_is_inv_mul,
+              bzla_is_inv_mul_generic,
+              bzla_proputils_inv_mul,
+              bzla_proputils_inv_mul_generic,
+              0);
+  test_uint64(bzla_exp_bv_mul,
+              bzla_bv_mul,
+              bzla_is_inv_mul,
+              bzla_is_inv_mul_generic,
+              bzla_proputils_inv_mul,
+              bzla_proputils_inv_mul_generic,
+              1);
+}
+
+TEST_F(TestPropInv, inv_shift_uint64)
+{
+  for (uint32_t pos_x : {0, 1})
+  {
+    test_uint64(bzla_exp_bv_sll,
+                bzla_bv_sll,
+                bzla_is_inv_sll,
+                bzla_is_inv_sll_generic,
+                nullptr,
+                nullptr,
+                pos_x);
+    test_uint64(bzla_exp_bv_srl,
+                bzla_bv_srl,
+                bzla_is_inv_srl,
+                bzla_is_inv_srl_generic,
+                nullptr,
+                nullptr,
+                pos_x);
+    test_uint64(bzla_exp_bv_sra,
+                bzla_bv_sra,
+                bzla_is_inv_sra,
+                bzla_is_inv_sra_generic,
+                nullptr,
+                nullptr,
+                pos_x);
+  }
+}
+
 TEST_F(TestPropInv, inv_udiv)
 {
   test_binary(
@@ -8,6 +8,8 @@
  * See COPYING for more information on using this software.
  */
 
+#include <vector>
+
 #include "test.h"
 
 extern "C" {
@@ -42,3 +44,85 @@ TEST_F(TestSatMgr, next_cnf_id)
   ASSERT_EQ(bzla_sat_mgr_next_cnf_id(d_smgr), 4);
   bzla_sat_reset(d_smgr);
 }
+
+TEST_F(TestSatMgr, phase)
+{
+  int32_t x, y, z, phase;
+
+  bzla_sat_enable_solver(d_smgr);
+  if (!bzla_sat_mgr_has_phase_support(d_smgr)) return;
+
+  /* Exactly one of x and y is true, hence the phase of whichever variable
+   * is decided first determines the model. Both phase hints agree on the
+   * same model, and we check both polarities to make sure that the hints
+   * rather than a default phase determine it. Assuming an unconstrained
+   * variable z keeps CaDiCaL from trying its 'lucky' assignments. */
+  for (phase = 1; phase >= -1; phase -= 2)
+  {
+    bzla_sat_init(d_smgr);
+    x = bzla_sat_mgr_next_cnf_id(d_smgr);
+    y = bzla_sat_mgr_next_cnf_id(d_smgr);
+    z = bzla_sat_mgr_next_cnf_id(d_smgr);
+    bzla_sat_add(d_smgr, x);
+    bzla_sat_add(d_smgr, y);
+    bzla_sat_add(d_smgr, 0);
+    bzla_sat_add(d_smgr, -x);
+    bzla_sat_add(d_smgr, -y);
+    bzla_sat_add(d_smgr, 0);
+    bzla_sat_phase(d_smgr, phase * x);
+    bzla_sat_phase(d_smgr, -phase * y);
+    bzla_sat_assume(d_smgr, z);
+    ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+    ASSERT_EQ(bzla_sat_deref(d_smgr, x), phase);
+    ASSERT_EQ(bzla_sat_deref(d_smgr, y), -phase);
+    bzla_sat_reset(d_smgr);
+  }
+}
+
+static void
+count_sat_calls(void *state, const BzlaSATCall *call)
+{
+  std::vector<BzlaSATCall> *calls =
+      static_cast<std::vector<BzlaSATCall> *>(state);
+  calls->push_back(*call);
+}
+
+TEST_F(TestSatMgr, call_callback)
+{
+  int32_t x, y;
+  std::vector<BzlaSATCall> calls;
+
+  bzla_sat_enable_solver(d_smgr);
+  if (!bzla_sat_mgr_has_incremental_support(d_smgr)) return;
+  bzla_sat_mgr_set_call_callback(d_smgr, count_sat_calls, &calls);
+  bzla_sat_init(d_smgr);
+  x = bzla_sat_mgr_next_cnf_id(d_smgr);
+  y = bzla_sat_mgr_next_cnf_id(d_smgr);
+  bzla_sat_add(d_smgr, x);
+  bzla_sat_add(d_smgr, y);
+  bzla_sat_add(d_smgr, 0);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+  bzla_sat_assume(d_smgr, -x);
+  bzla_sat_assume(d_smgr, -y);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_UNSAT);
+  bzla_sat_reset(d_smgr);
+
+  ASSERT_EQ(calls.size(), 2u);
+  ASSERT_EQ(calls[0].id, 1u);
+  ASSERT_EQ(calls[0].result, BZLA_RESULT_SAT);
+  ASSERT_EQ(calls[0].clauses, 2u);
+  ASSERT_EQ(calls[0].vars, 3u);
+  ASSERT_EQ(calls[0].assumptions, 0u);
+  ASSERT_EQ(calls[1].id, 2u);
+  ASSERT_EQ(calls[1].result, BZLA_RESULT_UNSAT);
+  ASSERT_EQ(calls[1].clauses, 0u);
+  ASSERT_EQ(calls[1].vars, 0u);
+  ASSERT_EQ(calls[1].assumptions, 2u);
+  if (strcmp(d_smgr->name, "CaDiCaL") == 0)
+  {
+    /* CaDiCaL's C API does not provide any counters */
+    ASSERT_EQ(calls[0].conflicts, -1);
+    ASSERT_EQ(calls[1].conflicts, -1);
+    ASSERT_EQ(calls[1].decisions, -1);
+  }
+}
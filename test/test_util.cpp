@@ -96,3 +96,29 @@ TEST(TestUtil, num_digits)
   ASSERT_EQ(bzla_util_num_digits(100343), 6u);
   ASSERT_EQ(bzla_util_num_digits(2343443), 7u);
 }
+
+TEST(TestUtil, uint64_pdep)
+{
+  ASSERT_EQ(bzla_util_uint64_pdep(0, 0xf0f0), 0u);
+  ASSERT_EQ(bzla_util_uint64_pdep(0x5, 0), 0u);
+  ASSERT_EQ(bzla_util_uint64_pdep(0x5, 0xf0f0), 0x50u);
+  ASSERT_EQ(bzla_util_uint64_pdep(0x1b, 0xf0f0), 0x10b0u);
+  ASSERT_EQ(bzla_util_uint64_pdep(0xff, 0xf0f0), 0xf0f0u);
+  ASSERT_EQ(bzla_util_uint64_pdep(0x3, UINT64_C(0x8000000000000001)),
+            UINT64_C(0x8000000000000001));
+  ASSERT_EQ(bzla_util_uint64_pdep(UINT64_MAX, UINT64_MAX), UINT64_MAX);
+}
+
+TEST(TestUtil, uint64_pdep_inc)
+{
+  uint64_t mask, v;
+  uint32_t i;
+
+  mask = UINT64_C(0x8000000000f0f001);
+  for (i = 0, v = 0; i < 1024; i++)
+  {
+    ASSERT_EQ(v, bzla_util_uint64_pdep(i, mask));
+    v = bzla_util_uint64_pdep_inc(v, mask);
+  }
+  ASSERT_EQ(v, 0u);
+}